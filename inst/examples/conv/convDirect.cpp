@@ -0,0 +1,15 @@
+// [[Rcpp::depends(RcppArmadillo)]]
+
+// the default direct evaluation in conv() and conv2()
+
+#include <RcppArmadillo.h>
+
+// [[Rcpp::export]]
+arma::vec convDirect(const arma::vec& x, const arma::vec& h) {
+    return arma::conv(x, h);
+}
+
+// [[Rcpp::export]]
+arma::mat conv2Direct(const arma::mat& W, const arma::mat& G) {
+    return arma::conv2(W, G);
+}
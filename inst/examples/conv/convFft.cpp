@@ -0,0 +1,17 @@
+// [[Rcpp::depends(RcppArmadillo)]]
+
+// allow FFT-based evaluation in conv() and conv2()
+#define ARMA_OPTIMISE_CONV
+
+#include <RcppArmadillo.h>
+
+// conv() switches to FFT-based evaluation above an estimated cost crossover
+// [[Rcpp::export]]
+arma::vec convFft(const arma::vec& x, const arma::vec& h) {
+    return arma::conv(x, h);
+}
+
+// [[Rcpp::export]]
+arma::mat conv2Fft(const arma::mat& W, const arma::mat& G) {
+    return arma::conv2(W, G);
+}
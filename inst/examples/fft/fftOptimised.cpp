@@ -0,0 +1,18 @@
+// [[Rcpp::depends(RcppArmadillo)]]
+
+#include <RcppArmadillo.h>
+
+// repeated forward transforms of a complex vector, returning the elapsed time in seconds
+// [[Rcpp::export]]
+double fftOptimised(arma::cx_vec x, int reps) {
+    arma::wall_clock timer;
+    arma::cx_vec y;
+    timer.tic();
+    for (int i = 0; i < reps; ++i) y = arma::fft(x);
+    return timer.toc();
+}
+
+// [[Rcpp::export]]
+arma::cx_vec fftOptimisedResult(arma::cx_vec x) {
+    return arma::fft(x);
+}
@@ -0,0 +1,21 @@
+// [[Rcpp::depends(RcppArmadillo)]]
+
+// restrict the FFT engine to the original radix 2, 3, 4, 5 and generic butterflies
+#define ARMA_DONT_OPTIMISE_FFT
+
+#include <RcppArmadillo.h>
+
+// repeated forward transforms of a complex vector, returning the elapsed time in seconds
+// [[Rcpp::export]]
+double fftOriginal(arma::cx_vec x, int reps) {
+    arma::wall_clock timer;
+    arma::cx_vec y;
+    timer.tic();
+    for (int i = 0; i < reps; ++i) y = arma::fft(x);
+    return timer.toc();
+}
+
+// [[Rcpp::export]]
+arma::cx_vec fftOriginalResult(arma::cx_vec x) {
+    return arma::fft(x);
+}
@@ -0,0 +1,13 @@
+// [[Rcpp::depends(RcppArmadillo)]]
+
+// evaluate the distances from each sample to all means in every iteration
+#define ARMA_DONT_OPTIMISE_KMEANS
+
+#include <RcppArmadillo.h>
+
+// [[Rcpp::export]]
+arma::mat kmeansFull(const arma::mat& X, int k) {
+    arma::mat means;
+    if (!arma::kmeans(means, X, k, arma::static_subset, 20, false)) Rcpp::stop("clustering failed");
+    return means;
+}
@@ -0,0 +1,11 @@
+// [[Rcpp::depends(RcppArmadillo)]]
+
+#include <RcppArmadillo.h>
+
+// kmeans() skips the distances ruled out by bounds kept for each sample
+// [[Rcpp::export]]
+arma::mat kmeansPruned(const arma::mat& X, int k, bool verbose = false) {
+    arma::mat means;
+    if (!arma::kmeans(means, X, k, arma::static_subset, 20, verbose)) Rcpp::stop("clustering failed");
+    return means;
+}
@@ -0,0 +1,35 @@
+// [[Rcpp::depends(RcppArmadillo)]]
+
+// the default std::map based element cache of sparse matrices
+
+#include <RcppArmadillo.h>
+
+// random insertion, followed by a single conversion to CSC format
+// [[Rcpp::export]]
+double insertMap(arma::uvec rows, arma::uvec cols, int n) {
+    arma::sp_mat A(n, n);
+    for (arma::uword i = 0; i < rows.n_elem; ++i) A(rows[i], cols[i]) = 1.0;
+    A.sync();
+    return double(A.n_nonzero);
+}
+
+// random accumulation, as when assembling a matrix element by element
+// [[Rcpp::export]]
+double accumulateMap(arma::uvec rows, arma::uvec cols, int n) {
+    arma::sp_mat A(n, n);
+    for (arma::uword i = 0; i < rows.n_elem; ++i) A(rows[i], cols[i]) += 1.0;
+    A.sync();
+    return double(A.n_nonzero);
+}
+
+// small batches of insertions, each followed by a read which requires CSC format
+// [[Rcpp::export]]
+double interleavedMap(arma::uvec rows, arma::uvec cols, int n, int batch) {
+    arma::sp_mat A(n, n);
+    double total = 0.0;
+    for (arma::uword i = 0; i < rows.n_elem; ++i) {
+        A(rows[i], cols[i]) = 1.0;
+        if ((i % arma::uword(batch)) == 0) total += arma::accu(A);
+    }
+    return total;
+}
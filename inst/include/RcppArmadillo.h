@@ -35,5 +35,6 @@
 #include <RcppArmadillo/interface/RcppArmadilloWrap.h>
 #include <RcppArmadillo/interface/RcppArmadilloAs.h>
 #include <RcppArmadillo/interface/RcppArmadilloSugar.h>
+#include <RcppArmadillo/interface/RcppArmadilloSerialize.h>
 
 #endif
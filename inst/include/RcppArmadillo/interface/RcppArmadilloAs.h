@@ -452,6 +452,32 @@ namespace traits {
         bool is_stm;
     } ;
 
+    // row-major sparse matrices: a dgRMatrix is read directly without
+    // reordering, all other formats go through the SpMat importer
+    template <typename T>
+    class Exporter< arma::SpMatR<T> > {
+    public:
+        Exporter( SEXP x ) : obj(x) {}
+
+        arma::SpMatR<T> get(){
+            if (Rf_isS4(obj) && S4(obj).is("dgRMatrix")) {
+                S4 mat(obj);
+                IntegerVector dims = mat.slot("Dim");
+                arma::uvec rj = mat.slot("j");
+                arma::uvec rp = mat.slot("p");
+                arma::Col<T> rx = mat.slot("x");
+
+                return arma::SpMatR<T>(rj, rp, rx, dims[0], dims[1], false);
+            }
+
+            Exporter< arma::SpMat<T> > exporter(obj);
+            return arma::SpMatR<T>(exporter.get());
+        }
+
+    private:
+        SEXP obj;
+    } ;
+
     // 30 November 2015
     // default Exporter-Cube specialization:
     // handles cube, icube, and cx_cube
@@ -61,6 +61,8 @@ namespace Rcpp {
     template <typename T> SEXP wrap ( const arma::subview<T>& ) ;
     template <typename T> SEXP wrap ( const arma::subview_cols<T>& ) ;
     template <typename T> SEXP wrap ( const arma::SpMat<T>& ) ;
+    template <typename T> SEXP wrap ( const arma::SpMatR<T>& ) ;
+    template <typename T> SEXP wrap ( const arma::summary_stats<T>& ) ;
 
     template <typename T1, typename T2, typename glue_type>
     SEXP wrap(const arma::Glue<T1, T2, glue_type>& X ) ;
@@ -105,6 +107,7 @@ namespace Rcpp {
 	template <typename T> class Exporter< arma::Row<T> > ;
 	template <typename T> class Exporter< arma::Col<T> > ;
 	template <typename T> class Exporter< arma::SpMat<T> > ;
+	template <typename T> class Exporter< arma::SpMatR<T> > ;
 
 	template <typename T> class Exporter< arma::field<T> > ;
     // template <typename T> class Exporter< arma::Cube<T> > ;
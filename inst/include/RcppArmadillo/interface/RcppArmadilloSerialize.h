@@ -0,0 +1,123 @@
+// RcppArmadilloSerialize.h: Rcpp/Armadillo glue, serialization to raw vectors
+//
+// Copyright (C)  2026  Dirk Eddelbuettel
+//
+// This file is part of RcppArmadillo.
+//
+// RcppArmadillo is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// RcppArmadillo is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with RcppArmadillo.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef RcppArmadillo__RcppArmadilloSerialize__h
+#define RcppArmadillo__RcppArmadilloSerialize__h
+
+#include <streambuf>
+
+namespace Rcpp{
+
+namespace RcppArmadillo{
+
+    // stream buffer writing into a fixed block of memory; with a null
+    // pointer it only counts the bytes, which is used to size the vector
+    class raw_ostreambuf : public std::streambuf {
+    public:
+        raw_ostreambuf(char* mem, std::size_t n) : mem_(mem), n_(n), pos_(0) {}
+
+        inline std::size_t size() const { return pos_; }
+
+    protected:
+        std::streamsize xsputn(const char* s, std::streamsize n) {
+            const std::size_t len = static_cast<std::size_t>(n);
+            if (mem_ != nullptr && len > 0) {
+                if (len > n_ - pos_) return 0;
+                std::memcpy(mem_ + pos_, s, len);
+            }
+            pos_ += len;
+            return n;
+        }
+
+        int_type overflow(int_type c) {
+            if (traits_type::eq_int_type(c, traits_type::eof())) return traits_type::not_eof(c);
+            const char ch = traits_type::to_char_type(c);
+            return (xsputn(&ch, 1) == 1) ? c : traits_type::eof();
+        }
+
+    private:
+        char*       mem_;
+        std::size_t n_;
+        std::size_t pos_;
+    };
+
+    // read-only stream buffer over a block of memory; reads are plain
+    // copies out of the buffer, and seeking is supported for the loaders
+    class raw_istreambuf : public std::streambuf {
+    public:
+        raw_istreambuf(const char* mem, std::size_t n) {
+            char* p = const_cast<char*>(mem);
+            setg(p, p, p + n);
+        }
+
+    protected:
+        pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) {
+            if ((which & std::ios_base::in) == 0) return pos_type(off_type(-1));
+            off_type pos = off;
+            if (dir == std::ios_base::cur) pos += gptr() - eback();
+            else if (dir == std::ios_base::end) pos += egptr() - eback();
+            if (pos < 0 || pos > egptr() - eback()) return pos_type(off_type(-1));
+            setg(eback(), eback() + pos, egptr());
+            return pos_type(pos);
+        }
+
+        pos_type seekpos(pos_type pos, std::ios_base::openmode which) {
+            return seekoff(off_type(pos), std::ios_base::beg, which);
+        }
+    };
+
+} // RcppArmadillo
+
+// Serialize an Armadillo object (Mat, Col, Row, Cube, SpMat, or a field of
+// matrices or cubes) into a raw vector holding the arma_binary layout, so
+// that writeBin() of the result gives a file readable by load(); the vector
+// is allocated once at its final size and the elements are copied directly
+template <typename T> RawVector arma_serialize(const T& x) {
+    RcppArmadillo::raw_ostreambuf counter(nullptr, 0);
+    std::ostream counter_os(&counter);
+    if (!x.save(counter_os, arma::arma_binary)) {
+        Rcpp::stop("arma_serialize(): serialization failed");
+    }
+
+    RawVector out(Rcpp::no_init(static_cast<R_xlen_t>(counter.size())));
+
+    RcppArmadillo::raw_ostreambuf buf(reinterpret_cast<char*>(RAW(out)), counter.size());
+    std::ostream os(&buf);
+    if (!x.save(os, arma::arma_binary) || buf.size() != counter.size()) {
+        Rcpp::stop("arma_serialize(): serialization failed");
+    }
+    return out;
+}
+
+// Restore an object of type T from a raw vector created by arma_serialize()
+// (or read from an arma_binary file); the elements are copied straight from
+// the vector into the object
+template <typename T> T arma_unserialize(const RawVector& x) {
+    RcppArmadillo::raw_istreambuf buf(reinterpret_cast<const char*>(RAW(x)), static_cast<std::size_t>(x.size()));
+    std::istream is(&buf);
+    T out;
+    if (!out.load(is, arma::arma_binary)) {
+        Rcpp::stop("arma_unserialize(): data does not hold an object of the requested type");
+    }
+    return out;
+}
+
+} // Rcpp
+
+#endif
@@ -129,6 +129,36 @@ namespace Rcpp{
         return s;
     }
 
+    // row-major sparse matrices map directly onto dgRMatrix
+    template <typename T> SEXP wrap ( const arma::SpMatR<T>& sm ){
+        const int  RTYPE = Rcpp::traits::r_sexptype_traits<T>::rtype;
+
+        IntegerVector dim = IntegerVector::create(sm.n_rows, sm.n_cols);
+
+        // copy the data into R objects; the CSR arrays need no reordering
+        Vector<RTYPE> x(sm.values, sm.values + sm.n_nonzero ) ;
+        IntegerVector j(sm.col_indices, sm.col_indices + sm.n_nonzero);
+        IntegerVector p(sm.row_ptrs, sm.row_ptrs + sm.n_rows+1 ) ;
+
+        S4 s("dgRMatrix");
+        s.slot("j")   = j;
+        s.slot("p")   = p;
+        s.slot("x")   = x;
+        s.slot("Dim") = dim;
+        return s;
+    }
+
+
+    /* summary_stats<T> from arma::summarise() becomes a named list */
+    template <typename T> SEXP wrap ( const arma::summary_stats<T>& st ){
+        return List::create(Named("mean")        = st.mean,
+                            Named("var")         = st.var,
+                            Named("min")         = st.min,
+                            Named("max")         = st.max,
+                            Named("count")       = st.count,
+                            Named("n_nonfinite") = st.n_nonfinite);
+    }
+
 
     namespace RcppArmadillo {
 
@@ -4635,6 +4635,10 @@ Cube<eT>::save(const std::string name, const file_type type) const
       save_okay = diskio::save_arma_binary(*this, name);
       break;
     
+    case arma_zbinary:
+      save_okay = diskio::save_arma_zbinary(*this, name);
+      break;
+    
     case ppm_binary:
       save_okay = diskio::save_ppm_binary(*this, name);
       break;
@@ -4745,6 +4749,10 @@ Cube<eT>::save(std::ostream& os, const file_type type) const
       save_okay = diskio::save_arma_binary(*this, os);
       break;
     
+    case arma_zbinary:
+      save_okay = diskio::save_arma_zbinary(*this, os);
+      break;
+    
     case ppm_binary:
       save_okay = diskio::save_ppm_binary(*this, os);
       break;
@@ -4794,6 +4802,10 @@ Cube<eT>::load(const std::string name, const file_type type)
       load_okay = diskio::load_arma_binary(*this, name, err_msg);
       break;
     
+    case arma_zbinary:
+      load_okay = diskio::load_arma_zbinary(*this, name, err_msg);
+      break;
+    
     case ppm_binary:
       load_okay = diskio::load_ppm_binary(*this, name, err_msg);
       break;
@@ -4914,6 +4926,10 @@ Cube<eT>::load(std::istream& is, const file_type type)
       load_okay = diskio::load_arma_binary(*this, is, err_msg);
       break;
     
+    case arma_zbinary:
+      load_okay = diskio::load_arma_zbinary(*this, is, err_msg);
+      break;
+    
     case ppm_binary:
       load_okay = diskio::load_ppm_binary(*this, is, err_msg);
       break;
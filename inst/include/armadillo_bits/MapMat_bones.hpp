@@ -41,7 +41,11 @@ class MapMat
   
   private:
   
-  typedef typename std::map<uword, eT> map_type;
+  #if defined(ARMA_OPTIMISE_SPCACHE)
+    typedef MapMat_hash<eT> map_type;
+  #else
+    typedef typename std::map<uword, eT> map_type;
+  #endif
   
   arma_aligned map_type* map_ptr;
   
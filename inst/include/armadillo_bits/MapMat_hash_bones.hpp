@@ -0,0 +1,130 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2026 Dirk Eddelbuettel
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// https://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+
+//! \addtogroup MapMat_hash
+//! @{
+
+
+
+// this class is for internal use only; subject to change and/or removal without notice
+
+//! Element storage for MapMat, used in place of std::map when ARMA_OPTIMISE_SPCACHE is enabled.
+//! Elements are held in an array sorted by index, plus an open-addressing hash table for newly inserted elements
+//! whose index does not extend the sorted array.  Insertions and removals merge the hash table into the array
+//! once it holds a fraction of the number of elements in the array, as does the non-const begin();
+//! the const begin() walks both without modifying them, so that const member functions can be used concurrently.
+//! Only the subset of the std::map interface used by MapMat is provided;
+//! a non-const iterator is a pointer to an element, and end() is a null pointer.
+template<typename eT>
+class MapMat_hash
+  {
+  public:
+  
+  typedef std::pair<uword, eT> value_type;
+  typedef       value_type*    iterator;
+  
+  class const_iterator
+    {
+    public:
+    
+    inline const_iterator(const value_type* in_ptr = nullptr);
+    inline const_iterator(const MapMat_hash& in_parent);  //!< ordered traversal of all elements
+    
+    arma_inline const value_type& operator* () const { return (*ptr); }
+    arma_inline const value_type* operator->() const { return   ptr;  }
+    
+    inline const_iterator& operator++();
+    
+    arma_inline bool operator==(const const_iterator& rhs) const { return (ptr == rhs.ptr); }
+    arma_inline bool operator!=(const const_iterator& rhs) const { return (ptr != rhs.ptr); }
+    
+    
+    private:
+    
+    const value_type* ptr;
+    
+    const value_type* sorted_ptr;
+    const value_type* sorted_end;
+    const u8*         erased_ptr;
+    
+    const value_type* table_ptr;
+    const value_type* table_end;
+    
+    std::shared_ptr< std::vector<value_type> > table_copy;  //!< sorted copy of the elements in the hash table
+    
+    inline void advance();
+    };
+  
+  inline MapMat_hash();
+  
+  arma_warn_unused inline bool  empty() const;
+  arma_warn_unused inline uword size()  const;
+  
+  inline void clear();
+  
+  arma_warn_unused inline       iterator find(const uword key);
+  arma_warn_unused inline const_iterator find(const uword key) const;
+  
+  arma_warn_unused arma_inline       iterator  end();
+  arma_warn_unused arma_inline const_iterator  end() const;
+  arma_warn_unused arma_inline const_iterator cend() const;
+  
+  arma_warn_unused inline       iterator begin();
+  arma_warn_unused inline const_iterator begin() const;
+  
+  arma_warn_unused inline eT& operator[](const uword key);
+  
+  inline void emplace_hint(const_iterator hint, const uword key, const eT& val);
+  
+  inline void erase(iterator it);
+  inline void erase(const uword key);
+  
+  
+  private:
+  
+  std::vector<value_type> sorted;   //!< elements ordered by index
+  std::vector<u8>         erased;   //!< erased[i] is non-zero if sorted[i] has been removed
+  std::vector<value_type> table;    //!< hash table with linear probing; unused slots hold empty_key()
+  
+  uword n_erased;
+  uword n_table;
+  uword table_shift;
+  
+  arma_inline static uword empty_key();
+  
+  arma_inline uword slot(const uword key) const;
+  
+  inline const value_type* find_ptr(const uword key) const;
+  
+  inline uword find_sorted(const uword key) const;  //!< position in the sorted array, or its size if not found
+  inline uword find_table (const uword key) const;  //!< position in the hash table, or its size if not found
+  
+  inline value_type& insert_table(const uword key);
+  inline void        erase_table(uword pos);
+  inline void        grow_table();
+  
+  static constexpr uword flush_min      = 64;
+  static constexpr uword flush_fraction = 16;
+  
+  inline bool flush_due() const;
+  inline void flush();
+  };
+
+
+
+//! @}
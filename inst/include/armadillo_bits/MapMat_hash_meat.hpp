@@ -0,0 +1,621 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2026 Dirk Eddelbuettel
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// https://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+
+//! \addtogroup MapMat_hash
+//! @{
+
+
+
+template<typename eT>
+inline
+MapMat_hash<eT>::const_iterator::const_iterator(const value_type* in_ptr)
+  : ptr       (in_ptr )
+  , sorted_ptr(nullptr)
+  , sorted_end(nullptr)
+  , erased_ptr(nullptr)
+  , table_ptr (nullptr)
+  , table_end (nullptr)
+  {
+  }
+
+
+
+template<typename eT>
+inline
+MapMat_hash<eT>::const_iterator::const_iterator(const MapMat_hash<eT>& in_parent)
+  : ptr       (nullptr)
+  , sorted_ptr(in_parent.sorted.data())
+  , sorted_end(in_parent.sorted.data() + in_parent.sorted.size())
+  , erased_ptr(in_parent.erased.data())
+  , table_ptr (nullptr)
+  , table_end (nullptr)
+  {
+  arma_debug_sigprint();
+  
+  if(in_parent.n_table > 0)
+    {
+    table_copy = std::make_shared< std::vector<value_type> >();
+    
+    std::vector<value_type>& tmp = (*table_copy);
+    
+    tmp.reserve(in_parent.n_table);
+    
+    for(const value_type& entry : in_parent.table)
+      {
+      if(entry.first != empty_key())  { tmp.push_back(entry); }
+      }
+    
+    const auto comparator = [](const value_type& a, const value_type& b) { return (a.first < b.first); };
+    
+    std::sort(tmp.begin(), tmp.end(), comparator);
+    
+    table_ptr = tmp.data();
+    table_end = tmp.data() + tmp.size();
+    }
+  
+  advance();
+  }
+
+
+
+template<typename eT>
+inline
+typename MapMat_hash<eT>::const_iterator&
+MapMat_hash<eT>::const_iterator::operator++()
+  {
+  advance();
+  
+  return *this;
+  }
+
+
+
+//! move to the element with the lower index from either the sorted array (skipping removed elements) or the hash table;
+//! the two hold disjoint sets of indices
+template<typename eT>
+inline
+void
+MapMat_hash<eT>::const_iterator::advance()
+  {
+  while( (sorted_ptr != sorted_end) && ((*erased_ptr) != u8(0)) )  { ++sorted_ptr; ++erased_ptr; }
+  
+  const bool have_sorted = (sorted_ptr != sorted_end);
+  const bool have_table  = (table_ptr  != table_end );
+  
+  if( have_sorted && ( (have_table == false) || ((*sorted_ptr).first < (*table_ptr).first) ) )
+    {
+    ptr = sorted_ptr;  ++sorted_ptr;  ++erased_ptr;
+    }
+  else
+  if(have_table)
+    {
+    ptr = table_ptr;  ++table_ptr;
+    }
+  else
+    {
+    ptr = nullptr;
+    }
+  }
+
+
+
+template<typename eT>
+inline
+MapMat_hash<eT>::MapMat_hash()
+  : n_erased   (0)
+  , n_table    (0)
+  , table_shift(0)
+  {
+  arma_debug_sigprint_this(this);
+  }
+
+
+
+template<typename eT>
+inline
+bool
+MapMat_hash<eT>::empty() const
+  {
+  return (size() == 0);
+  }
+
+
+
+template<typename eT>
+inline
+uword
+MapMat_hash<eT>::size() const
+  {
+  return uword(sorted.size()) - n_erased + n_table;
+  }
+
+
+
+template<typename eT>
+inline
+void
+MapMat_hash<eT>::clear()
+  {
+  arma_debug_sigprint();
+  
+  // release the memory, as std::map does
+  
+  std::vector<value_type>().swap(sorted);
+  std::vector<u8        >().swap(erased);
+  std::vector<value_type>().swap(table);
+  
+  n_erased    = 0;
+  n_table     = 0;
+  table_shift = 0;
+  }
+
+
+
+template<typename eT>
+inline
+typename MapMat_hash<eT>::iterator
+MapMat_hash<eT>::find(const uword key)
+  {
+  return const_cast<value_type*>( find_ptr(key) );
+  }
+
+
+
+template<typename eT>
+inline
+typename MapMat_hash<eT>::const_iterator
+MapMat_hash<eT>::find(const uword key) const
+  {
+  return const_iterator( find_ptr(key) );
+  }
+
+
+
+template<typename eT>
+arma_inline
+typename MapMat_hash<eT>::iterator
+MapMat_hash<eT>::end()
+  {
+  return nullptr;
+  }
+
+
+
+template<typename eT>
+arma_inline
+typename MapMat_hash<eT>::const_iterator
+MapMat_hash<eT>::end() const
+  {
+  return const_iterator();
+  }
+
+
+
+template<typename eT>
+arma_inline
+typename MapMat_hash<eT>::const_iterator
+MapMat_hash<eT>::cend() const
+  {
+  return const_iterator();
+  }
+
+
+
+//! start of the ordered traversal; the hash table is merged into the sorted array first,
+//! so the elements are contiguous and there are size() of them
+template<typename eT>
+inline
+typename MapMat_hash<eT>::iterator
+MapMat_hash<eT>::begin()
+  {
+  flush();
+  
+  return (sorted.empty()) ? nullptr : sorted.data();
+  }
+
+
+
+//! start of the ordered traversal, without modifying the storage; the iterator reaches end() after size() increments
+template<typename eT>
+inline
+typename MapMat_hash<eT>::const_iterator
+MapMat_hash<eT>::begin() const
+  {
+  return const_iterator(*this);
+  }
+
+
+
+//! creates the element if it doesn't exist
+template<typename eT>
+inline
+eT&
+MapMat_hash<eT>::operator[](const uword key)
+  {
+  const uword table_pos = find_table(key);
+  
+  if(table_pos < uword(table.size()))  { return table[table_pos].second; }
+  
+  if( sorted.empty() || (key > sorted.back().first) )
+    {
+    sorted.push_back( value_type(key, eT(0)) );
+    erased.push_back( u8(0) );
+    
+    return sorted.back().second;
+    }
+  
+  const uword sorted_pos = find_sorted(key);
+  
+  if(sorted_pos < uword(sorted.size()))
+    {
+    u8& flag = erased[sorted_pos];
+    
+    if(flag != u8(0))  { flag = u8(0); --n_erased; sorted[sorted_pos].second = eT(0); }
+    
+    return sorted[sorted_pos].second;
+    }
+  
+  return insert_table(key).second;
+  }
+
+
+
+//! as per std::map, an existing element is not modified
+template<typename eT>
+inline
+void
+MapMat_hash<eT>::emplace_hint(const_iterator hint, const uword key, const eT& val)
+  {
+  arma_ignore(hint);
+  
+  if(find_table(key) < uword(table.size()))  { return; }
+  
+  if( sorted.empty() || (key > sorted.back().first) )
+    {
+    sorted.push_back( value_type(key, val) );
+    erased.push_back( u8(0) );
+    
+    return;
+    }
+  
+  const uword sorted_pos = find_sorted(key);
+  
+  if(sorted_pos < uword(sorted.size()))
+    {
+    u8& flag = erased[sorted_pos];
+    
+    if(flag != u8(0))  { flag = u8(0); --n_erased; sorted[sorted_pos].second = val; }
+    
+    return;
+    }
+  
+  insert_table(key).second = val;
+  }
+
+
+
+template<typename eT>
+inline
+void
+MapMat_hash<eT>::erase(iterator it)
+  {
+  if(it == nullptr)  { return; }
+  
+  const std::less<const value_type*> is_before;
+  
+  const value_type* sorted_start = sorted.data();
+  const value_type* sorted_end   = sorted.data() + sorted.size();
+  
+  if( (sorted.empty() == false) && (is_before(it, sorted_start) == false) && is_before(it, sorted_end) )
+    {
+    const uword i = uword(it - sorted_start);
+    
+    if(erased[i] == u8(0))  { erased[i] = u8(1); ++n_erased; }
+    
+    // trim removed elements at the end, so that appending remains possible
+    
+    while( (sorted.empty() == false) && (erased.back() != u8(0)) )
+      {
+      sorted.pop_back();
+      erased.pop_back();
+      --n_erased;
+      }
+    
+    if(flush_due())  { flush(); }
+    }
+  else
+    {
+    erase_table( uword(it - table.data()) );
+    }
+  }
+
+
+
+template<typename eT>
+inline
+void
+MapMat_hash<eT>::erase(const uword key)
+  {
+  (*this).erase( (*this).find(key) );
+  }
+
+
+
+template<typename eT>
+arma_inline
+uword
+MapMat_hash<eT>::empty_key()
+  {
+  return (std::numeric_limits<uword>::max)();
+  }
+
+
+
+//! Fibonacci hashing: the top bits of the product form the slot
+template<typename eT>
+arma_inline
+uword
+MapMat_hash<eT>::slot(const uword key) const
+  {
+  return uword( (u64(key) * u64(0x9E3779B97F4A7C15ULL)) >> table_shift );
+  }
+
+
+
+template<typename eT>
+inline
+const typename MapMat_hash<eT>::value_type*
+MapMat_hash<eT>::find_ptr(const uword key) const
+  {
+  const uword table_pos = find_table(key);
+  
+  if(table_pos < uword(table.size()))  { return &(table[table_pos]); }
+  
+  const uword sorted_pos = find_sorted(key);
+  
+  if( (sorted_pos < uword(sorted.size())) && (erased[sorted_pos] == u8(0)) )  { return &(sorted[sorted_pos]); }
+  
+  return nullptr;
+  }
+
+
+
+template<typename eT>
+inline
+uword
+MapMat_hash<eT>::find_sorted(const uword key) const
+  {
+  const uword N = uword(sorted.size());
+  
+  if( (N == 0) || (key > sorted.back().first) )  { return N; }
+  
+  const auto comparator = [](const value_type& a, const uword b) { return (a.first < b); };
+  
+  typename std::vector<value_type>::const_iterator it = std::lower_bound(sorted.begin(), sorted.end(), key, comparator);
+  
+  return ( (it != sorted.end()) && ((*it).first == key) ) ? uword(it - sorted.begin()) : N;
+  }
+
+
+
+template<typename eT>
+inline
+uword
+MapMat_hash<eT>::find_table(const uword key) const
+  {
+  const uword N = uword(table.size());
+  
+  if(n_table == 0)  { return N; }
+  
+  const uword mask = N - 1;
+  
+  uword pos = slot(key);
+  
+  while(true)
+    {
+    const uword table_key = table[pos].first;
+    
+    if(table_key == key        )  { return pos; }
+    if(table_key == empty_key())  { return N;   }
+    
+    pos = (pos + 1) & mask;
+    }
+  }
+
+
+
+//! the key must not already be present
+template<typename eT>
+inline
+typename MapMat_hash<eT>::value_type&
+MapMat_hash<eT>::insert_table(const uword key)
+  {
+  // the key is in neither the hash table nor the sorted array, so merging first doesn't affect the insertion
+  if(flush_due())  { flush(); }
+  
+  // keep the load factor at or below 1/2
+  if( (2 * (n_table + 1)) > uword(table.size()) )  { grow_table(); }
+  
+  const uword mask = uword(table.size()) - 1;
+  
+  uword pos = slot(key);
+  
+  while(table[pos].first != empty_key())  { pos = (pos + 1) & mask; }
+  
+  table[pos] = value_type(key, eT(0));
+  
+  ++n_table;
+  
+  return table[pos];
+  }
+
+
+
+//! backward shift deletion, which avoids the need for tombstones
+template<typename eT>
+inline
+void
+MapMat_hash<eT>::erase_table(uword pos)
+  {
+  const uword mask = uword(table.size()) - 1;
+  
+  uword next = (pos + 1) & mask;
+  
+  while(table[next].first != empty_key())
+    {
+    const uword home = slot(table[next].first);
+    
+    // the element at 'next' can fill the hole at 'pos' only if its home slot is not cyclically within (pos, next]
+    
+    const bool stays = (pos <= next) ? ( (pos < home) && (home <= next) ) : ( (pos < home) || (home <= next) );
+    
+    if(stays == false)
+      {
+      table[pos] = table[next];
+      
+      pos = next;
+      }
+    
+    next = (next + 1) & mask;
+    }
+  
+  table[pos].first = empty_key();
+  
+  --n_table;
+  }
+
+
+
+template<typename eT>
+inline
+void
+MapMat_hash<eT>::grow_table()
+  {
+  arma_debug_sigprint();
+  
+  const uword new_size = (table.empty()) ? uword(64) : uword(2 * table.size());
+  
+  uword n_bits = 0;
+  
+  while( (uword(1) << n_bits) < new_size )  { ++n_bits; }
+  
+  std::vector<value_type> old_table( new_size, value_type(empty_key(), eT(0)) );
+  
+  old_table.swap(table);
+  
+  table_shift = uword(64) - n_bits;
+  
+  const uword mask = new_size - 1;
+  
+  for(uword i=0; i < old_table.size(); ++i)
+    {
+    const value_type& entry = old_table[i];
+    
+    if(entry.first == empty_key())  { continue; }
+    
+    uword pos = slot(entry.first);
+    
+    while(table[pos].first != empty_key())  { pos = (pos + 1) & mask; }
+    
+    table[pos] = entry;
+    }
+  }
+
+
+
+//! the ordered traversal via begin() const copies and sorts the hash table and skips removed elements,
+//! so the writers merge them into the sorted array once they amount to a fraction of it;
+//! the cost of merging is then amortised over the insertions and removals
+template<typename eT>
+inline
+bool
+MapMat_hash<eT>::flush_due() const
+  {
+  return ( (n_table + n_erased) >= (std::max)( uword(flush_min), uword(sorted.size() / flush_fraction) ) );
+  }
+
+
+
+//! sort the elements in the hash table and merge them into the sorted array, discarding removed elements
+template<typename eT>
+inline
+void
+MapMat_hash<eT>::flush()
+  {
+  arma_debug_sigprint();
+  
+  if( (n_table == 0) && (n_erased == 0) )  { return; }
+  
+  if(n_erased > 0)
+    {
+    uword count = 0;
+    
+    for(uword i=0; i < sorted.size(); ++i)
+      {
+      if(erased[i] == u8(0))  { sorted[count] = sorted[i];  ++count; }
+      }
+    
+    sorted.resize(count);
+    }
+  
+  if(n_table > 0)
+    {
+    uword count = 0;
+    
+    for(uword i=0; i < table.size(); ++i)
+      {
+      if(table[i].first != empty_key())  { table[count] = table[i];  ++count; }
+      }
+    
+    const auto comparator = [](const value_type& a, const value_type& b) { return (a.first < b.first); };
+    
+    std::sort(table.begin(), table.begin() + count, comparator);
+    
+    // merge from the back, so that no additional storage is required
+    
+    uword i = uword(sorted.size());
+    uword j = count;
+    uword k = i + j;
+    
+    sorted.resize(k);
+    
+    while(j > 0)
+      {
+      if( (i > 0) && (sorted[i-1].first > table[j-1].first) )
+        {
+        --i; --k;  sorted[k] = sorted[i];
+        }
+      else
+        {
+        --j; --k;  sorted[k] = table[j];
+        }
+      }
+    }
+  
+  erased.assign(sorted.size(), u8(0));
+  
+  std::vector<value_type>().swap(table);
+  
+  n_erased    = 0;
+  n_table     = 0;
+  table_shift = 0;
+  }
+
+
+
+//! @}
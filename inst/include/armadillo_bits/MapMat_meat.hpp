@@ -426,7 +426,7 @@ inline
 eT
 MapMat<eT>::operator[](const uword index) const
   {
-  map_type& map_ref = (*map_ptr);
+  const map_type& map_ref = (*map_ptr);
   
   typename map_type::const_iterator it     = map_ref.find(index);
   typename map_type::const_iterator it_end = map_ref.end();
@@ -455,7 +455,7 @@ MapMat<eT>::operator()(const uword index) const
   {
   arma_conform_check_bounds( (index >= n_elem), "MapMat::operator(): index out of bounds" );
   
-  map_type& map_ref = (*map_ptr);
+  const map_type& map_ref = (*map_ptr);
   
   typename map_type::const_iterator it     = map_ref.find(index);
   typename map_type::const_iterator it_end = map_ref.end();
@@ -484,7 +484,7 @@ MapMat<eT>::at(const uword in_row, const uword in_col) const
   {
   const uword index = (n_rows * in_col) + in_row;
   
-  map_type& map_ref = (*map_ptr);
+  const map_type& map_ref = (*map_ptr);
   
   typename map_type::const_iterator it     = map_ref.find(index);
   typename map_type::const_iterator it_end = map_ref.end();
@@ -517,7 +517,7 @@ MapMat<eT>::operator()(const uword in_row, const uword in_col) const
   
   const uword index = (n_rows * in_col) + in_row;
   
-  map_type& map_ref = (*map_ptr);
+  const map_type& map_ref = (*map_ptr);
   
   typename map_type::const_iterator it     = map_ref.find(index);
   typename map_type::const_iterator it_end = map_ref.end();
@@ -626,7 +626,7 @@ MapMat<eT>::print(const std::string& extra_text) const
     get_cout_stream().width(orig_width);
     }
   
-  map_type& map_ref = (*map_ptr);
+  const map_type& map_ref = (*map_ptr);
   
   const uword n_nonzero = uword(map_ref.size());
   
@@ -681,7 +681,7 @@ MapMat<eT>::get_locval_format(umat& locs, Col<eT>& vals) const
   {
   arma_debug_sigprint();
   
-  map_type& map_ref = (*map_ptr);
+  const map_type& map_ref = (*map_ptr);
   
   typename map_type::const_iterator it = map_ref.begin();
   
@@ -796,14 +796,23 @@ MapMat<eT>::set_val(const uword index, const eT& in_val)
     {
     map_type& map_ref = (*map_ptr);
     
-    if( (map_ref.empty() == false) && (index > uword(map_ref.crbegin()->first)) )
+    #if defined(ARMA_OPTIMISE_SPCACHE)
       {
-      map_ref.emplace_hint(map_ref.cend(), index, in_val);
+      // MapMat_hash appends to its sorted array when possible
+      map_ref.operator[](index) = in_val;
       }
-    else
+    #else
       {
-      map_ref.operator[](index) = in_val;
+      if( (map_ref.empty() == false) && (index > uword(map_ref.crbegin()->first)) )
+        {
+        map_ref.emplace_hint(map_ref.cend(), index, in_val);
+        }
+      else
+        {
+        map_ref.operator[](index) = in_val;
+        }
       }
+    #endif
     }
   else
     {
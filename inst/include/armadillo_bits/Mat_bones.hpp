@@ -303,6 +303,12 @@ class Mat : public Base< eT, Mat<eT> >
   inline       Mat& each_row(const std::function< void(      Row<eT>&) >& F);
   inline const Mat& each_row(const std::function< void(const Row<eT>&) >& F) const;
   
+  inline       Mat& each_col(const std::function< void(      Col<eT>&) >& F, const bool use_mp);
+  inline const Mat& each_col(const std::function< void(const Col<eT>&) >& F, const bool use_mp) const;
+  
+  inline       Mat& each_row(const std::function< void(      Row<eT>&) >& F, const bool use_mp);
+  inline const Mat& each_row(const std::function< void(const Row<eT>&) >& F, const bool use_mp) const;
+  
   
   arma_inline       diagview<eT> diag(const sword in_id = 0);
   arma_inline const diagview<eT> diag(const sword in_id = 0) const;
@@ -4505,6 +4505,86 @@ Mat<eT>::each_row(const std::function< void(const Row<eT>&) >& F) const
 
 
 
+//! apply a lambda function to each column in parallel (when use_mp is true and OpenMP is enabled);
+//! F must be safe to call concurrently from several threads
+template<typename eT>
+inline
+Mat<eT>&
+Mat<eT>::each_col(const std::function< void(Col<eT>&) >& F, const bool use_mp)
+  {
+  arma_debug_sigprint();
+  
+  if((use_mp == false) || (arma_config::openmp == false) || (mp_thread_limit::in_parallel()))
+    {
+    return (*this).each_col(F);
+    }
+  
+  subview_each_mp::each_col_lambda(*this, F);
+  
+  return *this;
+  }
+
+
+
+template<typename eT>
+inline
+const Mat<eT>&
+Mat<eT>::each_col(const std::function< void(const Col<eT>&) >& F, const bool use_mp) const
+  {
+  arma_debug_sigprint();
+  
+  if((use_mp == false) || (arma_config::openmp == false) || (mp_thread_limit::in_parallel()))
+    {
+    return (*this).each_col(F);
+    }
+  
+  subview_each_mp::each_col_lambda(*this, F);
+  
+  return *this;
+  }
+
+
+
+//! apply a lambda function to each row in parallel (when use_mp is true and OpenMP is enabled);
+//! rows are processed in blocks, each thread working on its own copies of the rows
+template<typename eT>
+inline
+Mat<eT>&
+Mat<eT>::each_row(const std::function< void(Row<eT>&) >& F, const bool use_mp)
+  {
+  arma_debug_sigprint();
+  
+  if((use_mp == false) || (arma_config::openmp == false) || (mp_thread_limit::in_parallel()))
+    {
+    return (*this).each_row(F);
+    }
+  
+  subview_each_mp::each_row_lambda(*this, F, true);
+  
+  return *this;
+  }
+
+
+
+template<typename eT>
+inline
+const Mat<eT>&
+Mat<eT>::each_row(const std::function< void(const Row<eT>&) >& F, const bool use_mp) const
+  {
+  arma_debug_sigprint();
+  
+  if((use_mp == false) || (arma_config::openmp == false) || (mp_thread_limit::in_parallel()))
+    {
+    return (*this).each_row(F);
+    }
+  
+  subview_each_mp::each_row_lambda(*this, F, false);
+  
+  return *this;
+  }
+
+
+
 //! creation of diagview (diagonal)
 template<typename eT>
 arma_inline
@@ -8436,6 +8516,10 @@ Mat<eT>::save(const std::string name, const file_type type) const
       save_okay = diskio::save_arma_binary(*this, name);
       break;
     
+    case arma_zbinary:
+      save_okay = diskio::save_arma_zbinary(*this, name);
+      break;
+    
     case pgm_binary:
       save_okay = diskio::save_pgm_binary(*this, name);
       break;
@@ -8634,6 +8718,10 @@ Mat<eT>::save(std::ostream& os, const file_type type) const
       save_okay = diskio::save_arma_binary(*this, os);
       break;
     
+    case arma_zbinary:
+      save_okay = diskio::save_arma_zbinary(*this, os);
+      break;
+    
     case pgm_binary:
       save_okay = diskio::save_pgm_binary(*this, os);
       break;
@@ -8695,6 +8783,10 @@ Mat<eT>::load(const std::string name, const file_type type)
       load_okay = diskio::load_arma_binary(*this, name, err_msg);
       break;
     
+    case arma_zbinary:
+      load_okay = diskio::load_arma_zbinary(*this, name, err_msg);
+      break;
+    
     case pgm_binary:
       load_okay = diskio::load_pgm_binary(*this, name, err_msg);
       break;
@@ -8914,6 +9006,10 @@ Mat<eT>::load(std::istream& is, const file_type type)
       load_okay = diskio::load_arma_binary(*this, is, err_msg);
       break;
     
+    case arma_zbinary:
+      load_okay = diskio::load_arma_zbinary(*this, is, err_msg);
+      break;
+    
     case pgm_binary:
       load_okay = diskio::load_pgm_binary(*this, is, err_msg);
       break;
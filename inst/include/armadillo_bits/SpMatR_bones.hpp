@@ -0,0 +1,93 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2026 Dirk Eddelbuettel
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// https://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+
+//! \addtogroup SpMatR
+//! @{
+
+
+
+//! Sparse matrix stored in compressed sparse row (CSR) format.
+//! Internally the storage is a column-major SpMat holding the transpose:
+//! its column pointers, row indices and values are the row pointers, column indices and values of the CSR matrix.
+//! Conversion from and to SpMat via st() therefore does not require any reordering of elements.
+template<typename eT>
+class SpMatR
+  {
+  public:
+  
+  typedef eT                                elem_type;  //!< the type of elements stored in the matrix
+  typedef typename get_pod_type<eT>::result  pod_type;  //!< if eT is std::complex<T>, pod_type is T; otherwise pod_type is eT
+  
+  const uword n_rows;     //!< number of rows     (read-only)
+  const uword n_cols;     //!< number of columns  (read-only)
+  const uword n_elem;     //!< number of elements (read-only)
+  const uword n_nonzero;  //!< number of nonzero elements (read-only)
+  
+  const eT*    const values;       //!< nonzero values, ordered by row and then by column (read-only)
+  const uword* const col_indices;  //!< column index of each nonzero value (read-only)
+  const uword* const row_ptrs;     //!< start of each row within values and col_indices; has n_rows+1 elements (read-only)
+  
+  inline ~SpMatR();
+  inline  SpMatR();
+  
+  inline explicit SpMatR(const uword in_n_rows, const uword in_n_cols);
+  inline explicit SpMatR(const SizeMat& s);
+  
+  inline            SpMatR(const SpMatR& x);
+  inline SpMatR& operator=(const SpMatR& x);
+  
+  inline            SpMatR(SpMatR&& x);
+  inline SpMatR& operator=(SpMatR&& x);
+  
+  template<typename T1> inline explicit SpMatR(const SpBase<eT,T1>& expr);
+  template<typename T1> inline SpMatR& operator=(const SpBase<eT,T1>& expr);
+  
+  template<typename T1> inline explicit SpMatR(const SpOp<T1,spop_strans>& expr);
+  template<typename T1> inline SpMatR& operator=(const SpOp<T1,spop_strans>& expr);
+  
+  template<typename T1, typename T2, typename T3>
+  inline SpMatR(const Base<uword,T1>& colind_expr, const Base<uword,T2>& rowptr_expr, const Base<eT,T3>& values_expr, const uword in_n_rows, const uword in_n_cols, const bool check_for_zeros = true);
+  
+  arma_warn_unused inline const SpMat<eT>& st()  const;
+  arma_warn_unused inline       SpMat<eT>  csc() const;
+  
+  arma_warn_unused inline eT operator()(const uword in_row, const uword in_col) const;
+  arma_warn_unused inline eT         at(const uword in_row, const uword in_col) const;
+  
+  arma_warn_unused inline SpRow<eT>  row (const uword row_num) const;
+  arma_warn_unused inline SpMatR<eT> rows(const uword in_row1, const uword in_row2) const;
+  
+  inline void zeros(const uword in_n_rows, const uword in_n_cols);
+  inline void reset();
+  
+  arma_warn_unused inline bool is_empty()  const;
+  arma_warn_unused inline bool is_square() const;
+  
+  inline void print(const std::string& extra_text = "") const;
+  
+  
+  private:
+  
+  SpMat<eT> Xt;  //!< transpose of the matrix, in CSC format
+  
+  inline void update_aliases();
+  };
+
+
+
+//! @}
@@ -0,0 +1,451 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2026 Dirk Eddelbuettel
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// https://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+
+//! \addtogroup SpMatR
+//! @{
+
+
+
+template<typename eT>
+inline
+SpMatR<eT>::~SpMatR()
+  {
+  arma_debug_sigprint_this(this);
+  }
+
+
+
+template<typename eT>
+inline
+SpMatR<eT>::SpMatR()
+  : n_rows(0)
+  , n_cols(0)
+  , n_elem(0)
+  , n_nonzero(0)
+  , values(nullptr)
+  , col_indices(nullptr)
+  , row_ptrs(nullptr)
+  {
+  arma_debug_sigprint_this(this);
+  
+  update_aliases();
+  }
+
+
+
+template<typename eT>
+inline
+SpMatR<eT>::SpMatR(const uword in_n_rows, const uword in_n_cols)
+  : n_rows(0)
+  , n_cols(0)
+  , n_elem(0)
+  , n_nonzero(0)
+  , values(nullptr)
+  , col_indices(nullptr)
+  , row_ptrs(nullptr)
+  , Xt(in_n_cols, in_n_rows)
+  {
+  arma_debug_sigprint_this(this);
+  
+  update_aliases();
+  }
+
+
+
+template<typename eT>
+inline
+SpMatR<eT>::SpMatR(const SizeMat& s)
+  : n_rows(0)
+  , n_cols(0)
+  , n_elem(0)
+  , n_nonzero(0)
+  , values(nullptr)
+  , col_indices(nullptr)
+  , row_ptrs(nullptr)
+  , Xt(s.n_cols, s.n_rows)
+  {
+  arma_debug_sigprint_this(this);
+  
+  update_aliases();
+  }
+
+
+
+template<typename eT>
+inline
+SpMatR<eT>::SpMatR(const SpMatR<eT>& x)
+  : n_rows(0)
+  , n_cols(0)
+  , n_elem(0)
+  , n_nonzero(0)
+  , values(nullptr)
+  , col_indices(nullptr)
+  , row_ptrs(nullptr)
+  , Xt(x.Xt)
+  {
+  arma_debug_sigprint_this(this);
+  
+  update_aliases();
+  }
+
+
+
+template<typename eT>
+inline
+SpMatR<eT>&
+SpMatR<eT>::operator=(const SpMatR<eT>& x)
+  {
+  arma_debug_sigprint();
+  
+  Xt = x.Xt;
+  
+  update_aliases();
+  
+  return *this;
+  }
+
+
+
+template<typename eT>
+inline
+SpMatR<eT>::SpMatR(SpMatR<eT>&& x)
+  : n_rows(0)
+  , n_cols(0)
+  , n_elem(0)
+  , n_nonzero(0)
+  , values(nullptr)
+  , col_indices(nullptr)
+  , row_ptrs(nullptr)
+  , Xt(std::move(x.Xt))
+  {
+  arma_debug_sigprint_this(this);
+  
+  update_aliases();
+  
+  x.update_aliases();
+  }
+
+
+
+template<typename eT>
+inline
+SpMatR<eT>&
+SpMatR<eT>::operator=(SpMatR<eT>&& x)
+  {
+  arma_debug_sigprint();
+  
+  Xt = std::move(x.Xt);
+  
+  update_aliases();
+  
+  x.update_aliases();
+  
+  return *this;
+  }
+
+
+
+//! conversion from a column-major sparse matrix or expression
+template<typename eT>
+template<typename T1>
+inline
+SpMatR<eT>::SpMatR(const SpBase<eT,T1>& expr)
+  : n_rows(0)
+  , n_cols(0)
+  , n_elem(0)
+  , n_nonzero(0)
+  , values(nullptr)
+  , col_indices(nullptr)
+  , row_ptrs(nullptr)
+  {
+  arma_debug_sigprint_this(this);
+  
+  (*this).operator=(expr);
+  }
+
+
+
+template<typename eT>
+template<typename T1>
+inline
+SpMatR<eT>&
+SpMatR<eT>::operator=(const SpBase<eT,T1>& expr)
+  {
+  arma_debug_sigprint();
+  
+  Xt = strans(expr.get_ref());
+  
+  update_aliases();
+  
+  return *this;
+  }
+
+
+
+//! the CSR form of X.st() has the same layout as the CSC form of X, so no reordering is required
+template<typename eT>
+template<typename T1>
+inline
+SpMatR<eT>::SpMatR(const SpOp<T1,spop_strans>& expr)
+  : n_rows(0)
+  , n_cols(0)
+  , n_elem(0)
+  , n_nonzero(0)
+  , values(nullptr)
+  , col_indices(nullptr)
+  , row_ptrs(nullptr)
+  {
+  arma_debug_sigprint_this(this);
+  
+  (*this).operator=(expr);
+  }
+
+
+
+template<typename eT>
+template<typename T1>
+inline
+SpMatR<eT>&
+SpMatR<eT>::operator=(const SpOp<T1,spop_strans>& expr)
+  {
+  arma_debug_sigprint();
+  
+  Xt = expr.m;
+  
+  update_aliases();
+  
+  return *this;
+  }
+
+
+
+//! construct from CSR arrays: column indices, row pointers and values
+template<typename eT>
+template<typename T1, typename T2, typename T3>
+inline
+SpMatR<eT>::SpMatR(const Base<uword,T1>& colind_expr, const Base<uword,T2>& rowptr_expr, const Base<eT,T3>& values_expr, const uword in_n_rows, const uword in_n_cols, const bool check_for_zeros)
+  : n_rows(0)
+  , n_cols(0)
+  , n_elem(0)
+  , n_nonzero(0)
+  , values(nullptr)
+  , col_indices(nullptr)
+  , row_ptrs(nullptr)
+  , Xt(colind_expr, rowptr_expr, values_expr, in_n_cols, in_n_rows, check_for_zeros)
+  {
+  arma_debug_sigprint_this(this);
+  
+  update_aliases();
+  }
+
+
+
+//! transpose in column-major format; this is the underlying storage, so no copy is made
+template<typename eT>
+inline
+const SpMat<eT>&
+SpMatR<eT>::st() const
+  {
+  return Xt;
+  }
+
+
+
+//! conversion to column-major format
+template<typename eT>
+inline
+SpMat<eT>
+SpMatR<eT>::csc() const
+  {
+  arma_debug_sigprint();
+  
+  return SpMat<eT>(Xt.st());
+  }
+
+
+
+template<typename eT>
+inline
+eT
+SpMatR<eT>::operator()(const uword in_row, const uword in_col) const
+  {
+  arma_conform_check_bounds( ((in_row >= n_rows) || (in_col >= n_cols)), "SpMatR::operator(): index out of bounds" );
+  
+  return (*this).at(in_row, in_col);
+  }
+
+
+
+template<typename eT>
+inline
+eT
+SpMatR<eT>::at(const uword in_row, const uword in_col) const
+  {
+  const uword* start = &(col_indices[ row_ptrs[in_row    ] ]);
+  const uword* end   = &(col_indices[ row_ptrs[in_row + 1] ]);
+  
+  const uword* pos = std::lower_bound(start, end, in_col);
+  
+  return ( (pos != end) && ((*pos) == in_col) ) ? values[ row_ptrs[in_row] + uword(pos - start) ] : eT(0);
+  }
+
+
+
+//! extract one row; only the elements of the row are visited
+template<typename eT>
+inline
+SpRow<eT>
+SpMatR<eT>::row(const uword row_num) const
+  {
+  arma_debug_sigprint();
+  
+  arma_conform_check_bounds( (row_num >= n_rows), "SpMatR::row(): index out of bounds" );
+  
+  const uword start = row_ptrs[row_num    ];
+  const uword count = row_ptrs[row_num + 1] - start;
+  
+  SpRow<eT> out(n_cols);
+  
+  if(count == 0)  { return out; }
+  
+  out.mem_resize(count);
+  
+  uword* out_col_ptrs    = access::rwp(out.col_ptrs);
+  uword* out_row_indices = access::rwp(out.row_indices);
+  eT*    out_values      = access::rwp(out.values);
+  
+  for(uword i=0; i < count; ++i)
+    {
+    out_values[i]      = values[start + i];
+    out_row_indices[i] = 0;
+    
+    ++(out_col_ptrs[ col_indices[start + i] + 1 ]);
+    }
+  
+  for(uword col=0; col < n_cols; ++col)  { out_col_ptrs[col + 1] += out_col_ptrs[col]; }
+  
+  return out;
+  }
+
+
+
+//! extract a contiguous set of rows, which is a contiguous part of the CSR arrays
+template<typename eT>
+inline
+SpMatR<eT>
+SpMatR<eT>::rows(const uword in_row1, const uword in_row2) const
+  {
+  arma_debug_sigprint();
+  
+  arma_conform_check_bounds
+    (
+    (in_row1 > in_row2) || (in_row2 >= n_rows),
+    "SpMatR::rows(): indices out of bounds or incorrectly used"
+    );
+  
+  SpMatR<eT> out;
+  
+  out.Xt = Xt.cols(in_row1, in_row2);
+  
+  out.update_aliases();
+  
+  return out;
+  }
+
+
+
+template<typename eT>
+inline
+void
+SpMatR<eT>::zeros(const uword in_n_rows, const uword in_n_cols)
+  {
+  arma_debug_sigprint();
+  
+  Xt.zeros(in_n_cols, in_n_rows);
+  
+  update_aliases();
+  }
+
+
+
+template<typename eT>
+inline
+void
+SpMatR<eT>::reset()
+  {
+  arma_debug_sigprint();
+  
+  Xt.reset();
+  
+  update_aliases();
+  }
+
+
+
+template<typename eT>
+inline
+bool
+SpMatR<eT>::is_empty() const
+  {
+  return (n_elem == 0);
+  }
+
+
+
+template<typename eT>
+inline
+bool
+SpMatR<eT>::is_square() const
+  {
+  return (n_rows == n_cols);
+  }
+
+
+
+template<typename eT>
+inline
+void
+SpMatR<eT>::print(const std::string& extra_text) const
+  {
+  arma_debug_sigprint();
+  
+  (*this).csc().print(extra_text);
+  }
+
+
+
+template<typename eT>
+inline
+void
+SpMatR<eT>::update_aliases()
+  {
+  Xt.sync();
+  
+  access::rw(n_rows)    = Xt.n_cols;
+  access::rw(n_cols)    = Xt.n_rows;
+  access::rw(n_elem)    = Xt.n_elem;
+  access::rw(n_nonzero) = Xt.n_nonzero;
+  
+  access::rw(values)      = Xt.values;
+  access::rw(col_indices) = Xt.row_indices;
+  access::rw(row_ptrs)    = Xt.col_ptrs;
+  }
+
+
+
+//! @}
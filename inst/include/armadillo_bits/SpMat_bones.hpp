@@ -112,6 +112,9 @@ class SpMat : public SpBase< eT, SpMat<eT> >
   template<typename T1, typename T2>
   inline SpMat(const bool add_values, const Base<uword,T1>& locations, const Base<eT,T2>& values, const uword n_rows, const uword n_cols, const bool sort_locations = true, const bool check_for_zeros = true);
   
+  template<typename T1, typename T2, typename T3>
+  inline SpMat(const bool add_values, const Base<uword,T1>& rowind, const Base<uword,T2>& colind, const Base<eT,T3>& values, const uword n_rows, const uword n_cols, const bool check_for_zeros = true);
+  
   inline SpMat& operator= (const eT val); //! sets size to 1x1
   inline SpMat& operator*=(const eT val);
   inline SpMat& operator/=(const eT val);
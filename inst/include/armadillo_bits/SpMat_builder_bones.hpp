@@ -0,0 +1,109 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2026 Dirk Eddelbuettel
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// https://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+
+//! \addtogroup SpMat_builder
+//! @{
+
+
+
+//! Collects (row, column, value) triplets and assembles them into a sparse matrix in CSC format.
+//! Each OpenMP thread appends to its own buffer, so append() can be called from within a parallel region without locking.
+//! Appends from threads without a buffer of their own (eg. threads beyond the number of buffers, or threads in nested
+//! parallel regions, where thread numbers are not unique) go to a shared overflow buffer, which is protected by a lock.
+//! Triplets are stored in fixed-size blocks, which are released as soon as they have been scattered into the matrix.
+template<typename eT>
+class SpMat_builder
+  {
+  public:
+  
+  typedef eT                                elem_type;  //!< the type of elements stored in the matrix
+  typedef typename get_pod_type<eT>::result  pod_type;  //!< if eT is std::complex<T>, pod_type is T; otherwise pod_type is eT
+  
+  const uword n_rows;
+  const uword n_cols;
+  
+  inline ~SpMat_builder();
+  inline  SpMat_builder(const uword in_n_rows, const uword in_n_cols, const uword in_n_buffers = 0);
+  
+  SpMat_builder(const SpMat_builder&)            = delete;
+  SpMat_builder& operator=(const SpMat_builder&) = delete;
+  
+  inline void append(                        const uword in_row, const uword in_col, const eT in_val);
+  inline void append(const uword buffer_id,  const uword in_row, const uword in_col, const eT in_val);
+  
+  template<typename T1, typename T2, typename T3>
+  inline void append(const Base<uword,T1>& rowind_expr, const Base<uword,T2>& colind_expr, const Base<eT,T3>& vals_expr);
+  
+  inline void reserve(const uword n_per_buffer);
+  
+  arma_warn_unused inline uword n_buffers()  const;
+  arma_warn_unused inline uword n_triplets() const;
+  
+  inline void reset();
+  
+  inline void finalise(SpMat<eT>& out, const bool add_values = true, const bool check_for_zeros = true);
+  
+  
+  //! don't use this unless you're writing internal Armadillo code
+  struct segment
+    {
+    const uword* rows;
+    const uword* cols;
+    const eT*    vals;
+          uword  count;
+          uword  stride;  // stride of rows and cols
+          bool   owned;   // release memory after scattering
+    };
+  
+  //! don't use this unless you're writing internal Armadillo code
+  inline static void assemble(SpMat<eT>& out, const uword in_n_rows, const uword in_n_cols, std::vector<segment>& segs, const bool add_values, const bool check_for_zeros, const char* caller);
+  
+  //! don't use this unless you're writing internal Armadillo code
+  inline static void split(std::vector<segment>& segs, const uword* rows, const uword* cols, const eT* vals, const uword count, const uword stride);
+  
+  
+  private:
+  
+  struct block
+    {
+    uword* rows;
+    uword* cols;
+    eT*    vals;
+    uword  count;
+    uword  capacity;
+    };
+  
+  std::vector< std::vector<block> > buffers;  //!< one buffer per thread, followed by the shared overflow buffer
+  
+  inline uword thread_buffer_id() const;
+  
+  inline void append_triplet(const uword buffer_id, const uword in_row, const uword in_col, const eT in_val);
+  
+  inline void append_triplets(const uword buffer_id, const uword* rows, const uword* cols, const eT* vals, const uword N);
+  
+  inline block& get_block(const uword buffer_id, const uword n_needed);
+  
+  inline static void release(block& b);
+  inline static void release(segment& s);
+  
+  inline static void sort_column(uword* rows, eT* vals, const uword n, std::vector< std::pair<uword,eT> >& scratch);
+  };
+
+
+
+//! @}
@@ -0,0 +1,758 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2026 Dirk Eddelbuettel
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// https://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+
+//! \addtogroup SpMat_builder
+//! @{
+
+
+
+template<typename eT>
+inline
+SpMat_builder<eT>::~SpMat_builder()
+  {
+  arma_debug_sigprint_this(this);
+  
+  reset();
+  }
+
+
+
+template<typename eT>
+inline
+SpMat_builder<eT>::SpMat_builder(const uword in_n_rows, const uword in_n_cols, const uword in_n_buffers)
+  : n_rows(in_n_rows)
+  , n_cols(in_n_cols)
+  {
+  arma_debug_sigprint_this(this);
+  
+  uword local_n_buffers = in_n_buffers;
+  
+  if(local_n_buffers == 0)
+    {
+    #if defined(ARMA_USE_OPENMP)
+      {
+      local_n_buffers = uword( (std::max)(int(1), int(omp_get_max_threads())) );
+      }
+    #else
+      {
+      local_n_buffers = 1;
+      }
+    #endif
+    }
+  
+  buffers.resize(local_n_buffers + 1);
+  }
+
+
+
+//! append one triplet to the buffer owned by the calling thread
+template<typename eT>
+inline
+void
+SpMat_builder<eT>::append(const uword in_row, const uword in_col, const eT in_val)
+  {
+  (*this).append_triplet(thread_buffer_id(), in_row, in_col, in_val);
+  }
+
+
+
+//! append one triplet to the given buffer;
+//! concurrent calls are safe as long as each thread uses a distinct buffer_id;
+//! buffer_id values beyond n_buffers() use the shared overflow buffer
+template<typename eT>
+inline
+void
+SpMat_builder<eT>::append(const uword buffer_id, const uword in_row, const uword in_col, const eT in_val)
+  {
+  (*this).append_triplet( (std::min)(buffer_id, n_buffers()), in_row, in_col, in_val );
+  }
+
+
+
+//! append triplets given as separate vectors of row indices, column indices and values
+template<typename eT>
+template<typename T1, typename T2, typename T3>
+inline
+void
+SpMat_builder<eT>::append(const Base<uword,T1>& rowind_expr, const Base<uword,T2>& colind_expr, const Base<eT,T3>& vals_expr)
+  {
+  arma_debug_sigprint();
+  
+  const quasi_unwrap<T1> rowind_tmp( rowind_expr.get_ref() );
+  const quasi_unwrap<T2> colind_tmp( colind_expr.get_ref() );
+  const quasi_unwrap<T3>   vals_tmp(   vals_expr.get_ref() );
+  
+  const Mat<uword>& rowind = rowind_tmp.M;
+  const Mat<uword>& colind = colind_tmp.M;
+  const Mat<eT>&    vals   =   vals_tmp.M;
+  
+  arma_conform_check( ( (rowind.n_elem != vals.n_elem) || (colind.n_elem != vals.n_elem) ), "SpMat_builder::append(): number of indices is different than number of values" );
+  
+  (*this).append_triplets(thread_buffer_id(), rowind.memptr(), colind.memptr(), vals.memptr(), vals.n_elem);
+  }
+
+
+
+//! pre-allocate space for the given number of triplets in each buffer
+template<typename eT>
+inline
+void
+SpMat_builder<eT>::reserve(const uword n_per_buffer)
+  {
+  arma_debug_sigprint();
+  
+  for(uword buffer_id=0; buffer_id < n_buffers(); ++buffer_id)
+    {
+    get_block(buffer_id, n_per_buffer);
+    }
+  }
+
+
+
+template<typename eT>
+inline
+uword
+SpMat_builder<eT>::n_buffers() const
+  {
+  return uword(buffers.size() - 1);
+  }
+
+
+
+template<typename eT>
+inline
+uword
+SpMat_builder<eT>::n_triplets() const
+  {
+  arma_debug_sigprint();
+  
+  uword count = 0;
+  
+  for(uword buffer_id=0; buffer_id < buffers.size(); ++buffer_id)
+    {
+    const std::vector<block>& blocks = buffers[buffer_id];
+    
+    for(uword j=0; j < blocks.size(); ++j)  { count += blocks[j].count; }
+    }
+  
+  return count;
+  }
+
+
+
+//! discard all triplets
+template<typename eT>
+inline
+void
+SpMat_builder<eT>::reset()
+  {
+  arma_debug_sigprint();
+  
+  for(uword buffer_id=0; buffer_id < buffers.size(); ++buffer_id)
+    {
+    std::vector<block>& blocks = buffers[buffer_id];
+    
+    for(uword j=0; j < blocks.size(); ++j)  { release(blocks[j]); }
+    
+    blocks.clear();
+    }
+  }
+
+
+
+//! assemble the collected triplets into a sparse matrix;
+//! triplets with identical locations are summed if add_values is true, otherwise they are treated as an error;
+//! the builder is empty afterwards
+template<typename eT>
+inline
+void
+SpMat_builder<eT>::finalise(SpMat<eT>& out, const bool add_values, const bool check_for_zeros)
+  {
+  arma_debug_sigprint();
+  
+  arma_conform_check( (mp_thread_limit::in_parallel()), "SpMat_builder::finalise(): must not be called from within a parallel region" );
+  
+  std::vector<segment> segs;
+  
+  for(uword buffer_id=0; buffer_id < buffers.size(); ++buffer_id)
+    {
+    std::vector<block>& blocks = buffers[buffer_id];
+    
+    for(uword j=0; j < blocks.size(); ++j)
+      {
+      const block& b = blocks[j];
+      
+      segment s;
+      
+      s.rows   = b.rows;
+      s.cols   = b.cols;
+      s.vals   = b.vals;
+      s.count  = b.count;
+      s.stride = 1;
+      s.owned  = true;
+      
+      segs.push_back(s);
+      }
+    
+    // ownership of the memory has been transferred to segs
+    blocks.clear();
+    }
+  
+  assemble(out, n_rows, n_cols, segs, add_values, check_for_zeros, "SpMat_builder::finalise()");
+  }
+
+
+
+//! buffer owned by the calling thread; the overflow buffer is used when the thread number is out of range,
+//! or within nested parallel regions, as thread numbers are then only unique within each team
+template<typename eT>
+inline
+uword
+SpMat_builder<eT>::thread_buffer_id() const
+  {
+  #if defined(ARMA_USE_OPENMP)
+    {
+    if(omp_get_level() > 1)  { return n_buffers(); }
+    
+    return (std::min)( uword(omp_get_thread_num()), n_buffers() );
+    }
+  #else
+    {
+    return 0;
+    }
+  #endif
+  }
+
+
+
+template<typename eT>
+inline
+void
+SpMat_builder<eT>::append_triplet(const uword buffer_id, const uword in_row, const uword in_col, const eT in_val)
+  {
+  const auto store = [&]()
+    {
+    block& b = get_block(buffer_id, 1);
+    
+    b.rows[b.count] = in_row;
+    b.cols[b.count] = in_col;
+    b.vals[b.count] = in_val;
+    
+    ++(b.count);
+    };
+  
+  if(buffer_id < n_buffers())
+    {
+    store();
+    }
+  else
+    {
+    #if defined(ARMA_USE_OPENMP)
+      {
+      #pragma omp critical (arma_SpMat_builder_overflow)
+        {
+        store();
+        }
+      }
+    #else
+      {
+      store();
+      }
+    #endif
+    }
+  }
+
+
+
+template<typename eT>
+inline
+void
+SpMat_builder<eT>::append_triplets(const uword buffer_id, const uword* rows, const uword* cols, const eT* vals, const uword N)
+  {
+  const auto store = [&]()
+    {
+    uword i = 0;
+    
+    while(i < N)
+      {
+      block& b = get_block(buffer_id, 1);
+      
+      const uword n_copy = (std::min)(b.capacity - b.count, N - i);
+      
+      arrayops::copy( &(b.rows[b.count]), &(rows[i]), n_copy );
+      arrayops::copy( &(b.cols[b.count]), &(cols[i]), n_copy );
+      arrayops::copy( &(b.vals[b.count]), &(vals[i]), n_copy );
+      
+      b.count += n_copy;
+      
+      i += n_copy;
+      }
+    };
+  
+  if(buffer_id < n_buffers())
+    {
+    store();
+    }
+  else
+    {
+    #if defined(ARMA_USE_OPENMP)
+      {
+      #pragma omp critical (arma_SpMat_builder_overflow)
+        {
+        store();
+        }
+      }
+    #else
+      {
+      store();
+      }
+    #endif
+    }
+  }
+
+
+
+template<typename eT>
+inline
+typename SpMat_builder<eT>::block&
+SpMat_builder<eT>::get_block(const uword buffer_id, const uword n_needed)
+  {
+  std::vector<block>& blocks = buffers[buffer_id];
+  
+  if( (blocks.empty() == false) && ((blocks.back().capacity - blocks.back().count) >= n_needed) )  { return blocks.back(); }
+  
+  // fixed-size blocks avoid the transient doubling of memory that occurs when a contiguous buffer is grown
+  
+  const uword capacity = (std::max)(n_needed, uword(65536));
+  
+  block b;
+  
+  b.rows     = memory::acquire<uword>(capacity);
+  b.cols     = memory::acquire<uword>(capacity);
+  b.vals     = memory::acquire<eT>   (capacity);
+  b.count    = 0;
+  b.capacity = capacity;
+  
+  blocks.push_back(b);
+  
+  return blocks.back();
+  }
+
+
+
+template<typename eT>
+inline
+void
+SpMat_builder<eT>::release(block& b)
+  {
+  if(b.rows)  { memory::release(b.rows); b.rows = nullptr; }
+  if(b.cols)  { memory::release(b.cols); b.cols = nullptr; }
+  if(b.vals)  { memory::release(b.vals); b.vals = nullptr; }
+  }
+
+
+
+template<typename eT>
+inline
+void
+SpMat_builder<eT>::release(segment& s)
+  {
+  if(s.owned == false)  { return; }
+  
+  if(s.rows)  { memory::release( const_cast<uword*>(s.rows) ); s.rows = nullptr; }
+  if(s.cols)  { memory::release( const_cast<uword*>(s.cols) ); s.cols = nullptr; }
+  if(s.vals)  { memory::release( const_cast<eT*   >(s.vals) ); s.vals = nullptr; }
+  }
+
+
+
+//! split an array of triplets into segments, so that the work can be distributed across threads
+template<typename eT>
+inline
+void
+SpMat_builder<eT>::split(std::vector<segment>& segs, const uword* rows, const uword* cols, const eT* vals, const uword count, const uword stride)
+  {
+  arma_debug_sigprint();
+  
+  const uword n_segs = (std::max)( uword(1), (std::min)( uword(8 * mp_thread_limit::get()), count / uword(4096) ) );
+  
+  for(uword k=0; k < n_segs; ++k)
+    {
+    const uword start = (count / n_segs) * k;
+    const uword end   = (k == (n_segs-1)) ? count : (count / n_segs) * (k+1);
+    
+    segment s;
+    
+    s.rows   = &(rows[start * stride]);
+    s.cols   = &(cols[start * stride]);
+    s.vals   = &(vals[start]);
+    s.count  = end - start;
+    s.stride = stride;
+    s.owned  = false;
+    
+    segs.push_back(s);
+    }
+  }
+
+
+
+template<typename eT>
+inline
+void
+SpMat_builder<eT>::sort_column(uword* rows, eT* vals, const uword n, std::vector< std::pair<uword,eT> >& scratch)
+  {
+  bool is_sorted = true;
+  
+  for(uword i=1; i < n; ++i)  { if(rows[i] < rows[i-1])  { is_sorted = false; break; } }
+  
+  if(is_sorted)  { return; }
+  
+  if(n <= 32)
+    {
+    for(uword i=1; i < n; ++i)
+      {
+      const uword row = rows[i];
+      const eT    val = vals[i];
+      
+      uword j = i;
+      
+      while( (j > 0) && (rows[j-1] > row) )  { rows[j] = rows[j-1]; vals[j] = vals[j-1]; --j; }
+      
+      rows[j] = row;
+      vals[j] = val;
+      }
+    
+    return;
+    }
+  
+  scratch.resize(n);
+  
+  for(uword i=0; i < n; ++i)  { scratch[i].first = rows[i]; scratch[i].second = vals[i]; }
+  
+  const auto comparator = [](const std::pair<uword,eT>& a, const std::pair<uword,eT>& b) { return (a.first < b.first); };
+  
+  std::sort(scratch.begin(), scratch.end(), comparator);
+  
+  for(uword i=0; i < n; ++i)  { rows[i] = scratch[i].first; vals[i] = scratch[i].second; }
+  }
+
+
+
+//! Assemble triplets into CSC format using a counting sort by column:
+//! each thread counts the elements per column in its share of the segments,
+//! the counts are turned into per-thread write offsets,
+//! and each thread then scatters its share directly into the final arrays.
+//! Finally, each column is sorted by row index and duplicates are combined.
+template<typename eT>
+inline
+void
+SpMat_builder<eT>::assemble(SpMat<eT>& out, const uword in_n_rows, const uword in_n_cols, std::vector<segment>& segs, const bool add_values, const bool check_for_zeros, const char* caller)
+  {
+  arma_debug_sigprint();
+  
+  // release owned segments on all exit paths, including exceptions
+  struct segment_guard
+    {
+    std::vector<segment>& segs;
+    
+    inline ~segment_guard()  { for(uword k=0; k < segs.size(); ++k)  { SpMat_builder<eT>::release(segs[k]); } }
+    };
+  
+  const segment_guard guard = { segs };
+  
+  const uword n_segs = uword(segs.size());
+  
+  uword total = 0;
+  
+  for(uword k=0; k < n_segs; ++k)  { total += segs[k].count; }
+  
+  out.zeros(in_n_rows, in_n_cols);
+  
+  if(total == 0)  { return; }
+  
+  arma_conform_check( ( (in_n_rows == 0) || (in_n_cols == 0) ), caller, ": invalid row or column index" );
+  
+  // the per-thread column counts must not dominate the memory use
+  
+  #if defined(ARMA_USE_OPENMP)
+    const bool use_mp = (arma_config::openmp) && (n_segs > 1) && (mp_gate<eT>::eval(total));
+    
+    const uword n_threads_max = (use_mp) ? uword(mp_thread_limit::get()) : uword(1);
+    
+    const uword n_threads = (std::max)( uword(1), (std::min)( (std::min)(n_threads_max, n_segs), total / in_n_cols ) );
+  #else
+    const uword n_threads = 1;
+  #endif
+  
+  // assign contiguous runs of segments with similar numbers of triplets to each thread
+  
+  podarray<uword> seg_start(n_threads + 1);
+  
+  seg_start[0] = 0;
+  
+    {
+    uword thread_id = 1;
+    uword acc       = 0;
+    
+    for(uword k=0; (k < n_segs) && (thread_id < n_threads); ++k)
+      {
+      acc += segs[k].count;
+      
+      if( acc >= ((total / n_threads) * thread_id) )  { seg_start[thread_id] = k+1; ++thread_id; }
+      }
+    
+    for(; thread_id <= n_threads; ++thread_id)  { seg_start[thread_id] = n_segs; }
+    }
+  
+  podarray<uword> offsets(n_threads * in_n_cols);
+  
+  offsets.zeros();
+  
+  podarray<uword> bad_index(n_threads);
+  
+  const auto count_worker = [&](const uword thread_id)
+    {
+    uword* counts = offsets.memptr() + thread_id * in_n_cols;
+    
+    uword local_bad_index = 0;
+    
+    for(uword k = seg_start[thread_id]; k < seg_start[thread_id+1]; ++k)
+      {
+      const segment& s = segs[k];
+      
+      for(uword i=0; i < s.count; ++i)
+        {
+        const uword row = s.rows[i * s.stride];
+        const uword col = s.cols[i * s.stride];
+        
+        if( (row >= in_n_rows) || (col >= in_n_cols) )  { local_bad_index = 1; continue; }
+        
+        if( check_for_zeros && (s.vals[i] == eT(0)) )  { continue; }
+        
+        ++(counts[col]);
+        }
+      }
+    
+    bad_index[thread_id] = local_bad_index;
+    };
+  
+  #if defined(ARMA_USE_OPENMP)
+    {
+    #pragma omp parallel for schedule(static) num_threads(int(n_threads))
+    for(uword thread_id=0; thread_id < n_threads; ++thread_id)  { count_worker(thread_id); }
+    }
+  #else
+    {
+    count_worker(0);
+    }
+  #endif
+  
+  arma_conform_check( (arrayops::accumulate(bad_index.memptr(), bad_index.n_elem) != 0), caller, ": invalid row or column index" );
+  
+  // turn the counts into write offsets; elements from thread t precede those from thread t+1 within each column
+  
+  uword* out_col_ptrs = access::rwp(out.col_ptrs);
+  
+  uword acc = 0;
+  
+  for(uword col=0; col < in_n_cols; ++col)
+    {
+    out_col_ptrs[col] = acc;
+    
+    for(uword thread_id=0; thread_id < n_threads; ++thread_id)
+      {
+      uword& offset = offsets[thread_id * in_n_cols + col];
+      
+      const uword count = offset;
+      
+      offset = acc;
+      
+      acc += count;
+      }
+    }
+  
+  out_col_ptrs[in_n_cols] = acc;
+  
+  const uword n_scattered = acc;
+  
+  out.mem_resize(n_scattered);
+  
+  uword* out_row_indices = access::rwp(out.row_indices);
+  eT*    out_values      = access::rwp(out.values);
+  
+  const auto scatter_worker = [&](const uword thread_id)
+    {
+    uword* pos = offsets.memptr() + thread_id * in_n_cols;
+    
+    for(uword k = seg_start[thread_id]; k < seg_start[thread_id+1]; ++k)
+      {
+      segment& s = segs[k];
+      
+      for(uword i=0; i < s.count; ++i)
+        {
+        const eT val = s.vals[i];
+        
+        if( check_for_zeros && (val == eT(0)) )  { continue; }
+        
+        const uword row = s.rows[i * s.stride];
+        const uword col = s.cols[i * s.stride];
+        
+        if( (row >= in_n_rows) || (col >= in_n_cols) )  { continue; }
+        
+        const uword index = pos[col];  ++(pos[col]);
+        
+        out_row_indices[index] = row;
+        out_values[index]      = val;
+        }
+      
+      SpMat_builder<eT>::release(s);
+      }
+    };
+  
+  #if defined(ARMA_USE_OPENMP)
+    {
+    #pragma omp parallel for schedule(static) num_threads(int(n_threads))
+    for(uword thread_id=0; thread_id < n_threads; ++thread_id)  { scatter_worker(thread_id); }
+    }
+  #else
+    {
+    scatter_worker(0);
+    }
+  #endif
+  
+  offsets.reset();
+  
+  // sort each column by row index and combine elements with identical locations
+  
+  podarray<uword> n_unique(in_n_cols);
+  
+  podarray<uword> has_duplicates(n_threads);
+  
+  has_duplicates.zeros();
+  
+  const auto column_worker = [&](const uword col, std::vector< std::pair<uword,eT> >& scratch, uword& local_has_duplicates)
+    {
+    const uword start = out_col_ptrs[col];
+    const uword n     = out_col_ptrs[col+1] - start;
+    
+    uword* rows = &(out_row_indices[start]);
+    eT*    vals = &(out_values[start]);
+    
+    SpMat_builder<eT>::sort_column(rows, vals, n, scratch);
+    
+    uword count = 0;
+    
+    for(uword i=0; i < n; ++i)
+      {
+      if( (count > 0) && (rows[count-1] == rows[i]) )
+        {
+        vals[count-1] += vals[i];
+        
+        local_has_duplicates = 1;
+        }
+      else
+        {
+        rows[count] = rows[i];
+        vals[count] = vals[i];
+        
+        ++count;
+        }
+      }
+    
+    if(check_for_zeros && (count < n))
+      {
+      // summed duplicates may have cancelled out
+      
+      uword n_keep = 0;
+      
+      for(uword i=0; i < count; ++i)
+        {
+        if(vals[i] != eT(0))  { rows[n_keep] = rows[i]; vals[n_keep] = vals[i]; ++n_keep; }
+        }
+      
+      count = n_keep;
+      }
+    
+    n_unique[col] = count;
+    };
+  
+  #if defined(ARMA_USE_OPENMP)
+    {
+    #pragma omp parallel num_threads(int(n_threads))
+      {
+      const uword thread_id = uword(omp_get_thread_num());
+      
+      std::vector< std::pair<uword,eT> > scratch;
+      
+      uword local_has_duplicates = 0;
+      
+      #pragma omp for schedule(dynamic, 256)
+      for(uword col=0; col < in_n_cols; ++col)  { column_worker(col, scratch, local_has_duplicates); }
+      
+      has_duplicates[thread_id] = local_has_duplicates;
+      }
+    }
+  #else
+    {
+    std::vector< std::pair<uword,eT> > scratch;
+    
+    uword local_has_duplicates = 0;
+    
+    for(uword col=0; col < in_n_cols; ++col)  { column_worker(col, scratch, local_has_duplicates); }
+    
+    has_duplicates[0] = local_has_duplicates;
+    }
+  #endif
+  
+  if( (arma_config::check_conform) && (add_values == false) && (arrayops::accumulate(has_duplicates.memptr(), has_duplicates.n_elem) != 0) )
+    {
+    // the columns have been partly combined, so out is not a valid matrix at this point
+    
+    out.zeros(in_n_rows, in_n_cols);
+    
+    arma_stop_logic_error(caller, ": detected identical locations");
+    }
+  
+  // remove the gaps left by combined elements; the data only ever moves towards the start of the arrays
+  
+  uword n_final = 0;
+  
+  for(uword col=0; col < in_n_cols; ++col)
+    {
+    const uword start = out_col_ptrs[col];
+    const uword count = n_unique[col];
+    
+    if(start != n_final)
+      {
+      std::copy( &(out_row_indices[start]), &(out_row_indices[start + count]), &(out_row_indices[n_final]) );
+      std::copy( &(out_values[start]),      &(out_values[start + count]),      &(out_values[n_final])      );
+      }
+    
+    out_col_ptrs[col] = n_final;
+    
+    n_final += count;
+    }
+  
+  out_col_ptrs[in_n_cols] = n_final;
+  
+  if(n_final != n_scattered)  { out.mem_resize(n_final); }
+  }
+
+
+
+//! @}
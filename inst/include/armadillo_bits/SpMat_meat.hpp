@@ -516,6 +516,47 @@ SpMat<eT>::SpMat(const bool add_values, const Base<uword,T1>& locations_expr, co
 
 
 
+//! Construct from (row, column, value) triplets given as three separate vectors.
+//! The triplets do not need to be sorted; elements with identical locations are summed if add_values is true.
+//! Uses a parallel counting sort by column when OpenMP is enabled.
+template<typename eT>
+template<typename T1, typename T2, typename T3>
+inline
+SpMat<eT>::SpMat(const bool add_values, const Base<uword,T1>& rowind_expr, const Base<uword,T2>& colind_expr, const Base<eT,T3>& vals_expr, const uword in_n_rows, const uword in_n_cols, const bool check_for_zeros)
+  : n_rows(0)
+  , n_cols(0)
+  , n_elem(0)
+  , n_nonzero(0)
+  , vec_state(0)
+  , values(nullptr)
+  , row_indices(nullptr)
+  , col_ptrs(nullptr)
+  {
+  arma_debug_sigprint_this(this);
+  
+  const quasi_unwrap<T1> rowind_tmp( rowind_expr.get_ref() );
+  const quasi_unwrap<T2> colind_tmp( colind_expr.get_ref() );
+  const quasi_unwrap<T3>   vals_tmp(   vals_expr.get_ref() );
+  
+  const Mat<uword>& rowind = rowind_tmp.M;
+  const Mat<uword>& colind = colind_tmp.M;
+  const Mat<eT>&    vals   =   vals_tmp.M;
+  
+  arma_conform_check( (rowind.is_vec() == false) || (colind.is_vec() == false) || (vals.is_vec() == false), "SpMat::SpMat(): given 'rowind', 'colind' and 'values' objects must be vectors" );
+  
+  arma_conform_check( ( (rowind.n_elem != vals.n_elem) || (colind.n_elem != vals.n_elem) ), "SpMat::SpMat(): number of locations is different than number of values" );
+  
+  init_cold(in_n_rows, in_n_cols);
+  
+  std::vector<typename SpMat_builder<eT>::segment> segs;
+  
+  SpMat_builder<eT>::split(segs, rowind.memptr(), colind.memptr(), vals.memptr(), vals.n_elem, 1);
+  
+  SpMat_builder<eT>::assemble(*this, in_n_rows, in_n_cols, segs, add_values, check_for_zeros, "SpMat::SpMat()");
+  }
+
+
+
 //! Insert a large number of values at once.
 //! Per CSC format, rowind_expr should be row indices, 
 //! colptr_expr should column ptr indices locations,
@@ -4652,6 +4693,10 @@ SpMat<eT>::save(const std::string name, const file_type type) const
       save_okay = diskio::save_arma_binary(*this, name);
       break;
     
+    case arma_zbinary:
+      save_okay = diskio::save_arma_zbinary(*this, name);
+      break;
+    
     case coord_ascii:
       save_okay = diskio::save_coord_ascii(*this, name);
       break;
@@ -4769,6 +4814,10 @@ SpMat<eT>::save(std::ostream& os, const file_type type) const
       save_okay = diskio::save_arma_binary(*this, os);
       break;
     
+    case arma_zbinary:
+      save_okay = diskio::save_arma_zbinary(*this, os);
+      break;
+    
     case coord_ascii:
       save_okay = diskio::save_coord_ascii(*this, os);
       break;
@@ -4816,6 +4865,10 @@ SpMat<eT>::load(const std::string name, const file_type type)
       load_okay = diskio::load_arma_binary(*this, name, err_msg);
       break;
     
+    case arma_zbinary:
+      load_okay = diskio::load_arma_zbinary(*this, name, err_msg);
+      break;
+    
     case coord_ascii:
       load_okay = diskio::load_coord_ascii(*this, name, err_msg);
       break;
@@ -4964,6 +5017,10 @@ SpMat<eT>::load(std::istream& is, const file_type type)
       load_okay = diskio::load_arma_binary(*this, is, err_msg);
       break;
     
+    case arma_zbinary:
+      load_okay = diskio::load_arma_zbinary(*this, is, err_msg);
+      break;
+    
     case coord_ascii:
       load_okay = diskio::load_coord_ascii(*this, is, err_msg);
       break;
@@ -5233,7 +5290,7 @@ SpMat<eT>::init(const MapMat<eT>& x)
   
   if(x_n_nz == 0)  { return; }
   
-  typename MapMat<eT>::map_type& x_map_ref = *(x.map_ptr);
+  const typename MapMat<eT>::map_type& x_map_ref = *(x.map_ptr);
   
   typename MapMat<eT>::map_type::const_iterator x_it = x_map_ref.begin();
   
@@ -5380,54 +5437,13 @@ SpMat<eT>::init_batch_std(const Mat<uword>& locs, const Mat<eT>& vals, const boo
     
     if(actually_sorted == false)
       {
-      // see op_sort_index_bones.hpp for the definition of arma_sort_index_packet and arma_sort_index_helper_ascend
-      
-      std::vector< arma_sort_index_packet<uword> > packet_vec(locs_n_cols);
-      
-      const uword* locs_mem = locs.memptr();
-      
-      for(uword i = 0; i < locs_n_cols; ++i)
-        {
-        const uword row = (*locs_mem);  locs_mem++;
-        const uword col = (*locs_mem);  locs_mem++;
-        
-        packet_vec[i].val   = (col * n_rows) + row;
-        packet_vec[i].index = i;
-        }
+      std::vector<typename SpMat_builder<eT>::segment> segs;
       
-      arma_sort_index_helper_ascend<uword> comparator;
+      SpMat_builder<eT>::split(segs, locs.memptr(), locs.memptr() + 1, vals.memptr(), locs.n_cols, 2);
       
-      std::sort( packet_vec.begin(), packet_vec.end(), comparator );
+      SpMat_builder<eT>::assemble(*this, n_rows, n_cols, segs, false, false, "SpMat::SpMat()");
       
-      // insert the elements in the sorted order
-      for(uword i = 0; i < locs_n_cols; ++i)
-        {
-        const uword index = packet_vec[i].index;
-        
-        const uword* locs_i = locs.colptr(index);
-        
-        const uword row_i = locs_i[0];
-        const uword col_i = locs_i[1];
-        
-        arma_conform_check( ( (row_i >= n_rows) || (col_i >= n_cols) ), "SpMat::SpMat(): invalid row or column index" );
-        
-        if(i > 0)
-          {
-          const uword prev_index = packet_vec[i-1].index;
-          
-          const uword* locs_im1 = locs.colptr(prev_index);
-          
-          const uword row_im1 = locs_im1[0];
-          const uword col_im1 = locs_im1[1];
-          
-          arma_conform_check( ( (row_i == row_im1) && (col_i == col_im1) ), "SpMat::SpMat(): detected identical locations" );
-          }
-        
-        access::rw(values[i])      = vals[index];
-        access::rw(row_indices[i]) = row_i;
-        
-        access::rw(col_ptrs[ col_i + 1 ])++;
-        }
+      return;
       }
     }
   
@@ -5515,68 +5531,13 @@ SpMat<eT>::init_batch_add(const Mat<uword>& locs, const Mat<eT>& vals, const boo
     
     if(actually_sorted == false)
       {
-      // This may not be the fastest possible implementation but it maximizes code reuse.
-      Col<uword> abslocs(locs.n_cols, arma_nozeros_indicator());
-      
-      for(uword i = 0; i < locs.n_cols; ++i)
-        {
-        const uword* locs_i = locs.colptr(i);
-        
-        abslocs[i] = locs_i[1] * n_rows + locs_i[0];
-        }
-      
-      uvec sorted_indices = sort_index(abslocs); // Ascending sort.
+      std::vector<typename SpMat_builder<eT>::segment> segs;
       
-      // work out the number of unique elements 
-      uword n_unique = 1;  // first element is unique
+      SpMat_builder<eT>::split(segs, locs.memptr(), locs.memptr() + 1, vals.memptr(), locs.n_cols, 2);
       
-      for(uword i=1; i < sorted_indices.n_elem; ++i)
-        {
-        const uword* locs_i   = locs.colptr( sorted_indices[i  ] );
-        const uword* locs_im1 = locs.colptr( sorted_indices[i-1] );
-        
-        if( (locs_i[1] != locs_im1[1]) || (locs_i[0] != locs_im1[0]) )  { ++n_unique; }
-        }
+      SpMat_builder<eT>::assemble(*this, n_rows, n_cols, segs, true, false, "SpMat::SpMat()");
       
-      // resize to correct number of elements
-      mem_resize(n_unique);
-      
-      // Now we add the elements in this sorted order.
-      uword count = 0;
-      
-      // first element
-        {
-        const uword  i      = 0;
-        const uword* locs_i = locs.colptr( sorted_indices[i] );
-        
-        arma_conform_check( ( (locs_i[0] >= n_rows) || (locs_i[1] >= n_cols) ), "SpMat::SpMat(): invalid row or column index" );
-        
-        access::rw(values[count])      = vals[ sorted_indices[i] ];
-        access::rw(row_indices[count]) = locs_i[0];
-        
-        access::rw(col_ptrs[ locs_i[1] + 1 ])++;
-        }
-      
-      for(uword i=1; i < sorted_indices.n_elem; ++i)
-        {
-        const uword* locs_i   = locs.colptr( sorted_indices[i  ] );
-        const uword* locs_im1 = locs.colptr( sorted_indices[i-1] );
-        
-        arma_conform_check( ( (locs_i[0] >= n_rows) || (locs_i[1] >= n_cols) ), "SpMat::SpMat(): invalid row or column index" );
-        
-        if( (locs_i[1] == locs_im1[1]) && (locs_i[0] == locs_im1[0]) )
-          {
-          access::rw(values[count]) += vals[ sorted_indices[i] ];
-          }
-        else
-          {
-          count++;
-          access::rw(values[count])      = vals[ sorted_indices[i] ];
-          access::rw(row_indices[count]) = locs_i[0];
-          
-          access::rw(col_ptrs[ locs_i[1] + 1 ])++;
-          }
-        }
+      return;
       }
     }
   
@@ -72,6 +72,41 @@ struct arma_config
   #endif
   
   
+  #if defined(ARMA_OPTIMISE_VECMATH)
+    static constexpr bool optimise_vecmath = true;
+  #else
+    static constexpr bool optimise_vecmath = false;
+  #endif
+  
+  
+  #if defined(ARMA_OPTIMISE_SPCACHE)
+    static constexpr bool optimise_spcache = true;
+  #else
+    static constexpr bool optimise_spcache = false;
+  #endif
+  
+  
+  #if defined(ARMA_OPTIMISE_FFT)
+    static constexpr bool optimise_fft = true;
+  #else
+    static constexpr bool optimise_fft = false;
+  #endif
+  
+  
+  #if defined(ARMA_OPTIMISE_CONV)
+    static constexpr bool optimise_conv = true;
+  #else
+    static constexpr bool optimise_conv = false;
+  #endif
+  
+  
+  #if defined(ARMA_OPTIMISE_KMEANS)
+    static constexpr bool optimise_kmeans = true;
+  #else
+    static constexpr bool optimise_kmeans = false;
+  #endif
+  
+  
   #if defined(ARMA_CHECK_CONFORMANCE)
     static constexpr bool check_conform = true;
   #else
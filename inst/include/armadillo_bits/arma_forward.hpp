@@ -55,9 +55,17 @@ template<typename eT> class diagview;
 template<typename eT> class spdiagview;
 
 template<typename eT> class MapMat;
+template<typename eT> class MapMat_hash;
 template<typename eT> class MapMat_val;
 template<typename eT> class SpMat_MapMat_val;
 template<typename eT> class SpSubview_MapMat_val;
+template<typename eT> class SpMat_builder;
+template<typename eT> class SpMatR;
+template<typename eT> class spmv_plan;
+
+template<typename T1> class mmap_obj;
+template<typename eT> class block_reader;
+template<typename eT> class block_writer;
 
 template<typename eT, typename T1>              class subview_elem1;
 template<typename eT, typename T1, typename T2> class subview_elem2;
@@ -399,6 +407,7 @@ enum struct file_type : unsigned int
   hdf5_binary_trans,  //!< [NOTE: DO NOT USE - deprecated] as per hdf5_binary, but save/load the data with columns transposed to rows
   coord_ascii,        //!< simple co-ordinate format for sparse matrices (indices start at zero)
   ssv_ascii,          //!< similar to csv_ascii; uses semicolon (;) instead of comma (,) as the separator
+  arma_zbinary,       //!< as per arma_binary, but with the data stored as independently compressed blocks
   };
 
 
@@ -415,6 +424,7 @@ static constexpr file_type hdf5_binary        = file_type::hdf5_binary;
 static constexpr file_type hdf5_binary_trans  = file_type::hdf5_binary_trans;
 static constexpr file_type coord_ascii        = file_type::coord_ascii;
 static constexpr file_type ssv_ascii          = file_type::ssv_ascii;
+static constexpr file_type arma_zbinary       = file_type::arma_zbinary;
 
 
 struct hdf5_name;
@@ -469,6 +479,63 @@ struct superlu_opts : public spsolve_opts_base
   };
 
 
+struct iterative_stats
+  {
+  unsigned int n_iter;    // number of iterations (largest over all columns of B)
+  double       residual;  // relative residual norm ||B - A*X|| / ||B|| (largest over all columns of B)
+  bool         converged;
+  
+  inline iterative_stats()
+    {
+    n_iter    = 0;
+    residual  = 0.0;
+    converged = false;
+    }
+  };
+
+
+struct iterative_opts : public spsolve_opts_base
+  {
+  typedef enum {CG, BICGSTAB, GMRES} solver_type;
+  
+  typedef enum {PRECOND_NONE, PRECOND_JACOBI, PRECOND_ILU0, PRECOND_IC0} precond_type;
+  
+  solver_type      solver;    // only used by spsolve_factoriser; spsolve() takes the solver name
+  precond_type     precond;
+  double           tol;       // relative residual tolerance
+  unsigned int     max_iter;  // 0 = automatic
+  unsigned int     restart;   // GMRES restart length
+  iterative_stats* stats;     // if not null, filled with convergence information
+  
+  inline iterative_opts()
+    : spsolve_opts_base(2)
+    {
+    solver   = CG;
+    precond  = PRECOND_JACOBI;
+    tol      = 1e-10;
+    max_iter = 0;
+    restart  = 50;
+    stats    = nullptr;
+    }
+  };
+
+
+struct sp_chol_opts : public spsolve_opts_base
+  {
+  typedef enum {NATURAL, AMD} ordering_type;
+  
+  ordering_type ordering;
+  bool          ldlt;  // allow symmetric indefinite matrices (nonzero pivots); otherwise the matrix must be positive definite
+  
+  inline sp_chol_opts()
+    : spsolve_opts_base(3)
+    {
+    ordering = AMD;
+    ldlt     = false;
+    }
+  };
+
+
 //! @}
 
 
@@ -477,17 +544,44 @@ struct superlu_opts : public spsolve_opts_base
 //! @{
 
 
+struct eigs_stats
+  {
+  unsigned int n_iter;       // number of iterations (restarts for the Krylov method, block iterations for LOBPCG)
+  unsigned int n_matvec;     // number of matrix-vector products (a product with a block of vectors counts once per vector)
+  double       time_matvec;  // seconds spent in matrix-vector products
+  double       time_total;   // seconds spent in the solver
+  bool         converged;
+  
+  inline eigs_stats()
+    {
+    n_iter      = 0;
+    n_matvec    = 0;
+    time_matvec = 0.0;
+    time_total  = 0.0;
+    converged   = false;
+    }
+  };
+
+
 struct eigs_opts
   {
-  double       tol;     // tolerance
-  unsigned int maxiter; // max iterations
-  unsigned int subdim;  // subspace dimension
+  typedef enum {KRYLOV, LOBPCG} method_type;
+  
+  double       tol;         // tolerance
+  unsigned int maxiter;     // max iterations
+  unsigned int subdim;      // subspace dimension
+  method_type  method;      // KRYLOV: restarted Lanczos/Arnoldi; LOBPCG: block method, used by eigs_sym() with "la" or "sa" and by svds()
+  unsigned int block_size;  // block size for LOBPCG; 0 = automatic
+  eigs_stats*  stats;       // if not null, filled with iteration counts and timings
   
   inline eigs_opts()
     {
-    tol     = 0.0;
-    maxiter = 1000;
-    subdim  = 0;
+    tol        = 0.0;
+    maxiter    = 1000;
+    subdim     = 0;
+    method     = KRYLOV;
+    block_size = 0;
+    stats      = nullptr;
     }
   };
 
@@ -0,0 +1,113 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2026 Dirk Eddelbuettel
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// https://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+
+//! \addtogroup block_reader
+//! @{
+
+
+//! Read a large matrix stored in a file as a sequence of consecutive blocks of rows (dim=0) or columns (dim=1).
+//! Supported layouts:
+//! csv_ascii, raw_ascii, raw_binary (column vector): row blocks;
+//! arma_binary: row or column blocks;
+//! coord_ascii (entries ordered by column, as written by .save()): column blocks.
+//! When std::mutex support is enabled, the next block is read by a background thread while the current block is used.
+template<typename eT>
+class block_reader
+  {
+  public:
+  
+  typedef eT elem_type;
+  
+  inline ~block_reader();
+  inline  block_reader();
+  
+  inline block_reader(const std::string& name, const file_type type, const uword block_size, const uword dim = 0);
+  inline block_reader(const csv_name&    spec, const file_type type, const uword block_size);
+  
+  block_reader(const block_reader&)            = delete;
+  block_reader& operator=(const block_reader&) = delete;
+  
+  inline bool open(const std::string& name, const file_type type, const uword block_size, const uword dim = 0);
+  inline bool open(const csv_name&    spec, const file_type type, const uword block_size);
+  
+  inline void close();
+  
+  inline bool next(Mat<eT>& block);
+  
+  arma_warn_unused inline bool  is_open() const;
+  arma_warn_unused inline bool  good()    const;
+  arma_warn_unused inline uword n_read()  const;
+  
+  
+  private:
+  
+  std::ifstream f;
+  std::string   name;
+  
+  file_type type       = file_type_unknown;
+  uword     block_size = 0;
+  uword     dim        = 0;
+  char      separator  = ',';
+  bool      strict     = false;
+  
+  bool  failed    = false;
+  bool  finished  = false;
+  uword pos       = 0;     //!< number of rows (dim=0) or columns (dim=1) read from the file
+  uword delivered = 0;     //!< number of rows or columns returned by next()
+  bool  status    = true;  //!< false if next() encountered invalid data
+  
+  std::string err_msg;
+  
+  uword          f_n_rows = 0;  //!< size of the matrix, where known in advance
+  uword          f_n_cols = 0;
+  std::streamoff f_data   = 0;  //!< start of the data in binary files
+  
+  std::string line;
+  std::string chunk;
+  
+  bool  coord_pending = false;
+  bool  coord_done    = false;
+  uword coord_row     = 0;
+  uword coord_col     = 0;
+  eT    coord_val     = eT(0);
+  
+  Mat<eT> ahead;
+  
+  #if defined(ARMA_USE_STD_MUTEX)
+    std::future<bool> pending;
+  #endif
+  
+  inline bool open_internal(const file_type type, const uword block_size, const uword dim, field<std::string>* header);
+  
+  inline bool read_block(Mat<eT>& out);
+  inline bool read_text (Mat<eT>& out);
+  inline bool read_bin  (Mat<eT>& out);
+  inline bool read_coord(Mat<eT>& out);
+  
+  inline bool scan_coord();
+  inline bool parse_coord();
+  
+  inline void set_error(const char* msg);
+  
+  template<typename T> inline static bool convert_value(T&               val, const char* str, const uword N, const char* str2, const uword N2);
+  template<typename T> inline static bool convert_value(std::complex<T>& val, const char* str, const uword N, const char* str2, const uword N2);
+  };
+
+
+
+//! @}
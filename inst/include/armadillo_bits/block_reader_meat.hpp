@@ -0,0 +1,733 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2026 Dirk Eddelbuettel
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// https://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+
+//! \addtogroup block_reader
+//! @{
+
+
+
+template<typename eT>
+inline
+block_reader<eT>::~block_reader()
+  {
+  arma_debug_sigprint_this(this);
+  
+  close();
+  }
+
+
+
+template<typename eT>
+inline
+block_reader<eT>::block_reader()
+  {
+  arma_debug_sigprint_this(this);
+  }
+
+
+
+template<typename eT>
+inline
+block_reader<eT>::block_reader(const std::string& in_name, const file_type in_type, const uword in_block_size, const uword in_dim)
+  {
+  arma_debug_sigprint_this(this);
+  
+  if(open(in_name, in_type, in_block_size, in_dim) == false)
+    {
+    arma_stop_runtime_error("block_reader::block_reader(): couldn't open file");
+    }
+  }
+
+
+
+template<typename eT>
+inline
+block_reader<eT>::block_reader(const csv_name& spec, const file_type in_type, const uword in_block_size)
+  {
+  arma_debug_sigprint_this(this);
+  
+  if(open(spec, in_type, in_block_size) == false)
+    {
+    arma_stop_runtime_error("block_reader::block_reader(): couldn't open file");
+    }
+  }
+
+
+
+template<typename eT>
+inline
+bool
+block_reader<eT>::open(const std::string& in_name, const file_type in_type, const uword in_block_size, const uword in_dim)
+  {
+  arma_debug_sigprint();
+  
+  close();
+  
+  name      = in_name;
+  separator = (in_type == ssv_ascii) ? char(';') : char(',');
+  strict    = false;
+  
+  return open_internal(in_type, in_block_size, in_dim, nullptr);
+  }
+
+
+
+template<typename eT>
+inline
+bool
+block_reader<eT>::open(const csv_name& spec, const file_type in_type, const uword in_block_size)
+  {
+  arma_debug_sigprint();
+  
+  if( (in_type != csv_ascii) && (in_type != ssv_ascii) )
+    {
+    arma_stop_runtime_error("block_reader::open(): unsupported file type for csv_name()");
+    return false;
+    }
+  
+  close();
+  
+  const bool do_trans      = bool(spec.opts.flags & csv_opts::flag_trans      );
+  const bool no_header     = bool(spec.opts.flags & csv_opts::flag_no_header  );
+  const bool with_header   = bool(spec.opts.flags & csv_opts::flag_with_header) && (no_header == false);
+  const bool use_semicolon = bool(spec.opts.flags & csv_opts::flag_semicolon  ) || (in_type == ssv_ascii);
+  
+  if(do_trans)
+    {
+    arma_warn(1, "block_reader::open(): csv_opts::trans is not supported");
+    return false;
+    }
+  
+  name      = spec.filename;
+  separator = (use_semicolon) ? char(';') : char(',');
+  strict    = bool(spec.opts.flags & csv_opts::flag_strict);
+  
+  return open_internal(in_type, in_block_size, 0, (with_header) ? &(spec.header_rw) : nullptr);
+  }
+
+
+
+template<typename eT>
+inline
+bool
+block_reader<eT>::open_internal(const file_type in_type, const uword in_block_size, const uword in_dim, field<std::string>* header)
+  {
+  arma_debug_sigprint();
+  
+  arma_conform_check( (in_block_size == 0), "block_reader::open(): block_size must be greater than zero" );
+  arma_conform_check( (in_dim > 1),         "block_reader::open(): parameter 'dim' must be 0 or 1"        );
+  
+  type       = (in_type == ssv_ascii) ? csv_ascii : in_type;
+  block_size = in_block_size;
+  dim        = in_dim;
+  
+  const bool is_text = (type == csv_ascii) || (type == raw_ascii) || (type == coord_ascii);
+  
+  bool type_ok = false;
+  
+  switch(type)
+    {
+    case csv_ascii:
+    case raw_ascii:
+    case raw_binary:
+      type_ok = (dim == 0);
+      break;
+    
+    case arma_binary:
+      type_ok = true;
+      break;
+    
+    case coord_ascii:
+      type_ok = (dim == 1);
+      break;
+    
+    default:
+      type_ok = false;
+    }
+  
+  if(type_ok == false)
+    {
+    arma_warn(1, "block_reader::open(): unsupported combination of file type and dim");
+    return false;
+    }
+  
+  (is_text && (arma_config::text_as_binary == false)) ? f.open(name) : f.open(name, std::fstream::binary);
+  
+  if(f.is_open() == false)  { return false; }
+  
+  if( (type == csv_ascii) && (header != nullptr) )
+    {
+    arma_debug_print("block_reader::open(): reading header");
+    
+    std::getline(f, line);
+    
+    if(f.fail())  { set_error("couldn't read header"); }
+    
+    if(failed == false)  { diskio::load_csv_header(*header, line, separator); }
+    }
+  else
+  if(type == raw_binary)
+    {
+    f.seekg(0, std::ios::end);
+    
+    const std::streamoff len = std::streamoff(f.tellg());
+    
+    f.seekg(0, std::ios::beg);
+    
+    if(f.fail() || (len < 0))  { set_error("seek failure"); }
+    
+    f_n_rows = (failed) ? uword(0) : uword(len) / uword(sizeof(eT));
+    f_n_cols = 1;
+    }
+  else
+  if(type == arma_binary)
+    {
+    std::string f_header;
+    
+    f >> f_header;
+    f >> f_n_rows;
+    f >> f_n_cols;
+    
+    f.get();
+    
+    if(f.fail() || (f_header != diskio::gen_bin_header(Mat<eT>())))  { set_error("incorrect header"); }
+    
+    f_data = std::streamoff(f.tellg());
+    }
+  else
+  if(type == coord_ascii)
+    {
+    scan_coord();
+    }
+  
+  if(failed)
+    {
+    arma_warn(3, "block_reader::open(): ", err_msg, "; file: ", name);
+    
+    close();
+    
+    return false;
+    }
+  
+  return true;
+  }
+
+
+
+template<typename eT>
+inline
+void
+block_reader<eT>::close()
+  {
+  arma_debug_sigprint();
+  
+  #if defined(ARMA_USE_STD_MUTEX)
+    {
+    if(pending.valid())  { pending.get(); }
+    }
+  #endif
+  
+  if(f.is_open())  { f.close(); }
+  
+  f.clear();
+  
+  name.clear();
+  err_msg.clear();
+  
+  type       = file_type_unknown;
+  block_size = 0;
+  dim        = 0;
+  separator  = ',';
+  strict     = false;
+  
+  failed    = false;
+  finished  = false;
+  pos       = 0;
+  delivered = 0;
+  status    = true;
+  
+  f_n_rows = 0;
+  f_n_cols = 0;
+  f_data   = 0;
+  
+  coord_pending = false;
+  coord_done    = false;
+  
+  ahead.reset();
+  }
+
+
+
+//! fill the given matrix with the next block;
+//! returns false when the end of the file is reached or the data is invalid (see .good())
+template<typename eT>
+inline
+bool
+block_reader<eT>::next(Mat<eT>& block)
+  {
+  arma_debug_sigprint();
+  
+  if(f.is_open() == false)  { return false; }
+  
+  bool next_okay = false;
+  
+  #if defined(ARMA_USE_STD_MUTEX)
+    {
+    if(pending.valid())
+      {
+      next_okay = pending.get();
+      
+      if(next_okay)  { block.swap(ahead); }
+      }
+    else
+      {
+      next_okay = read_block(block);
+      }
+    
+    if(next_okay)
+      {
+      // the background thread only accesses the file stream and the read-ahead buffer
+      
+      try { pending = std::async(std::launch::async, [this]() { return (*this).read_block(ahead); }); } catch(...) {}
+      }
+    }
+  #else
+    {
+    next_okay = read_block(block);
+    }
+  #endif
+  
+  if(next_okay)
+    {
+    delivered += (dim == 0) ? block.n_rows : block.n_cols;
+    }
+  else
+    {
+    block.reset();
+    
+    if(failed)
+      {
+      status = false;
+      
+      arma_warn(3, "block_reader::next(): ", err_msg, "; file: ", name);
+      }
+    }
+  
+  return next_okay;
+  }
+
+
+
+template<typename eT>
+inline
+bool
+block_reader<eT>::is_open() const
+  {
+  return f.is_open();
+  }
+
+
+
+//! false if invalid data was encountered
+template<typename eT>
+inline
+bool
+block_reader<eT>::good() const
+  {
+  return status;
+  }
+
+
+
+//! number of rows (dim=0) or columns (dim=1) obtained via .next() so far
+template<typename eT>
+inline
+uword
+block_reader<eT>::n_read() const
+  {
+  return delivered;
+  }
+
+
+
+template<typename eT>
+inline
+bool
+block_reader<eT>::read_block(Mat<eT>& out)
+  {
+  arma_debug_sigprint();
+  
+  if(finished || failed)  { return false; }
+  
+  bool read_okay = false;
+  
+  try
+    {
+    switch(type)
+      {
+      case csv_ascii:
+      case raw_ascii:
+        read_okay = read_text(out);
+        break;
+      
+      case raw_binary:
+      case arma_binary:
+        read_okay = read_bin(out);
+        break;
+      
+      case coord_ascii:
+        read_okay = read_coord(out);
+        break;
+      
+      default:
+        read_okay = false;
+      }
+    }
+  catch(...)
+    {
+    set_error("not enough memory");
+    
+    read_okay = false;
+    }
+  
+  if(read_okay == false)  { finished = true; }
+  
+  return read_okay;
+  }
+
+
+
+template<typename eT>
+inline
+bool
+block_reader<eT>::read_text(Mat<eT>& out)
+  {
+  arma_debug_sigprint();
+  
+  chunk.clear();
+  
+  uword n_lines = 0;
+  
+  while(n_lines < block_size)
+    {
+    if(std::getline(f, line).fail())  { break; }
+    
+    // as in Mat::load(), the data ends at the first empty line
+    
+    if( line.empty() || ((line.size() == 1) && (line[0] == '\r')) )  { finished = true; break; }
+    
+    chunk += line;
+    chunk += '\n';
+    
+    ++n_lines;
+    }
+  
+  if(n_lines == 0)  { return false; }
+  
+  std::string msg;
+  
+  bool load_okay = false;
+  
+  if(type == raw_ascii)
+    {
+    load_okay = diskio::load_raw_ascii(out, chunk.c_str(), uword(chunk.size()), msg);
+    }
+  else
+  if(is_cx<eT>::no)
+    {
+    load_okay = diskio::load_csv_ascii(out, chunk.c_str(), uword(chunk.size()), msg, separator, strict);
+    }
+  else
+    {
+    std::istringstream ss(chunk);
+    
+    load_okay = diskio::load_csv_ascii(out, ss, msg, separator, strict);
+    }
+  
+  if(load_okay == false)
+    {
+    set_error( (msg.length() > 0) ? msg.c_str() : "read failed" );
+    
+    return false;
+    }
+  
+  if(pos == 0)  { f_n_cols = out.n_cols; }
+  
+  if(out.n_cols != f_n_cols)
+    {
+    // CSV rows with missing trailing fields are padded, as when loading the entire file
+    
+    if( (type == csv_ascii) && (out.n_cols < f_n_cols) )
+      {
+      const uword old_n_cols = out.n_cols;
+      
+      out.resize(out.n_rows, f_n_cols);
+      
+      if(strict)  { out.cols(old_n_cols, f_n_cols-1).fill(Datum<eT>::nan); }
+      }
+    else
+      {
+      set_error("inconsistent number of columns");
+      
+      return false;
+      }
+    }
+  
+  pos += out.n_rows;
+  
+  return true;
+  }
+
+
+
+template<typename eT>
+inline
+bool
+block_reader<eT>::read_bin(Mat<eT>& out)
+  {
+  arma_debug_sigprint();
+  
+  const uword n_total = (dim == 0) ? f_n_rows : f_n_cols;
+  
+  if(pos >= n_total)  { return false; }
+  
+  const uword n = (std::min)(block_size, n_total - pos);
+  
+  if( (type == raw_binary) || (dim == 1) )
+    {
+    // the block is contiguous in the file
+    
+    (dim == 0) ? out.set_size(n, f_n_cols) : out.set_size(f_n_rows, n);
+    
+    f.read( reinterpret_cast<char*>(out.memptr()), std::streamsize(out.n_elem*sizeof(eT)) );
+    }
+  else
+    {
+    out.set_size(n, f_n_cols);
+    
+    for(uword col=0; col < f_n_cols; ++col)
+      {
+      f.seekg( f_data + std::streamoff(col*f_n_rows + pos) * std::streamoff(sizeof(eT)) );
+      
+      f.read( reinterpret_cast<char*>(out.colptr(col)), std::streamsize(n*sizeof(eT)) );
+      }
+    }
+  
+  if(f.good() == false)  { set_error("read failed"); return false; }
+  
+  pos += n;
+  
+  return true;
+  }
+
+
+
+template<typename eT>
+inline
+bool
+block_reader<eT>::read_coord(Mat<eT>& out)
+  {
+  arma_debug_sigprint();
+  
+  if(pos >= f_n_cols)  { return false; }
+  
+  const uword n = (std::min)(block_size, f_n_cols - pos);
+  
+  out.zeros(f_n_rows, n);
+  
+  while(true)
+    {
+    if(coord_pending == false)
+      {
+      if(parse_coord() == false)
+        {
+        if(failed)  { return false; }
+        
+        break;
+        }
+      }
+    
+    if(coord_col <  pos   )  { set_error("entries not ordered by column"); return false; }
+    if(coord_col >= pos+n )  { break; }
+    
+    coord_pending = false;
+    
+    if(coord_val != eT(0))  { out.at(coord_row, coord_col - pos) = coord_val; }
+    }
+  
+  pos += n;
+  
+  return true;
+  }
+
+
+
+//! determine the matrix size from the largest row and column indices
+template<typename eT>
+inline
+bool
+block_reader<eT>::scan_coord()
+  {
+  arma_debug_sigprint();
+  
+  bool size_found = false;
+  
+  while(parse_coord())
+    {
+    size_found = true;
+    
+    if(f_n_rows < coord_row)  { f_n_rows = coord_row; }
+    if(f_n_cols < coord_col)  { f_n_cols = coord_col; }
+    }
+  
+  if(failed)  { return false; }
+  
+  if(size_found)  { ++f_n_rows;  ++f_n_cols; }
+  
+  coord_pending = false;
+  coord_done    = false;
+  
+  f.clear();
+  f.seekg(0, std::ios::beg);
+  
+  if(f.fail())  { set_error("seek failure"); return false; }
+  
+  return true;
+  }
+
+
+
+template<typename eT>
+inline
+bool
+block_reader<eT>::parse_coord()
+  {
+  if(coord_done)  { return false; }
+  
+  if(std::getline(f, line).fail())  { coord_done = true; return false; }
+  
+  const char* tok[4] = { nullptr, nullptr, nullptr, nullptr };
+  uword       len[4] = { 0, 0, 0, 0 };
+  
+  uword n_tok = 0;
+  
+  const char* ptr = line.c_str();
+  const char* end = ptr + line.size();
+  
+  while( (ptr < end) && (n_tok < 4) )
+    {
+    while( (ptr < end) && ((*ptr == ' ') || (*ptr == '\t') || (*ptr == '\r')) )  { ++ptr; }
+    
+    if(ptr >= end)  { break; }
+    
+    tok[n_tok] = ptr;
+    
+    while( (ptr < end) && (*ptr != ' ') && (*ptr != '\t') && (*ptr != '\r') )  { ++ptr; }
+    
+    len[n_tok] = uword(ptr - tok[n_tok]);
+    
+    ++n_tok;
+    }
+  
+  // as in Mat::load(), the data ends at the first empty line
+  
+  if(n_tok == 0)  { coord_done = true; return false; }
+  
+  // a valid line in co-ord format has at least 2 entries
+  
+  bool parse_okay = (n_tok >= 2);
+  
+  uword index[2] = { 0, 0 };
+  
+  for(uword i=0; (i < 2) && parse_okay; ++i)
+    {
+    for(uword j=0; j < len[i]; ++j)
+      {
+      const char c = tok[i][j];
+      
+      if( (c < '0') || (c > '9') )  { parse_okay = false; break; }
+      
+      index[i] = 10*index[i] + uword(c - '0');
+      }
+    }
+  
+  if(parse_okay == false)  { set_error("incorrect format"); return false; }
+  
+  coord_row = index[0];
+  coord_col = index[1];
+  
+  block_reader<eT>::convert_value(coord_val, tok[2], len[2], tok[3], len[3]);
+  
+  coord_pending = true;
+  
+  return true;
+  }
+
+
+
+template<typename eT>
+inline
+void
+block_reader<eT>::set_error(const char* msg)
+  {
+  // may be called from the read-ahead thread, so the message is only reported by next()
+  
+  failed  = true;
+  err_msg = msg;
+  }
+
+
+
+template<typename eT>
+template<typename T>
+inline
+bool
+block_reader<eT>::convert_value(T& val, const char* str, const uword N, const char* str2, const uword N2)
+  {
+  arma_ignore(str2);
+  arma_ignore(N2);
+  
+  if(str == nullptr)  { val = T(0); return true; }
+  
+  return diskio::convert_token(val, str, N);
+  }
+
+
+
+template<typename eT>
+template<typename T>
+inline
+bool
+block_reader<eT>::convert_value(std::complex<T>& val, const char* str, const uword N, const char* str2, const uword N2)
+  {
+  T val_real = T(0);
+  T val_imag = T(0);
+  
+  bool convert_okay = true;
+  
+  if(str  != nullptr)  { convert_okay = diskio::convert_token(val_real, str,  N ) && convert_okay; }
+  if(str2 != nullptr)  { convert_okay = diskio::convert_token(val_imag, str2, N2) && convert_okay; }
+  
+  val = std::complex<T>(val_real, val_imag);
+  
+  return convert_okay;
+  }
+
+
+
+//! @}
@@ -0,0 +1,88 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2026 Dirk Eddelbuettel
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// https://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+
+//! \addtogroup block_writer
+//! @{
+
+
+//! Write a large matrix to a file as a sequence of appended blocks.
+//! csv_ascii and raw_ascii: blocks of rows;
+//! arma_binary and coord_ascii: blocks of columns;
+//! raw_binary: the elements of each block in column-major order.
+//! The file is written under a temporary name and renamed by .close().
+//! When std::mutex support is enabled, each block is written by a background thread while the next block is computed.
+template<typename eT>
+class block_writer
+  {
+  public:
+  
+  typedef eT elem_type;
+  
+  inline ~block_writer();
+  inline  block_writer();
+  
+  inline block_writer(const std::string& name, const file_type type);
+  inline block_writer(const csv_name&    spec, const file_type type);
+  
+  block_writer(const block_writer&)            = delete;
+  block_writer& operator=(const block_writer&) = delete;
+  
+  inline bool open(const std::string& name, const file_type type);
+  inline bool open(const csv_name&    spec, const file_type type);
+  
+  template<typename T1> inline bool append(const Base<eT,T1>& X);
+  
+  inline bool close();
+  
+  arma_warn_unused inline bool  is_open()   const;
+  arma_warn_unused inline bool  good()      const;
+  arma_warn_unused inline uword n_written() const;
+  
+  
+  private:
+  
+  std::ofstream f;
+  std::string   name;
+  std::string   tmp_name;
+  
+  file_type type      = file_type_unknown;
+  char      separator = ',';
+  
+  bool  failed    = false;
+  uword n_header  = 0;  //!< number of tokens in the CSV header
+  uword f_n_rows  = 0;  //!< number of rows of the blocks (arma_binary, coord_ascii)
+  uword f_n_cols  = 0;  //!< number of columns of the blocks (csv_ascii, raw_ascii)
+  uword pos       = 0;  //!< number of rows, columns or elements written
+  bool  last_zero = false;
+  
+  Mat<eT> behind;
+  
+  #if defined(ARMA_USE_STD_MUTEX)
+    std::future<bool> pending;
+  #endif
+  
+  inline bool open_internal(const file_type type, const field<std::string>* header);
+  
+  inline bool write_block(const Mat<eT>& X, const uword col_offset);
+  inline bool write_bin_sizes();
+  inline bool wait();
+  };
+
+
+
+//! @}
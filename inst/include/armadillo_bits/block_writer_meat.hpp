@@ -0,0 +1,438 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2026 Dirk Eddelbuettel
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// https://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+
+//! \addtogroup block_writer
+//! @{
+
+
+
+template<typename eT>
+inline
+block_writer<eT>::~block_writer()
+  {
+  arma_debug_sigprint_this(this);
+  
+  close();
+  }
+
+
+
+template<typename eT>
+inline
+block_writer<eT>::block_writer()
+  {
+  arma_debug_sigprint_this(this);
+  }
+
+
+
+template<typename eT>
+inline
+block_writer<eT>::block_writer(const std::string& in_name, const file_type in_type)
+  {
+  arma_debug_sigprint_this(this);
+  
+  if(open(in_name, in_type) == false)
+    {
+    arma_stop_runtime_error("block_writer::block_writer(): couldn't open file");
+    }
+  }
+
+
+
+template<typename eT>
+inline
+block_writer<eT>::block_writer(const csv_name& spec, const file_type in_type)
+  {
+  arma_debug_sigprint_this(this);
+  
+  if(open(spec, in_type) == false)
+    {
+    arma_stop_runtime_error("block_writer::block_writer(): couldn't open file");
+    }
+  }
+
+
+
+template<typename eT>
+inline
+bool
+block_writer<eT>::open(const std::string& in_name, const file_type in_type)
+  {
+  arma_debug_sigprint();
+  
+  close();
+  
+  name      = in_name;
+  separator = (in_type == ssv_ascii) ? char(';') : char(',');
+  
+  return open_internal(in_type, nullptr);
+  }
+
+
+
+template<typename eT>
+inline
+bool
+block_writer<eT>::open(const csv_name& spec, const file_type in_type)
+  {
+  arma_debug_sigprint();
+  
+  if( (in_type != csv_ascii) && (in_type != ssv_ascii) )
+    {
+    arma_stop_runtime_error("block_writer::open(): unsupported file type for csv_name()");
+    return false;
+    }
+  
+  close();
+  
+  const bool do_trans      = bool(spec.opts.flags & csv_opts::flag_trans      );
+  const bool no_header     = bool(spec.opts.flags & csv_opts::flag_no_header  );
+  const bool with_header   = bool(spec.opts.flags & csv_opts::flag_with_header) && (no_header == false);
+  const bool use_semicolon = bool(spec.opts.flags & csv_opts::flag_semicolon  ) || (in_type == ssv_ascii);
+  
+  if(do_trans)
+    {
+    arma_warn(1, "block_writer::open(): csv_opts::trans is not supported");
+    return false;
+    }
+  
+  name      = spec.filename;
+  separator = (use_semicolon) ? char(';') : char(',');
+  
+  if(with_header)
+    {
+    if( (spec.header_ro.n_cols != 1) && (spec.header_ro.n_rows != 1) )
+      {
+      arma_warn(1, "block_writer::open(): given header must have a vector layout");
+      return false;
+      }
+    
+    for(uword i=0; i < spec.header_ro.n_elem; ++i)
+      {
+      const std::string& token = spec.header_ro.at(i);
+      
+      if(token.find(separator) != std::string::npos)
+        {
+        arma_warn(1, "block_writer::open(): token within the header contains the separator character: '", token, "'");
+        return false;
+        }
+      }
+    }
+  
+  return open_internal(in_type, (with_header) ? &(spec.header_ro) : nullptr);
+  }
+
+
+
+template<typename eT>
+inline
+bool
+block_writer<eT>::open_internal(const file_type in_type, const field<std::string>* header)
+  {
+  arma_debug_sigprint();
+  
+  type = (in_type == ssv_ascii) ? csv_ascii : in_type;
+  
+  const bool is_text = (type == csv_ascii) || (type == raw_ascii) || (type == coord_ascii);
+  const bool is_bin  = (type == raw_binary) || (type == arma_binary);
+  
+  if( (is_text == false) && (is_bin == false) )
+    {
+    arma_warn(1, "block_writer::open(): unsupported file type");
+    return false;
+    }
+  
+  tmp_name = diskio::gen_tmp_name(name);
+  
+  (is_text && (arma_config::text_as_binary == false)) ? f.open(tmp_name) : f.open(tmp_name, std::fstream::binary);
+  
+  if(f.is_open() == false)  { return false; }
+  
+  if(header != nullptr)
+    {
+    n_header = header->n_elem;
+    
+    for(uword i=0; i < n_header; ++i)
+      {
+      f << header->at(i);
+      
+      if(i != (n_header-1))  { f.put(separator); }
+      }
+    
+    f.put('\n');
+    }
+  
+  // space for the sizes is reserved here and filled in by close()
+  if(type == arma_binary)  { write_bin_sizes(); }
+  
+  if(f.good() == false)
+    {
+    f.close();
+    
+    std::remove(tmp_name.c_str());
+    
+    return false;
+    }
+  
+  return true;
+  }
+
+
+
+template<typename eT>
+template<typename T1>
+inline
+bool
+block_writer<eT>::append(const Base<eT,T1>& X)
+  {
+  arma_debug_sigprint();
+  
+  if( (f.is_open() == false) || failed )  { return false; }
+  
+  const quasi_unwrap<T1> U(X.get_ref());
+  const Mat<eT>& A     = U.M;
+  
+  if( (type == csv_ascii) || (type == raw_ascii) )
+    {
+    if( (pos > 0) && (A.n_cols != f_n_cols) )
+      {
+      arma_warn(1, "block_writer::append(): number of columns differs from previous blocks");
+      return false;
+      }
+    
+    if( (n_header > 0) && (A.n_cols != n_header) )
+      {
+      arma_warn(1, "block_writer::append(): size mismatch between header and matrix");
+      return false;
+      }
+    
+    f_n_cols = A.n_cols;
+    }
+  else
+  if( (type == arma_binary) || (type == coord_ascii) )
+    {
+    if( (pos > 0) && (A.n_rows != f_n_rows) )
+      {
+      arma_warn(1, "block_writer::append(): number of rows differs from previous blocks");
+      return false;
+      }
+    
+    f_n_rows = A.n_rows;
+    }
+  
+  const uword col_offset = pos;
+  
+       if( (type == csv_ascii ) || (type == raw_ascii  ) )  { pos += A.n_rows; }
+  else if( (type == arma_binary) || (type == coord_ascii) )  { pos += A.n_cols; }
+  else                                                       { pos += A.n_elem; }
+  
+  if(A.n_elem > 0)  { last_zero = (A.at(A.n_rows-1, A.n_cols-1) == eT(0)); }
+  
+  #if defined(ARMA_USE_STD_MUTEX)
+    {
+    if(wait() == false)  { return false; }
+    
+    behind = A;
+    
+    // the background thread only accesses the file stream and the write-behind buffer
+    
+    try
+      {
+      pending = std::async(std::launch::async, [this, col_offset]() { return (*this).write_block(behind, col_offset); });
+      
+      return true;
+      }
+    catch(...)
+      {
+      }
+    }
+  #endif
+  
+  if(write_block(A, col_offset) == false)  { failed = true; }
+  
+  return (failed == false);
+  }
+
+
+
+//! finish writing and rename the temporary file to the final name;
+//! returns false if any block couldn't be written
+template<typename eT>
+inline
+bool
+block_writer<eT>::close()
+  {
+  arma_debug_sigprint();
+  
+  if(f.is_open() == false)  { return false; }
+  
+  bool save_okay = wait();
+  
+  if(save_okay)
+    {
+    if(type == arma_binary)
+      {
+      f.seekp(0, std::ios::beg);
+      
+      write_bin_sizes();
+      }
+    
+    if( (type == coord_ascii) && last_zero && (f_n_rows > 0) && (pos > 0) )
+      {
+      // make sure it's possible to determine the matrix size
+      f << (f_n_rows-1) << ' ' << (pos-1) << ((is_cx<eT>::yes) ? " 0 0\n" : " 0\n");
+      }
+    
+    f.flush();
+    
+    save_okay = f.good();
+    }
+  
+  f.close();
+  
+  if(save_okay)
+    {
+    save_okay = diskio::safe_rename(tmp_name, name);
+    }
+  else
+    {
+    std::remove(tmp_name.c_str());
+    }
+  
+  name.clear();
+  tmp_name.clear();
+  
+  type      = file_type_unknown;
+  separator = ',';
+  failed    = false;
+  n_header  = 0;
+  f_n_rows  = 0;
+  f_n_cols  = 0;
+  pos       = 0;
+  last_zero = false;
+  
+  behind.reset();
+  
+  return save_okay;
+  }
+
+
+
+template<typename eT>
+inline
+bool
+block_writer<eT>::is_open() const
+  {
+  return f.is_open();
+  }
+
+
+
+template<typename eT>
+inline
+bool
+block_writer<eT>::good() const
+  {
+  return (failed == false);
+  }
+
+
+
+//! number of rows (csv_ascii, raw_ascii), columns (arma_binary, coord_ascii) or elements (raw_binary) appended so far
+template<typename eT>
+inline
+uword
+block_writer<eT>::n_written() const
+  {
+  return pos;
+  }
+
+
+
+template<typename eT>
+inline
+bool
+block_writer<eT>::write_block(const Mat<eT>& X, const uword col_offset)
+  {
+  arma_debug_sigprint();
+  
+  switch(type)
+    {
+    case csv_ascii:
+      return diskio::save_csv_ascii(X, f, separator);
+    
+    case raw_ascii:
+      return diskio::save_raw_ascii(X, f);
+    
+    case coord_ascii:
+      return diskio::save_coord_ascii(X, f, col_offset, false);
+    
+    case raw_binary:
+    case arma_binary:
+      return diskio::save_raw_binary(X, f);
+    
+    default:
+      return false;
+    }
+  }
+
+
+
+//! write the header of an arma_binary file, with fixed-width sizes so that it can be rewritten in place
+template<typename eT>
+inline
+bool
+block_writer<eT>::write_bin_sizes()
+  {
+  arma_debug_sigprint();
+  
+  std::ostringstream sizes;
+  
+  sizes.width(20);  sizes << f_n_rows;
+  sizes.put(' ');
+  sizes.width(20);  sizes << pos;
+  
+  diskio::write_bin_header(f, diskio::gen_bin_header(Mat<eT>()), sizes.str());
+  
+  return f.good();
+  }
+
+
+
+//! wait for the previous block to be written
+template<typename eT>
+inline
+bool
+block_writer<eT>::wait()
+  {
+  #if defined(ARMA_USE_STD_MUTEX)
+    {
+    if(pending.valid())
+      {
+      if(pending.get() == false)  { failed = true; }
+      }
+    }
+  #endif
+  
+  return (failed == false);
+  }
+
+
+
+//! @}
@@ -109,6 +109,13 @@
   #define ARMA_HAVE_POSIX_MEMALIGN
 #endif
 
+// mmap() is used for reading files;
+// it is part of IEEE standard 1003.1, where its availability is indicated by _POSIX_MAPPED_FILES
+#if ( defined(_POSIX_MAPPED_FILES) && (_POSIX_MAPPED_FILES > 0) ) && !defined(ARMA_DONT_USE_MMAP)
+  #undef  ARMA_HAVE_MMAP
+  #define ARMA_HAVE_MMAP
+#endif
+
 
 #if defined(__APPLE__) || defined(__apple_build_version__)
   // NOTE: Apple accelerate framework has broken implementations of functions that return a float value,
@@ -123,6 +130,7 @@
 
 #if defined(__MINGW32__) || defined(__CYGWIN__) || defined(_MSC_VER)
   #undef ARMA_HAVE_POSIX_MEMALIGN
+  #undef ARMA_HAVE_MMAP
 #endif
 
 
@@ -177,6 +177,36 @@
   //// Comment out the above line to disable optimised handling of pow()
 #endif
 
+#if !defined(ARMA_OPTIMISE_VECMATH)
+  // #define ARMA_OPTIMISE_VECMATH
+  //// Uncomment the above line to enable vectorised evaluation of exp() and log() (max error of 2 ulp and 1 ulp);
+  //// this is only faster when compiling for an instruction set with wide vectors (eg. -march=native)
+#endif
+
+#if !defined(ARMA_OPTIMISE_SPCACHE)
+  // #define ARMA_OPTIMISE_SPCACHE
+  //// Uncomment the above line to store the element cache of sparse matrices in a sorted array
+  //// combined with a hash table instead of std::map
+#endif
+
+#if !defined(ARMA_OPTIMISE_FFT)
+  #define ARMA_OPTIMISE_FFT
+  //// Comment out the above line to restrict the built-in FFT engine to the original
+  //// radix 2, 3, 4, 5 and generic butterflies, without Bluestein's algorithm for large prime factors
+#endif
+
+#if !defined(ARMA_OPTIMISE_CONV)
+  // #define ARMA_OPTIMISE_CONV
+  //// Uncomment the above line to use FFT-based evaluation in conv() and conv2() for long signals and large filters,
+  //// instead of direct evaluation; the results then have rounding errors relative to the largest output values
+#endif
+
+#if !defined(ARMA_OPTIMISE_KMEANS)
+  #define ARMA_OPTIMISE_KMEANS
+  //// Comment out the above line to evaluate the distances from each sample to all means
+  //// in every k-means iteration, instead of pruning via the triangle inequality
+#endif
+
 #if !defined(ARMA_CHECK_CONFORMANCE)
   #define ARMA_CHECK_CONFORMANCE
   //// Comment out the above line to disable conformance checks for bounds and size.
@@ -330,6 +360,26 @@
   #undef ARMA_OPTIMISE_POWEXPR
 #endif
 
+#if defined(ARMA_DONT_OPTIMISE_VECMATH)
+  #undef ARMA_OPTIMISE_VECMATH
+#endif
+
+#if defined(ARMA_DONT_OPTIMISE_SPCACHE)
+  #undef ARMA_OPTIMISE_SPCACHE
+#endif
+
+#if defined(ARMA_DONT_OPTIMISE_FFT)
+  #undef ARMA_OPTIMISE_FFT
+#endif
+
+#if defined(ARMA_DONT_OPTIMISE_CONV)
+  #undef ARMA_OPTIMISE_CONV
+#endif
+
+#if defined(ARMA_DONT_OPTIMISE_KMEANS)
+  #undef ARMA_OPTIMISE_KMEANS
+#endif
+
 #if defined(ARMA_NO_DEBUG)
   #undef ARMA_DEBUG
   #undef ARMA_EXTRA_DEBUG
@@ -33,6 +33,10 @@ struct diskio
   template<typename eT> friend class SpMat;
   template<typename oT> friend class field;
   
+  template<typename T1> friend class mmap_obj;
+  template<typename eT> friend class block_reader;
+  template<typename eT> friend class block_writer;
+  
   friend class   Mat_aux;
   friend class  Cube_aux;
   friend class SpMat_aux;
@@ -46,6 +50,22 @@ struct diskio
   template<typename eT> arma_cold inline static std::string gen_txt_header(const Cube<eT>&);
   template<typename eT> arma_cold inline static std::string gen_bin_header(const Cube<eT>&);
   
+  arma_cold inline static void write_bin_header(std::ostream& f, const std::string& header, const std::string& sizes);
+  
+  template<typename T1> arma_cold inline static std::string gen_zbin_header(const T1& x);
+  
+  static constexpr uword zbin_block_elems     = uword(65536);
+  static constexpr uword zbin_max_block_elems = uword(1) << 24;
+  
+  template<typename eT> inline static void zbin_filter  (unsigned char* out, const eT* in, const uword n_elem);
+  template<typename eT> inline static void zbin_unfilter(eT* out, const unsigned char* in, const uword n_elem);
+  
+  inline static uword zbin_rle_encode(unsigned char* out, const unsigned char* in, const uword n_bytes);
+  inline static bool  zbin_rle_decode(unsigned char* out, const uword n_bytes, const unsigned char* in, const uword in_n_bytes);
+  
+  template<typename eT> inline static bool save_zbin_array(const eT* mem, const uword n_elem, std::ostream& f);
+  template<typename eT> inline static bool load_zbin_array(      eT* mem, const uword n_elem, const uword block_elems, std::istream& f, std::string& err_msg);
+  
   arma_cold inline static file_type guess_file_type_internal(std::istream& f);
   
   arma_cold inline static std::string gen_tmp_name(const std::string& x);
@@ -61,6 +81,16 @@ struct diskio
   
   template<typename eT> inline static bool convert_token_strict(eT& val, const std::string& token);
   
+  template<typename eT> inline static bool convert_token(eT&              val, const char* str, const uword N);
+  template<typename  T> inline static bool convert_token(std::complex<T>& val, const char* str, const uword N);
+  
+  template<typename eT> inline static bool convert_token_strict(eT& val, const char* str, const uword N);
+  
+  arma_cold inline static void load_csv_header(field<std::string>& header, const std::string& header_line, const char separator);
+  
+  inline static uword mem_n_chunks(const uword n_bytes);
+  inline static void  mem_chunks(std::vector<uword>& chunk_start, const char* mem, const uword n_bytes);
+  
   template<typename eT> inline static std::streamsize prepare_stream(std::ostream& f);
   
   template<typename eT> inline static constexpr eT real_as_int_lower_limit();
@@ -76,6 +106,7 @@ struct diskio
   template<typename eT> inline static bool save_csv_ascii  (const Mat<eT>&                x, const std::string& final_name, const field<std::string>& header, const bool with_header, const char separator);
   template<typename eT> inline static bool save_coord_ascii(const Mat<eT>&                x, const std::string& final_name);
   template<typename eT> inline static bool save_arma_binary(const Mat<eT>&                x, const std::string& final_name);
+  template<typename eT> inline static bool save_arma_zbinary(const Mat<eT>&               x, const std::string& final_name);
   template<typename eT> inline static bool save_pgm_binary (const Mat<eT>&                x, const std::string& final_name);
   template<typename  T> inline static bool save_pgm_binary (const Mat< std::complex<T> >& x, const std::string& final_name);
   template<typename eT> inline static bool save_hdf5_binary(const Mat<eT>&                x, const   hdf5_name& spec, std::string& err_msg);
@@ -85,9 +116,10 @@ struct diskio
   template<typename eT> inline static bool save_arma_ascii (const Mat<eT>&                x, std::ostream& f);
   template<typename eT> inline static bool save_csv_ascii  (const Mat<eT>&                x, std::ostream& f, const char separator);
   template<typename  T> inline static bool save_csv_ascii  (const Mat< std::complex<T> >& x, std::ostream& f, const char separator);
-  template<typename eT> inline static bool save_coord_ascii(const Mat<eT>&                x, std::ostream& f);
-  template<typename  T> inline static bool save_coord_ascii(const Mat< std::complex<T> >& x, std::ostream& f);
+  template<typename eT> inline static bool save_coord_ascii(const Mat<eT>&                x, std::ostream& f, const uword col_offset = 0, const bool with_size = true);
+  template<typename  T> inline static bool save_coord_ascii(const Mat< std::complex<T> >& x, std::ostream& f, const uword col_offset = 0, const bool with_size = true);
   template<typename eT> inline static bool save_arma_binary(const Mat<eT>&                x, std::ostream& f);
+  template<typename eT> inline static bool save_arma_zbinary(const Mat<eT>&               x, std::ostream& f);
   template<typename eT> inline static bool save_pgm_binary (const Mat<eT>&                x, std::ostream& f);
   template<typename  T> inline static bool save_pgm_binary (const Mat< std::complex<T> >& x, std::ostream& f);
   
@@ -101,6 +133,7 @@ struct diskio
   template<typename eT> inline static bool load_csv_ascii  (Mat<eT>&                x, const std::string& name, std::string& err_msg, field<std::string>& header, const bool with_header, const char separator, const bool strict);
   template<typename eT> inline static bool load_coord_ascii(Mat<eT>&                x, const std::string& name, std::string& err_msg);
   template<typename eT> inline static bool load_arma_binary(Mat<eT>&                x, const std::string& name, std::string& err_msg);
+  template<typename eT> inline static bool load_arma_zbinary(Mat<eT>&               x, const std::string& name, std::string& err_msg);
   template<typename eT> inline static bool load_pgm_binary (Mat<eT>&                x, const std::string& name, std::string& err_msg);
   template<typename  T> inline static bool load_pgm_binary (Mat< std::complex<T> >& x, const std::string& name, std::string& err_msg);
   template<typename eT> inline static bool load_hdf5_binary(Mat<eT>&                x, const   hdf5_name& spec, std::string& err_msg);
@@ -112,8 +145,12 @@ struct diskio
   template<typename eT> inline static bool load_csv_ascii  (Mat<eT>&                x, std::istream& f,  std::string& err_msg, const char separator, const bool strict);
   template<typename  T> inline static bool load_csv_ascii  (Mat< std::complex<T> >& x, std::istream& f,  std::string& err_msg, const char separator, const bool strict);
   template<typename eT> inline static bool load_coord_ascii(Mat<eT>&                x, std::istream& f,  std::string& err_msg);
+  
+  template<typename eT> inline static bool load_raw_ascii  (Mat<eT>&                x, const char* mem, const uword n_bytes, std::string& err_msg);
+  template<typename eT> inline static bool load_csv_ascii  (Mat<eT>&                x, const char* mem, const uword n_bytes, std::string& err_msg, const char separator, const bool strict);
   template<typename  T> inline static bool load_coord_ascii(Mat< std::complex<T> >& x, std::istream& f,  std::string& err_msg);
   template<typename eT> inline static bool load_arma_binary(Mat<eT>&                x, std::istream& f,  std::string& err_msg);
+  template<typename eT> inline static bool load_arma_zbinary(Mat<eT>&               x, std::istream& f,  std::string& err_msg);
   template<typename eT> inline static bool load_pgm_binary (Mat<eT>&                x, std::istream& is, std::string& err_msg);
   template<typename  T> inline static bool load_pgm_binary (Mat< std::complex<T> >& x, std::istream& is, std::string& err_msg);
   template<typename eT> inline static bool load_auto_detect(Mat<eT>&                x, std::istream& f,  std::string& err_msg);
@@ -127,12 +164,14 @@ struct diskio
   template<typename eT> inline static bool save_csv_ascii  (const SpMat<eT>& x, const std::string& final_name, const field<std::string>& header, const bool with_header, const char separator);
   template<typename eT> inline static bool save_coord_ascii(const SpMat<eT>& x, const std::string& final_name);
   template<typename eT> inline static bool save_arma_binary(const SpMat<eT>& x, const std::string& final_name);
+  template<typename eT> inline static bool save_arma_zbinary(const SpMat<eT>& x, const std::string& final_name);
   
   template<typename eT> inline static bool save_csv_ascii  (const SpMat<eT>& x,                std::ostream& f, const char separator);
   template<typename  T> inline static bool save_csv_ascii  (const SpMat< std::complex<T> >& x, std::ostream& f, const char separator);
   template<typename eT> inline static bool save_coord_ascii(const SpMat<eT>& x,                std::ostream& f);
   template<typename  T> inline static bool save_coord_ascii(const SpMat< std::complex<T> >& x, std::ostream& f);
   template<typename eT> inline static bool save_arma_binary(const SpMat<eT>& x,                std::ostream& f);
+  template<typename eT> inline static bool save_arma_zbinary(const SpMat<eT>& x,               std::ostream& f);
   
   
   //
@@ -141,12 +180,14 @@ struct diskio
   template<typename eT> inline static bool load_csv_ascii  (SpMat<eT>& x, const std::string& name, std::string& err_msg, field<std::string>& header, const bool with_header, const char separator);
   template<typename eT> inline static bool load_coord_ascii(SpMat<eT>& x, const std::string& name, std::string& err_msg);
   template<typename eT> inline static bool load_arma_binary(SpMat<eT>& x, const std::string& name, std::string& err_msg);
+  template<typename eT> inline static bool load_arma_zbinary(SpMat<eT>& x, const std::string& name, std::string& err_msg);
   
   template<typename eT> inline static bool load_csv_ascii  (SpMat<eT>& x,                std::istream& f, std::string& err_msg, const char separator);
   template<typename  T> inline static bool load_csv_ascii  (SpMat< std::complex<T> >& x, std::istream& f, std::string& err_msg, const char separator);
   template<typename eT> inline static bool load_coord_ascii(SpMat<eT>& x,                std::istream& f, std::string& err_msg);
   template<typename  T> inline static bool load_coord_ascii(SpMat< std::complex<T> >& x, std::istream& f, std::string& err_msg);
   template<typename eT> inline static bool load_arma_binary(SpMat<eT>& x,                std::istream& f, std::string& err_msg);
+  template<typename eT> inline static bool load_arma_zbinary(SpMat<eT>& x,               std::istream& f, std::string& err_msg);
   
   
   
@@ -157,12 +198,14 @@ struct diskio
   template<typename eT> inline static bool save_raw_binary (const Cube<eT>& x, const std::string& name);
   template<typename eT> inline static bool save_arma_ascii (const Cube<eT>& x, const std::string& name);
   template<typename eT> inline static bool save_arma_binary(const Cube<eT>& x, const std::string& name);
+  template<typename eT> inline static bool save_arma_zbinary(const Cube<eT>& x, const std::string& name);
   template<typename eT> inline static bool save_hdf5_binary(const Cube<eT>& x, const   hdf5_name& spec, std::string& err_msg);
   
   template<typename eT> inline static bool save_raw_ascii  (const Cube<eT>& x, std::ostream& f);
   template<typename eT> inline static bool save_raw_binary (const Cube<eT>& x, std::ostream& f);
   template<typename eT> inline static bool save_arma_ascii (const Cube<eT>& x, std::ostream& f);
   template<typename eT> inline static bool save_arma_binary(const Cube<eT>& x, std::ostream& f);
+  template<typename eT> inline static bool save_arma_zbinary(const Cube<eT>& x, std::ostream& f);
   
   
   //
@@ -172,6 +215,7 @@ struct diskio
   template<typename eT> inline static bool load_raw_binary (Cube<eT>& x, const std::string& name, std::string& err_msg);
   template<typename eT> inline static bool load_arma_ascii (Cube<eT>& x, const std::string& name, std::string& err_msg);
   template<typename eT> inline static bool load_arma_binary(Cube<eT>& x, const std::string& name, std::string& err_msg);
+  template<typename eT> inline static bool load_arma_zbinary(Cube<eT>& x, const std::string& name, std::string& err_msg);
   template<typename eT> inline static bool load_hdf5_binary(Cube<eT>& x, const   hdf5_name& spec, std::string& err_msg);
   template<typename eT> inline static bool load_auto_detect(Cube<eT>& x, const std::string& name, std::string& err_msg);
   
@@ -179,6 +223,7 @@ struct diskio
   template<typename eT> inline static bool load_raw_binary (Cube<eT>& x, std::istream& f, std::string& err_msg);
   template<typename eT> inline static bool load_arma_ascii (Cube<eT>& x, std::istream& f, std::string& err_msg);
   template<typename eT> inline static bool load_arma_binary(Cube<eT>& x, std::istream& f, std::string& err_msg);
+  template<typename eT> inline static bool load_arma_zbinary(Cube<eT>& x, std::istream& f, std::string& err_msg);
   template<typename eT> inline static bool load_auto_detect(Cube<eT>& x, std::istream& f, std::string& err_msg);
   
   
@@ -188,9 +233,15 @@ struct diskio
   template<typename T1> inline static bool save_arma_binary(const field<T1>& x, const std::string&  name);
   template<typename T1> inline static bool save_arma_binary(const field<T1>& x,       std::ostream& f);
   
+  template<typename T1> inline static bool save_arma_zbinary(const field<T1>& x, const std::string&  name);
+  template<typename T1> inline static bool save_arma_zbinary(const field<T1>& x,       std::ostream& f);
+  
   template<typename T1> inline static bool load_arma_binary(      field<T1>& x, const std::string&  name, std::string& err_msg);
   template<typename T1> inline static bool load_arma_binary(      field<T1>& x,       std::istream& f,    std::string& err_msg);
   
+  template<typename T1> inline static bool load_arma_zbinary(      field<T1>& x, const std::string&  name, std::string& err_msg);
+  template<typename T1> inline static bool load_arma_zbinary(      field<T1>& x,       std::istream& f,    std::string& err_msg);
+  
   template<typename T1> inline static bool load_auto_detect(      field<T1>& x, const std::string&  name, std::string& err_msg);
   template<typename T1> inline static bool load_auto_detect(      field<T1>& x,       std::istream& f,    std::string& err_msg);
   
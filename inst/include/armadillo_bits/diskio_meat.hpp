@@ -284,6 +284,481 @@ diskio::gen_bin_header(const Cube<eT>&)
 
 
 
+//! Write the header and size lines of an arma_binary file.
+//! The size line is prefixed with spaces (skipped when loading) so that the data starts
+//! at a multiple of 16 bytes, allowing memory-mapped files to be used without copying (see mmap_obj).
+inline
+void
+diskio::write_bin_header(std::ostream& f, const std::string& header, const std::string& sizes)
+  {
+  arma_debug_sigprint();
+  
+  const uword n_chars = uword(header.length() + sizes.length() + 2);
+  const uword n_pad   = (16 - (n_chars % 16)) % 16;
+  
+  f << header << '\n';
+  
+  if(n_pad > 0)  { f << std::string(n_pad, ' '); }
+  
+  f << sizes << '\n';
+  }
+
+
+
+//! Generate the header of an arma_zbinary file, eg. "ARMA_MAT_ZBN_FN008"
+template<typename T1>
+inline
+std::string
+diskio::gen_zbin_header(const T1& x)
+  {
+  arma_debug_sigprint();
+  
+  std::string header = diskio::gen_bin_header(x);
+  
+  header.replace(9, 3, "ZBN");
+  
+  return header;
+  }
+
+
+
+//! Rearrange the elements of a block so that it compresses well:
+//! byte j of every element is gathered into the j-th byte plane (complex numbers are treated as pairs of real numbers),
+//! and for integer types each byte plane is replaced by its successive differences (modulo 256).
+template<typename eT>
+inline
+void
+diskio::zbin_filter(unsigned char* out, const eT* in, const uword n_elem)
+  {
+  typedef typename get_pod_type<eT>::result T;
+  
+  constexpr uword width = uword(sizeof(T));
+  
+  const uword n_lanes = n_elem * uword(sizeof(eT) / sizeof(T));
+  
+  const unsigned char* in_bytes = reinterpret_cast<const unsigned char*>(in);
+  
+  for(uword b=0; b < width; ++b)
+    {
+    unsigned char* plane = out + b*n_lanes;
+    
+    if(std::is_integral<eT>::value)
+      {
+      unsigned char prev = 0;
+      
+      for(uword i=0; i < n_lanes; ++i)
+        {
+        const unsigned char val = in_bytes[i*width + b];
+        
+        plane[i] = static_cast<unsigned char>(val - prev);
+        
+        prev = val;
+        }
+      }
+    else
+      {
+      for(uword i=0; i < n_lanes; ++i)  { plane[i] = in_bytes[i*width + b]; }
+      }
+    }
+  }
+
+
+
+//! Inverse of zbin_filter()
+template<typename eT>
+inline
+void
+diskio::zbin_unfilter(eT* out, const unsigned char* in, const uword n_elem)
+  {
+  typedef typename get_pod_type<eT>::result T;
+  
+  constexpr uword width = uword(sizeof(T));
+  
+  const uword n_lanes = n_elem * uword(sizeof(eT) / sizeof(T));
+  
+  unsigned char* out_bytes = reinterpret_cast<unsigned char*>(out);
+  
+  for(uword b=0; b < width; ++b)
+    {
+    const unsigned char* plane = in + b*n_lanes;
+    
+    if(std::is_integral<eT>::value)
+      {
+      unsigned char acc = 0;
+      
+      for(uword i=0; i < n_lanes; ++i)
+        {
+        acc = static_cast<unsigned char>(acc + plane[i]);
+        
+        out_bytes[i*width + b] = acc;
+        }
+      }
+    else
+      {
+      for(uword i=0; i < n_lanes; ++i)  { out_bytes[i*width + b] = plane[i]; }
+      }
+    }
+  }
+
+
+
+//! Run-length encoding of bytes.
+//! A control byte c < 128 is followed by c+1 literal bytes;
+//! a control byte c >= 128 denotes a run of (c & 127) + 3 copies of the byte that follows,
+//! where (c & 127) == 127 indicates that the run length is extended by a subsequent base-128 varint.
+//! Returns the size of the encoded data, or 0 if the encoded data would not be smaller than the input.
+inline
+uword
+diskio::zbin_rle_encode(unsigned char* out, const unsigned char* in, const uword n_bytes)
+  {
+  uword out_pos   = 0;
+  uword lit_start = 0;
+  
+  const auto put_literals = [&](const uword lit_end) -> bool
+    {
+    while(lit_start < lit_end)
+      {
+      const uword len = (std::min)(lit_end - lit_start, uword(128));
+      
+      if( (out_pos + 1 + len) >= n_bytes )  { return false; }
+      
+      out[out_pos] = static_cast<unsigned char>(len - 1);
+      
+      std::memcpy(out + out_pos + 1, in + lit_start, size_t(len));
+      
+      out_pos   += len + 1;
+      lit_start += len;
+      }
+    
+    return true;
+    };
+  
+  uword i = 0;
+  
+  while(i < n_bytes)
+    {
+    const unsigned char val = in[i];
+    
+    uword j = i + 1;
+    
+    while( (j < n_bytes) && (in[j] == val) )  { ++j; }
+    
+    if( (j - i) >= 3 )
+      {
+      if(put_literals(i) == false)  { return 0; }
+      
+      // control byte, varint extension (at most 10 bytes) and the repeated byte
+      if( (out_pos + 12) >= n_bytes )  { return 0; }
+      
+      const uword extra = (j - i) - 3;
+      
+      if(extra < 127)
+        {
+        out[out_pos++] = static_cast<unsigned char>(0x80 | extra);
+        }
+      else
+        {
+        out[out_pos++] = 0xFF;
+        
+        uword rem = extra - 127;
+        
+        while(rem >= 128)  { out[out_pos++] = static_cast<unsigned char>(0x80 | (rem & 0x7F)); rem >>= 7; }
+        
+        out[out_pos++] = static_cast<unsigned char>(rem);
+        }
+      
+      out[out_pos++] = val;
+      
+      lit_start = j;
+      }
+    
+    i = j;
+    }
+  
+  if(put_literals(n_bytes) == false)  { return 0; }
+  
+  return out_pos;
+  }
+
+
+
+//! Inverse of zbin_rle_encode(); returns false if the encoded data is malformed or does not decode to exactly n_bytes
+inline
+bool
+diskio::zbin_rle_decode(unsigned char* out, const uword n_bytes, const unsigned char* in, const uword in_n_bytes)
+  {
+  uword out_pos = 0;
+  uword in_pos  = 0;
+  
+  while(in_pos < in_n_bytes)
+    {
+    const uword c = in[in_pos++];
+    
+    if(c < 128)
+      {
+      const uword len = c + 1;
+      
+      if( (len > (in_n_bytes - in_pos)) || (len > (n_bytes - out_pos)) )  { return false; }
+      
+      std::memcpy(out + out_pos, in + in_pos, size_t(len));
+      
+      out_pos += len;
+      in_pos  += len;
+      }
+    else
+      {
+      uword len = (c & 0x7F) + 3;
+      
+      if((c & 0x7F) == 0x7F)
+        {
+        uword shift = 0;
+        uword digit = 0x80;
+        
+        while(digit >= 0x80)
+          {
+          if( (in_pos >= in_n_bytes) || (shift >= uword(8*sizeof(uword) - 7)) )  { return false; }
+          
+          digit = in[in_pos++];
+          
+          len += (digit & 0x7F) << shift;
+          
+          shift += 7;
+          }
+        }
+      
+      if( (in_pos >= in_n_bytes) || (len > (n_bytes - out_pos)) )  { return false; }
+      
+      std::memset(out + out_pos, in[in_pos++], size_t(len));
+      
+      out_pos += len;
+      }
+    }
+  
+  return (out_pos == n_bytes);
+  }
+
+
+
+//! Write an array as a sequence of blocks of zbin_block_elems elements, each compressed independently.
+//! Every block is preceded by its compressed size (u32), and the first byte of each block indicates
+//! whether the block is stored verbatim (0) or filtered and run-length encoded (1).
+//! When OpenMP is enabled, groups of blocks are compressed in parallel.
+template<typename eT>
+inline
+bool
+diskio::save_zbin_array(const eT* mem, const uword n_elem, std::ostream& f)
+  {
+  arma_debug_sigprint();
+  
+  if(n_elem == 0)  { return f.good(); }
+  
+  const uword block_elems = diskio::zbin_block_elems;
+  const uword block_bytes = (std::min)(n_elem, block_elems) * uword(sizeof(eT));
+  const uword n_blocks    = (n_elem + block_elems - 1) / block_elems;
+  
+  uword n_group = 1;
+  
+  #if defined(ARMA_USE_OPENMP)
+    {
+    if( (n_blocks > 1) && (mp_thread_limit::in_parallel() == false) )  { n_group = (std::min)(n_blocks, uword(2 * mp_thread_limit::get())); }
+    }
+  #endif
+  
+  podarray<unsigned char> buf;
+  podarray<unsigned char> tmp;
+  podarray<u32>           buf_size;
+  
+  try
+    {
+    buf.set_size(n_group * (block_bytes + 1));
+    tmp.set_size(n_group *  block_bytes     );
+    buf_size.set_size(n_group);
+    }
+  catch(...)
+    {
+    return false;
+    }
+  
+  const auto encode_block = [&](const uword g, const uword block)
+    {
+    const uword start   = block * block_elems;
+    const uword count   = (std::min)(block_elems, n_elem - start);
+    const uword n_bytes = count * uword(sizeof(eT));
+    
+    unsigned char* out = buf.memptr() + g * (block_bytes + 1);
+    unsigned char* scr = tmp.memptr() + g *  block_bytes;
+    
+    diskio::zbin_filter(scr, mem + start, count);
+    
+    const uword n_coded = diskio::zbin_rle_encode(out + 1, scr, n_bytes);
+    
+    if(n_coded > 0)
+      {
+      out[0] = 1;
+      buf_size[g] = u32(n_coded + 1);
+      }
+    else
+      {
+      out[0] = 0;
+      std::memcpy(out + 1, mem + start, size_t(n_bytes));
+      buf_size[g] = u32(n_bytes + 1);
+      }
+    };
+  
+  for(uword block_start=0; block_start < n_blocks; block_start += n_group)
+    {
+    const uword n_in_group = (std::min)(n_group, n_blocks - block_start);
+    
+    if(n_in_group > 1)
+      {
+      #if defined(ARMA_USE_OPENMP)
+        {
+        const int n_threads = mp_thread_limit::get();
+        
+        #pragma omp parallel for schedule(dynamic) num_threads(n_threads)
+        for(uword g=0; g < n_in_group; ++g)  { encode_block(g, block_start + g); }
+        }
+      #endif
+      }
+    else
+      {
+      encode_block(0, block_start);
+      }
+    
+    for(uword g=0; g < n_in_group; ++g)
+      {
+      f.write( reinterpret_cast<const char*>(&(buf_size[g])), std::streamsize(sizeof(u32)) );
+      f.write( reinterpret_cast<const char*>(buf.memptr() + g * (block_bytes + 1)), std::streamsize(buf_size[g]) );
+      }
+    
+    if(f.good() == false)  { return false; }
+    }
+  
+  return f.good();
+  }
+
+
+
+//! Read an array written by save_zbin_array(); when OpenMP is enabled, groups of blocks are decompressed in parallel
+template<typename eT>
+inline
+bool
+diskio::load_zbin_array(eT* mem, const uword n_elem, const uword block_elems, std::istream& f, std::string& err_msg)
+  {
+  arma_debug_sigprint();
+  
+  if(n_elem == 0)  { return f.good(); }
+  
+  const uword max_block_elems = diskio::zbin_max_block_elems;
+  
+  if( (block_elems == 0) || (block_elems > max_block_elems) )  { err_msg = "incorrect header"; return false; }
+  
+  const uword block_bytes = (std::min)(n_elem, block_elems) * uword(sizeof(eT));
+  const uword n_blocks    = (n_elem + block_elems - 1) / block_elems;
+  
+  uword n_group = 1;
+  
+  #if defined(ARMA_USE_OPENMP)
+    {
+    if( (n_blocks > 1) && (mp_thread_limit::in_parallel() == false) )  { n_group = (std::min)(n_blocks, uword(2 * mp_thread_limit::get())); }
+    }
+  #endif
+  
+  podarray<unsigned char> buf;
+  podarray<unsigned char> tmp;
+  podarray<u32>           buf_size;
+  podarray<uword>         status;
+  
+  try
+    {
+    buf.set_size(n_group * (block_bytes + 1));
+    tmp.set_size(n_group *  block_bytes     );
+    buf_size.set_size(n_group);
+    status.set_size(n_group);
+    }
+  catch(...)
+    {
+    err_msg = "not enough memory";
+    return false;
+    }
+  
+  const auto decode_block = [&](const uword g, const uword block)
+    {
+    const uword start   = block * block_elems;
+    const uword count   = (std::min)(block_elems, n_elem - start);
+    const uword n_bytes = count * uword(sizeof(eT));
+    
+    const unsigned char* in = buf.memptr() + g * (block_bytes + 1);
+    
+    const uword in_n_bytes = uword(buf_size[g]) - 1;
+    
+    bool okay = false;
+    
+    if(in[0] == 0)
+      {
+      okay = (in_n_bytes == n_bytes);
+      
+      if(okay)  { std::memcpy(reinterpret_cast<void*>(mem + start), in + 1, size_t(n_bytes)); }
+      }
+    else
+    if(in[0] == 1)
+      {
+      unsigned char* scr = tmp.memptr() + g * block_bytes;
+      
+      okay = diskio::zbin_rle_decode(scr, n_bytes, in + 1, in_n_bytes);
+      
+      if(okay)  { diskio::zbin_unfilter(mem + start, scr, count); }
+      }
+    
+    status[g] = (okay) ? uword(1) : uword(0);
+    };
+  
+  for(uword block_start=0; block_start < n_blocks; block_start += n_group)
+    {
+    const uword n_in_group = (std::min)(n_group, n_blocks - block_start);
+    
+    for(uword g=0; g < n_in_group; ++g)
+      {
+      u32 size = 0;
+      
+      f.read( reinterpret_cast<char*>(&size), std::streamsize(sizeof(u32)) );
+      
+      if( (f.good() == false) || (size == 0) || (uword(size) > (block_bytes + 1)) )  { err_msg = "inconsistent data"; return false; }
+      
+      buf_size[g] = size;
+      
+      f.read( reinterpret_cast<char*>(buf.memptr() + g * (block_bytes + 1)), std::streamsize(size) );
+      
+      if(f.good() == false)  { err_msg = "inconsistent data"; return false; }
+      }
+    
+    if(n_in_group > 1)
+      {
+      #if defined(ARMA_USE_OPENMP)
+        {
+        const int n_threads = mp_thread_limit::get();
+        
+        #pragma omp parallel for schedule(dynamic) num_threads(n_threads)
+        for(uword g=0; g < n_in_group; ++g)  { decode_block(g, block_start + g); }
+        }
+      #endif
+      }
+    else
+      {
+      decode_block(0, block_start);
+      }
+    
+    for(uword g=0; g < n_in_group; ++g)
+      {
+      if(status[g] == 0)  { err_msg = "inconsistent data"; return false; }
+      }
+    }
+  
+  return true;
+  }
+
+
+
 inline
 file_type
 diskio::guess_file_type(std::istream& f)
@@ -571,7 +1046,234 @@ diskio::convert_token(eT& val, const std::string& token)
   
   if(str == endptr)  { return false; }
   
-  return true;
+  return true;
+  }
+
+
+
+template<typename T>
+inline
+bool
+diskio::convert_token(std::complex<T>& val, const std::string& token)
+  {
+  const size_t N   = size_t(token.length());
+  const size_t Nm1 = N-1;
+  
+  if(N == 0)  { val = std::complex<T>(0); return true; }
+  
+  const char* str = token.c_str();
+  
+  // valid complex number formats:
+  // (real,imag)
+  // (real)
+  // ()
+  
+  if( (token[0] != '(') || (token[Nm1] != ')') )
+    {
+    // no brackets, so treat the token as a non-complex number
+    
+    T val_real;
+    
+    const bool state = diskio::convert_token(val_real, token);  // use the non-complex version of this function
+    
+    val = std::complex<T>(val_real);
+    
+    return state;
+    }
+  
+  // does the token contain only the () brackets?
+  if(N <= 2)  { val = std::complex<T>(0); return true; }
+  
+  size_t comma_loc   = 0;
+  bool   comma_found = false;
+  
+  for(size_t i=0; i<N; ++i)  { if(str[i] == ',')  { comma_loc = i; comma_found = true; break; } }
+  
+  bool state = false;
+  
+  if(comma_found == false)
+    {
+    // only the real part is available
+    
+    const std::string token_real( &(str[1]), (Nm1 - 1) );
+    
+    T val_real;
+    
+    state = diskio::convert_token(val_real, token_real);  // use the non-complex version of this function
+    
+    val = std::complex<T>(val_real);
+    }
+  else
+    {
+    const std::string token_real( &(str[1]),           (comma_loc - 1      ) );
+    const std::string token_imag( &(str[comma_loc+1]), (Nm1 - 1 - comma_loc) );
+    
+    T val_real;
+    T val_imag;
+    
+    const bool state_real = diskio::convert_token(val_real, token_real);
+    const bool state_imag = diskio::convert_token(val_imag, token_imag);
+    
+    state = (state_real && state_imag);
+    
+    val = std::complex<T>(val_real, val_imag);
+    }
+  
+  return state;
+  }
+
+
+
+template<typename eT>
+inline
+bool
+diskio::convert_token_strict(eT& val, const std::string& token)
+  {
+  const size_t N = size_t(token.length());
+  
+  const bool status = (N > 0) ? diskio::convert_token(val, token) : false;
+  
+  if(status == false)  { val = Datum<eT>::nan; }
+  
+  return status;
+  }
+
+
+
+//! convert a token which is not null terminated;
+//! for real numbers, plain decimal notation is handled directly:
+//! if the significand fits within 2^53 and the decimal exponent is at most 22 in magnitude,
+//! a single multiplication or division by an exactly representable power of 10 gives the correctly rounded result;
+//! all other tokens are handled by std::from_chars() (if available), std::strtod() or the std::string version of convert_token()
+template<typename eT>
+inline
+bool
+diskio::convert_token(eT& val, const char* str, const uword N)
+  {
+  if( (N == 0) || ((N == 1) && (str[0] == '0')) )  { val = eT(0); return true; }
+  
+  if(is_real<eT>::value == false)  { return diskio::convert_token(val, std::string(str, N)); }
+  
+  const char* ptr = str;
+  const char* end = str + N;
+  
+  while( (ptr < end) && ((*ptr == ' ') || (*ptr == '\t') || (*ptr == '\r') || (*ptr == '\v') || (*ptr == '\f')) )  { ++ptr; }
+  
+  bool neg = false;
+  
+  if( (ptr < end) && ((*ptr == '-') || (*ptr == '+')) )  { neg = (*ptr == '-'); ++ptr; }
+  
+  const char* num_start = ptr;
+  
+  // hexadecimal notation is handled by std::strtod()
+  const bool is_hex = ((ptr+1) < end) && (ptr[0] == '0') && ((ptr[1] == 'x') || (ptr[1] == 'X'));
+  
+  unsigned long long mantissa = 0;
+  
+  int  n_sig     = 0;      // number of significant digits in mantissa
+  int  exp10     = 0;
+  bool any_digit = false;
+  bool exact     = true;   // false if significant digits were dropped
+  
+  while( (ptr < end) && (*ptr >= '0') && (*ptr <= '9') )
+    {
+    any_digit = true;
+    
+    if(n_sig < 19)  { mantissa = 10*mantissa + (unsigned long long)(*ptr - '0');  n_sig += (mantissa > 0) ? 1 : 0; }
+    else            { ++exp10;  exact = exact && (*ptr == '0'); }
+    
+    ++ptr;
+    }
+  
+  if( (ptr < end) && (*ptr == '.') )
+    {
+    ++ptr;
+    
+    while( (ptr < end) && (*ptr >= '0') && (*ptr <= '9') )
+      {
+      any_digit = true;
+      
+      if(n_sig < 19)  { mantissa = 10*mantissa + (unsigned long long)(*ptr - '0');  n_sig += (mantissa > 0) ? 1 : 0;  --exp10; }
+      else            { exact = exact && (*ptr == '0'); }
+      
+      ++ptr;
+      }
+    }
+  
+  if( any_digit && (ptr < end) && ((*ptr == 'e') || (*ptr == 'E')) )
+    {
+    const char* exp_ptr = ptr + 1;
+    
+    bool exp_neg = false;
+    
+    if( (exp_ptr < end) && ((*exp_ptr == '-') || (*exp_ptr == '+')) )  { exp_neg = (*exp_ptr == '-'); ++exp_ptr; }
+    
+    int  exp_val   = 0;
+    bool exp_digit = false;
+    
+    while( (exp_ptr < end) && (*exp_ptr >= '0') && (*exp_ptr <= '9') )
+      {
+      exp_digit = true;
+      
+      if(exp_val < 100000)  { exp_val = 10*exp_val + int(*exp_ptr - '0'); }
+      
+      ++exp_ptr;
+      }
+    
+    // as with std::strtod(), an exponent without digits is not part of the number
+    if(exp_digit)  { exp10 += (exp_neg) ? -exp_val : exp_val; }
+    }
+  
+  if( (any_digit == false) || is_hex )  { return diskio::convert_token(val, std::string(str, N)); }
+  
+  constexpr unsigned long long mantissa_limit = (1ull << 53);
+  
+  if( (mantissa == 0) || (exact && (mantissa <= mantissa_limit) && (exp10 >= -22) && (exp10 <= 22)) )
+    {
+    static const double pow10[] = { 1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9, 1e10, 1e11,
+                                   1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+    
+    double result = double(mantissa);
+    
+    if(mantissa != 0)  { result = (exp10 < 0) ? (result / pow10[-exp10]) : (result * pow10[exp10]); }
+    
+    val = eT( (neg) ? -result : result );
+    
+    return true;
+    }
+  
+  // the token is a plain decimal number, so std::from_chars() and std::strtod() give the same result as the std::string version of convert_token()
+  
+  #if (defined(ARMA_HAVE_CXX17) && defined(__cpp_lib_to_chars) && (__cpp_lib_to_chars >= 201611L))
+    {
+    double result = 0.0;
+    
+    const std::from_chars_result state = std::from_chars(num_start, end, result);
+    
+    if( (state.ptr != num_start) && (state.ec == std::errc()) )  { val = eT( (neg) ? -result : result ); return true; }
+    
+    // fallthrough for values out of range
+    }
+  #else
+    {
+    arma_ignore(num_start);
+    }
+  #endif
+  
+  char buf[128];
+  
+  if(N < uword(sizeof(buf)))
+    {
+    std::memcpy(buf, str, size_t(N));
+    
+    buf[N] = char(0);
+    
+    val = eT( std::strtod(buf, nullptr) );
+    
+    return true;
+    }
+  
+  return diskio::convert_token(val, std::string(str, N));
   }
 
 
@@ -579,88 +1281,114 @@ diskio::convert_token(eT& val, const std::string& token)
 template<typename T>
 inline
 bool
-diskio::convert_token(std::complex<T>& val, const std::string& token)
+diskio::convert_token(std::complex<T>& val, const char* str, const uword N)
   {
-  const size_t N   = size_t(token.length());
-  const size_t Nm1 = N-1;
+  return diskio::convert_token(val, std::string(str, N));
+  }
+
+
+
+template<typename eT>
+inline
+bool
+diskio::convert_token_strict(eT& val, const char* str, const uword N)
+  {
+  const bool status = (N > 0) ? diskio::convert_token(val, str, N) : false;
   
-  if(N == 0)  { val = std::complex<T>(0); return true; }
+  if(status == false)  { val = Datum<eT>::nan; }
   
-  const char* str = token.c_str();
+  return status;
+  }
+
+
+
+inline
+void
+diskio::load_csv_header(field<std::string>& header, const std::string& header_line, const char separator)
+  {
+  std::stringstream        header_stream;
+  std::vector<std::string> header_tokens;
   
-  // valid complex number formats:
-  // (real,imag)
-  // (real)
-  // ()
+  std::string token;
   
-  if( (token[0] != '(') || (token[Nm1] != ')') )
+  header_stream.clear();
+  header_stream.str(header_line);
+  
+  uword header_n_tokens = 0;
+  
+  while(header_stream.good())
     {
-    // no brackets, so treat the token as a non-complex number
-    
-    T val_real;
+    std::getline(header_stream, token, separator);
     
-    const bool state = diskio::convert_token(val_real, token);  // use the non-complex version of this function
+    diskio::sanitise_token(token);
     
-    val = std::complex<T>(val_real);
+    ++header_n_tokens;
     
-    return state;
+    header_tokens.push_back(token);
     }
   
-  // does the token contain only the () brackets?
-  if(N <= 2)  { val = std::complex<T>(0); return true; }
-  
-  size_t comma_loc   = 0;
-  bool   comma_found = false;
-  
-  for(size_t i=0; i<N; ++i)  { if(str[i] == ',')  { comma_loc = i; comma_found = true; break; } }
-  
-  bool state = false;
-  
-  if(comma_found == false)
+  if(header_n_tokens == uword(0))
     {
-    // only the real part is available
-    
-    const std::string token_real( &(str[1]), (Nm1 - 1) );
-    
-    T val_real;
-    
-    state = diskio::convert_token(val_real, token_real);  // use the non-complex version of this function
-    
-    val = std::complex<T>(val_real);
+    header.reset();
     }
   else
     {
-    const std::string token_real( &(str[1]),           (comma_loc - 1      ) );
-    const std::string token_imag( &(str[comma_loc+1]), (Nm1 - 1 - comma_loc) );
-    
-    T val_real;
-    T val_imag;
-    
-    const bool state_real = diskio::convert_token(val_real, token_real);
-    const bool state_imag = diskio::convert_token(val_imag, token_imag);
-    
-    state = (state_real && state_imag);
+    header.set_size(1,header_n_tokens);
     
-    val = std::complex<T>(val_real, val_imag);
+    for(uword i=0; i < header_n_tokens; ++i)  { header.at(i) = header_tokens[i]; }
     }
+  }
+
+
+
+//! number of chunks for processing n_bytes of text;
+//! more than one chunk is used only when OpenMP is enabled
+inline
+uword
+diskio::mem_n_chunks(const uword n_bytes)
+  {
+  uword n_chunks = 1;
   
-  return state;
+  #if defined(ARMA_USE_OPENMP)
+    {
+    if( (mp_thread_limit::in_parallel() == false) && (n_bytes >= 65536) )
+      {
+      n_chunks = (std::min)( uword(4 * mp_thread_limit::get()), uword(n_bytes / 16384) );
+      }
+    }
+  #else
+    {
+    arma_ignore(n_bytes);
+    }
+  #endif
+  
+  return (std::max)(n_chunks, uword(1));
   }
 
 
 
-template<typename eT>
+//! split text into chunks of similar size, each starting at the beginning of a line;
+//! chunk i occupies mem[ chunk_start[i] ... chunk_start[i+1]-1 ]
 inline
-bool
-diskio::convert_token_strict(eT& val, const std::string& token)
+void
+diskio::mem_chunks(std::vector<uword>& chunk_start, const char* mem, const uword n_bytes)
   {
-  const size_t N = size_t(token.length());
+  const uword n_chunks = diskio::mem_n_chunks(n_bytes);
   
-  const bool status = (N > 0) ? diskio::convert_token(val, token) : false;
+  chunk_start.resize(n_chunks + 1);
   
-  if(status == false)  { val = Datum<eT>::nan; }
+  chunk_start[0] = 0;
   
-  return status;
+  for(uword c=1; c < n_chunks; ++c)
+    {
+    const uword pos = (std::max)( chunk_start[c-1], (n_bytes / n_chunks) * c );
+    
+    const char* newline = (pos < n_bytes) ? static_cast<const char*>( std::memchr(mem + pos, '\n', size_t(n_bytes - pos)) ) : nullptr;
+    
+    chunk_start[c] = (newline != nullptr) ? (uword(newline - mem) + 1) : n_bytes;
+    }
+  
+  chunk_start[n_chunks] = n_bytes;
   }
 
 
@@ -1086,7 +1814,7 @@ diskio::save_coord_ascii(const Mat<eT>& x, const std::string& final_name)
 template<typename eT>
 inline
 bool
-diskio::save_coord_ascii(const Mat<eT>& x, std::ostream& f)
+diskio::save_coord_ascii(const Mat<eT>& x, std::ostream& f, const uword col_offset, const bool with_size)
   {
   arma_debug_sigprint();
   
@@ -1105,8 +1833,8 @@ diskio::save_coord_ascii(const Mat<eT>& x, std::ostream& f)
     
     if(val == eT_zero)  { continue; }
     
-    f << row;  f.put(' ');
-    f << col;  f.put(' ');
+    f << row;                 f.put(' ');
+    f << (col + col_offset);  f.put(' ');
     
     const bool is_real_int = (is_real<eT>::yes) && arma_isfinite(val) && (val > eT_int_lower) && (val < eT_int_upper) && (eT(int(val)) == val);
     
@@ -1116,7 +1844,7 @@ diskio::save_coord_ascii(const Mat<eT>& x, std::ostream& f)
     }
   
   // make sure it's possible to determine the matrix size
-  if( (x.n_rows > 0) && (x.n_cols > 0) )
+  if( with_size && (x.n_rows > 0) && (x.n_cols > 0) )
     {
     const uword max_row = (x.n_rows > 0) ? x.n_rows-1 : 0;
     const uword max_col = (x.n_cols > 0) ? x.n_cols-1 : 0;
@@ -1139,7 +1867,7 @@ diskio::save_coord_ascii(const Mat<eT>& x, std::ostream& f)
 template<typename T>
 inline
 bool
-diskio::save_coord_ascii(const Mat< std::complex<T> >& x, std::ostream& f)
+diskio::save_coord_ascii(const Mat< std::complex<T> >& x, std::ostream& f, const uword col_offset, const bool with_size)
   {
   arma_debug_sigprint();
   
@@ -1160,8 +1888,8 @@ diskio::save_coord_ascii(const Mat< std::complex<T> >& x, std::ostream& f)
     
     if(val == eT_zero)  { continue; }
     
-    f << row;  f.put(' ');
-    f << col;  f.put(' ');
+    f << row;                 f.put(' ');
+    f << (col + col_offset);  f.put(' ');
     
     const T val_r = std::real(val);
     const T val_i = std::imag(val);
@@ -1179,7 +1907,7 @@ diskio::save_coord_ascii(const Mat< std::complex<T> >& x, std::ostream& f)
     }
   
   // make sure it's possible to determine the matrix size
-  if( (x.n_rows > 0) && (x.n_cols > 0) )
+  if( with_size && (x.n_rows > 0) && (x.n_cols > 0) )
     {
     const uword max_row = (x.n_rows > 0) ? x.n_rows-1 : 0;
     const uword max_col = (x.n_cols > 0) ? x.n_cols-1 : 0;
@@ -1238,8 +1966,11 @@ diskio::save_arma_binary(const Mat<eT>& x, std::ostream& f)
   {
   arma_debug_sigprint();
   
-  f << diskio::gen_bin_header(x) << '\n';
-  f << x.n_rows << ' ' << x.n_cols << '\n';
+  std::ostringstream sizes;
+  
+  sizes << x.n_rows << ' ' << x.n_cols;
+  
+  diskio::write_bin_header(f, diskio::gen_bin_header(x), sizes.str());
   
   f.write( reinterpret_cast<const char*>(x.mem), std::streamsize(x.n_elem*sizeof(eT)) );
   
@@ -1248,6 +1979,56 @@ diskio::save_arma_binary(const Mat<eT>& x, std::ostream& f)
 
 
 
+//! Save a matrix in compressed binary format,
+//! with a header that stores the matrix type as well as its dimensions
+template<typename eT>
+inline
+bool
+diskio::save_arma_zbinary(const Mat<eT>& x, const std::string& final_name)
+  {
+  arma_debug_sigprint();
+  
+  const std::string tmp_name = diskio::gen_tmp_name(final_name);
+  
+  std::ofstream f(tmp_name, std::fstream::binary);
+  
+  bool save_okay = f.is_open();
+  
+  if(save_okay)
+    {
+    save_okay = diskio::save_arma_zbinary(x, f);
+    
+    f.flush();
+    f.close();
+    
+    if(save_okay)  { save_okay = diskio::safe_rename(tmp_name, final_name); }
+    }
+  
+  return save_okay;
+  }
+
+
+
+//! Save a matrix in compressed binary format,
+//! with a header that stores the matrix type as well as its dimensions
+template<typename eT>
+inline
+bool
+diskio::save_arma_zbinary(const Mat<eT>& x, std::ostream& f)
+  {
+  arma_debug_sigprint();
+  
+  std::ostringstream sizes;
+  
+  sizes << x.n_rows << ' ' << x.n_cols << ' ' << uword(diskio::zbin_block_elems);
+  
+  diskio::write_bin_header(f, diskio::gen_zbin_header(x), sizes.str());
+  
+  return diskio::save_zbin_array(x.mem, x.n_elem, f);
+  }
+
+
+
 //! Save a matrix as a PGM greyscale image
 template<typename eT>
 inline
@@ -1462,19 +2243,11 @@ diskio::load_raw_ascii(Mat<eT>& x, const std::string& name, std::string& err_msg
   {
   arma_debug_sigprint();
   
-  std::ifstream f;
-  
-  (arma_config::text_as_binary) ? f.open(name, std::fstream::binary) : f.open(name);
-  
-  bool load_okay = f.is_open();
+  mmap_file F;
   
-  if(load_okay)
-    {
-    load_okay = diskio::load_raw_ascii(x, f, err_msg);
-    f.close();
-    }
+  if(F.open(name) == false)  { return false; }
   
-  return load_okay;
+  return diskio::load_raw_ascii(x, F.mem, F.n_bytes, err_msg);
   }
 
 
@@ -1494,79 +2267,239 @@ diskio::load_raw_ascii(Mat<eT>& x, std::istream& f, std::string& err_msg)
   f.clear();
   const std::fstream::pos_type pos1 = f.tellg();
   
-  //
-  // work out the size
+  //
+  // work out the size
+  
+  uword f_n_rows = 0;
+  uword f_n_cols = 0;
+  
+  bool f_n_cols_found = false;
+  
+  std::string       line_string;
+  std::stringstream line_stream;
+  
+  std::string token;
+  
+  while( f.good() && load_okay )
+    {
+    std::getline(f, line_string);
+    
+    // TODO: does it make sense to stop processing the file if an empty line is found ?
+    if(line_string.size() == 0)  { break; }
+    
+    line_stream.clear();
+    line_stream.str(line_string);
+    
+    uword line_n_cols = 0;
+    
+    while(line_stream >> token)  { ++line_n_cols; }
+    
+    if(f_n_cols_found == false)
+      {
+      f_n_cols       = line_n_cols;
+      f_n_cols_found = true;
+      }
+    else
+      {
+      if(line_n_cols != f_n_cols)
+        {
+        load_okay = false;
+        err_msg = "inconsistent number of columns";
+        }
+      }
+    
+    ++f_n_rows;
+    }
+  
+  
+  if(load_okay)
+    {
+    f.clear();
+    f.seekg(pos1);
+    
+    if(f.fail() || (f.tellg() != pos1))  { err_msg = "seek failure"; return false; }
+    
+    try { x.set_size(f_n_rows, f_n_cols); } catch(...) { err_msg = "not enough memory"; return false; }
+    
+    for(uword row=0; ((row < x.n_rows) && load_okay); ++row)
+    for(uword col=0; ((col < x.n_cols) && load_okay); ++col)
+      {
+      f >> token;
+      
+      if(diskio::convert_token(x.at(row,col), token) == false)
+        {
+        load_okay = false;
+        err_msg = "data interpretation failure";
+        }
+      }
+    }
+  
+  
+  // an empty file indicates an empty matrix
+  if( (f_n_cols_found == false) && (load_okay == true) )  { x.reset(); }
+  
+  
+  return load_okay;
+  }
+
+
+
+//! Load a matrix as raw text (no header, human readable) from memory.
+//! Lines are located and parsed in chunks, which are processed in parallel when OpenMP is enabled.
+template<typename eT>
+inline
+bool
+diskio::load_raw_ascii(Mat<eT>& x, const char* mem, const uword n_bytes, std::string& err_msg)
+  {
+  arma_debug_sigprint();
+  
+  std::vector<uword> chunk_start;
+  
+  diskio::mem_chunks(chunk_start, mem, n_bytes);
+  
+  const uword n_chunks = uword(chunk_start.size()) - 1;
+  
+  std::vector<uword> chunk_n_rows (n_chunks);
+  std::vector<uword> chunk_n_cols (n_chunks);  // number of columns in the first line of each chunk
+  std::vector<uword> chunk_flags  (n_chunks);  // bit 0: empty line found; bit 1: inconsistent number of columns; bit 2: data interpretation failure
+  
+  const auto is_space = [](const char c) { return ( (c == ' ') || (c == '\t') || (c == '\r') || (c == '\v') || (c == '\f') ); };
+  
+  const auto scan_chunk = [&](const uword c)
+    {
+    const char* ptr = mem + chunk_start[c  ];
+    const char* end = mem + chunk_start[c+1];
+    
+    uword n_rows = 0;
+    uword n_cols = 0;
+    uword flags  = 0;
+    
+    while(ptr < end)
+      {
+      const char* line_end = static_cast<const char*>( std::memchr(ptr, '\n', size_t(end - ptr)) );
+      
+      if(line_end == nullptr)  { line_end = end; }
+      
+      if(line_end == ptr)  { flags |= 1; break; }
+      
+      uword line_n_cols = 0;
+      
+      for(const char* p = ptr; p < line_end; ++p)  { line_n_cols += ( (is_space(*p) == false) && ((p == ptr) || is_space(*(p-1))) ) ? 1 : 0; }
+      
+      if(n_rows == 0)  { n_cols = line_n_cols; }  else if(line_n_cols != n_cols)  { flags |= 2; }
+      
+      ++n_rows;
+      
+      ptr = line_end + 1;
+      }
+    
+    chunk_n_rows[c] = n_rows;
+    chunk_n_cols[c] = n_cols;
+    chunk_flags[c]  = flags;
+    };
+  
+  if(n_chunks > 1)
+    {
+    #if defined(ARMA_USE_OPENMP)
+      {
+      arma_debug_print("openmp implementation");
+      
+      const int n_threads = mp_thread_limit::get();
+      
+      #pragma omp parallel for schedule(dynamic) num_threads(n_threads)
+      for(uword c=0; c < n_chunks; ++c)  { scan_chunk(c); }
+      }
+    #endif
+    }
+  else
+    {
+    for(uword c=0; c < n_chunks; ++c)  { scan_chunk(c); }
+    }
+  
+  // chunks after the first empty line are ignored
   
   uword f_n_rows = 0;
   uword f_n_cols = 0;
   
   bool f_n_cols_found = false;
   
-  std::string       line_string;
-  std::stringstream line_stream;
-  
-  std::string token;
+  uword n_chunks_used = n_chunks;
   
-  while( f.good() && load_okay )
+  for(uword c=0; c < n_chunks; ++c)
     {
-    std::getline(f, line_string);
-    
-    // TODO: does it make sense to stop processing the file if an empty line is found ?
-    if(line_string.size() == 0)  { break; }
-    
-    line_stream.clear();
-    line_stream.str(line_string);
-    
-    uword line_n_cols = 0;
-    
-    while(line_stream >> token)  { ++line_n_cols; }
-    
-    if(f_n_cols_found == false)
+    if(chunk_n_rows[c] > 0)
       {
-      f_n_cols       = line_n_cols;
-      f_n_cols_found = true;
-      }
-    else
-      {
-      if(line_n_cols != f_n_cols)
-        {
-        load_okay = false;
-        err_msg = "inconsistent number of columns";
-        }
+      if(f_n_cols_found == false)  { f_n_cols = chunk_n_cols[c]; f_n_cols_found = true; }
+      
+      if( ((chunk_flags[c] & 2) != 0) || (chunk_n_cols[c] != f_n_cols) )  { err_msg = "inconsistent number of columns"; return false; }
       }
     
-    ++f_n_rows;
+    f_n_rows += chunk_n_rows[c];
+    
+    if((chunk_flags[c] & 1) != 0)  { n_chunks_used = c+1; break; }
     }
   
+  // an empty file indicates an empty matrix
+  if(f_n_cols_found == false)  { x.reset(); return true; }
+  
+  try { x.set_size(f_n_rows, f_n_cols); } catch(...) { err_msg = "not enough memory"; return false; }
   
-  if(load_okay)
+  std::vector<uword> chunk_row(n_chunks_used);
+  
+  for(uword c=0, row=0; c < n_chunks_used; ++c)  { chunk_row[c] = row; row += chunk_n_rows[c]; }
+  
+  const auto parse_chunk = [&](const uword c)
     {
-    f.clear();
-    f.seekg(pos1);
-    
-    if(f.fail() || (f.tellg() != pos1))  { err_msg = "seek failure"; return false; }
-    
-    try { x.set_size(f_n_rows, f_n_cols); } catch(...) { err_msg = "not enough memory"; return false; }
+    const char* ptr = mem + chunk_start[c  ];
+    const char* end = mem + chunk_start[c+1];
     
-    for(uword row=0; ((row < x.n_rows) && load_okay); ++row)
-    for(uword col=0; ((col < x.n_cols) && load_okay); ++col)
+    for(uword row = chunk_row[c]; row < (chunk_row[c] + chunk_n_rows[c]); ++row)
       {
-      f >> token;
+      const char* line_end = static_cast<const char*>( std::memchr(ptr, '\n', size_t(end - ptr)) );
       
-      if(diskio::convert_token(x.at(row,col), token) == false)
+      if(line_end == nullptr)  { line_end = end; }
+      
+      const char* tok = ptr;
+      
+      for(uword col=0; col < f_n_cols; ++col)
         {
-        load_okay = false;
-        err_msg = "data interpretation failure";
+        while( (tok < line_end) &&  is_space(*tok)          )  { ++tok; }
+        
+        const char* tok_end = tok;
+        
+        while( (tok_end < line_end) && (is_space(*tok_end) == false) )  { ++tok_end; }
+        
+        if(diskio::convert_token(x.at(row,col), tok, uword(tok_end - tok)) == false)  { chunk_flags[c] |= 4; }
+        
+        tok = tok_end;
         }
+      
+      ptr = line_end + 1;
       }
-    }
+    };
   
+  if(n_chunks_used > 1)
+    {
+    #if defined(ARMA_USE_OPENMP)
+      {
+      const int n_threads = mp_thread_limit::get();
+      
+      #pragma omp parallel for schedule(dynamic) num_threads(n_threads)
+      for(uword c=0; c < n_chunks_used; ++c)  { parse_chunk(c); }
+      }
+    #endif
+    }
+  else
+    {
+    for(uword c=0; c < n_chunks_used; ++c)  { parse_chunk(c); }
+    }
   
-  // an empty file indicates an empty matrix
-  if( (f_n_cols_found == false) && (load_okay == true) )  { x.reset(); }
-  
+  for(uword c=0; c < n_chunks_used; ++c)
+    {
+    if((chunk_flags[c] & 4) != 0)  { err_msg = "data interpretation failure"; return false; }
+    }
   
-  return load_okay;
+  return true;
   }
 
 
@@ -1744,6 +2677,32 @@ diskio::load_csv_ascii(Mat<eT>& x, const std::string& name, std::string& err_msg
   {
   arma_debug_sigprint();
   
+  if(is_cx<eT>::no)  // complex numbers stored in "a+bi" format are handled by the stream-based loader
+    {
+    mmap_file F;
+    
+    if(F.open(name) == false)  { return false; }
+    
+    const char* mem     = F.mem;
+          uword n_bytes = F.n_bytes;
+    
+    if(with_header)
+      {
+      arma_debug_print("diskio::load_csv_ascii(): reading header");
+      
+      const char* newline = static_cast<const char*>( std::memchr(mem, '\n', size_t(n_bytes)) );
+      
+      if(newline == nullptr)  { return false; }
+      
+      diskio::load_csv_header(header, std::string(mem, newline), separator);
+      
+      n_bytes -= uword(newline - mem) + 1;
+      mem      = newline + 1;
+      }
+    
+    return diskio::load_csv_ascii(x, mem, n_bytes, err_msg, separator, strict);
+    }
+  
   std::ifstream f;
   
   (arma_config::text_as_binary) ? f.open(name, std::fstream::binary) : f.open(name);
@@ -1756,55 +2715,172 @@ diskio::load_csv_ascii(Mat<eT>& x, const std::string& name, std::string& err_msg
     {
     arma_debug_print("diskio::load_csv_ascii(): reading header");
     
-    std::string              header_line;
-    std::stringstream        header_stream;
-    std::vector<std::string> header_tokens;
+    std::string header_line;
     
     std::getline(f, header_line);
     
     load_okay = f.good();
     
-    if(load_okay)
+    if(load_okay)  { diskio::load_csv_header(header, header_line, separator); }
+    }
+  
+  if(load_okay)
+    {
+    load_okay = diskio::load_csv_ascii(x, f, err_msg, separator, strict);
+    }
+  
+  f.close();
+  
+  return load_okay;
+  }
+
+
+
+//! Load a matrix in CSV text format (human readable) from memory.
+//! Lines are located and parsed in chunks, which are processed in parallel when OpenMP is enabled.
+template<typename eT>
+inline
+bool
+diskio::load_csv_ascii(Mat<eT>& x, const char* mem, const uword n_bytes, std::string& err_msg, const char separator, const bool strict)
+  {
+  arma_debug_sigprint();
+  
+  std::vector<uword> chunk_start;
+  
+  diskio::mem_chunks(chunk_start, mem, n_bytes);
+  
+  const uword n_chunks = uword(chunk_start.size()) - 1;
+  
+  std::vector<uword> chunk_n_rows (n_chunks);
+  std::vector<uword> chunk_n_cols (n_chunks);  // largest number of columns in each chunk
+  std::vector<uword> chunk_flags  (n_chunks);  // bit 0: empty line found
+  
+  const auto scan_chunk = [&](const uword c)
+    {
+    const char* ptr = mem + chunk_start[c  ];
+    const char* end = mem + chunk_start[c+1];
+    
+    uword n_rows = 0;
+    uword n_cols = 0;
+    uword flags  = 0;
+    
+    while(ptr < end)
       {
-      std::string token;
+      const char* line_end = static_cast<const char*>( std::memchr(ptr, '\n', size_t(end - ptr)) );
       
-      header_stream.clear();
-      header_stream.str(header_line);
+      if(line_end == nullptr)  { line_end = end; }
       
-      uword header_n_tokens = 0;
+      if(line_end == ptr)  { flags |= 1; break; }
       
-      while(header_stream.good())
+      uword line_n_cols = 1;
+      
+      for(const char* p = ptr; p < line_end; ++p)  { line_n_cols += (*p == separator) ? 1 : 0; }
+      
+      if(n_cols < line_n_cols)  { n_cols = line_n_cols; }
+      
+      ++n_rows;
+      
+      ptr = line_end + 1;
+      }
+    
+    chunk_n_rows[c] = n_rows;
+    chunk_n_cols[c] = n_cols;
+    chunk_flags[c]  = flags;
+    };
+  
+  if(n_chunks > 1)
+    {
+    #if defined(ARMA_USE_OPENMP)
+      {
+      arma_debug_print("openmp implementation");
+      
+      const int n_threads = mp_thread_limit::get();
+      
+      #pragma omp parallel for schedule(dynamic) num_threads(n_threads)
+      for(uword c=0; c < n_chunks; ++c)  { scan_chunk(c); }
+      }
+    #endif
+    }
+  else
+    {
+    for(uword c=0; c < n_chunks; ++c)  { scan_chunk(c); }
+    }
+  
+  // chunks after the first empty line are ignored
+  
+  uword f_n_rows = 0;
+  uword f_n_cols = 0;
+  
+  uword n_chunks_used = n_chunks;
+  
+  for(uword c=0; c < n_chunks; ++c)
+    {
+    f_n_rows += chunk_n_rows[c];
+    
+    if(f_n_cols < chunk_n_cols[c])  { f_n_cols = chunk_n_cols[c]; }
+    
+    if((chunk_flags[c] & 1) != 0)  { n_chunks_used = c+1; break; }
+    }
+  
+  try { x.zeros(f_n_rows, f_n_cols); } catch(...) { err_msg = "not enough memory"; return false; }
+  
+  if(strict)  { x.fill(Datum<eT>::nan); }   // take into account that each row may have a unique number of columns
+  
+  std::vector<uword> chunk_row(n_chunks_used);
+  
+  for(uword c=0, row=0; c < n_chunks_used; ++c)  { chunk_row[c] = row; row += chunk_n_rows[c]; }
+  
+  const auto parse_chunk = [&](const uword c)
+    {
+    const char* ptr = mem + chunk_start[c  ];
+    const char* end = mem + chunk_start[c+1];
+    
+    for(uword row = chunk_row[c]; row < (chunk_row[c] + chunk_n_rows[c]); ++row)
+      {
+      const char* line_end = static_cast<const char*>( std::memchr(ptr, '\n', size_t(end - ptr)) );
+      
+      if(line_end == nullptr)  { line_end = end; }
+      
+      const char* tok = ptr;
+      
+      for(uword col=0; col < f_n_cols; ++col)
         {
-        std::getline(header_stream, token, separator);
+        const char* tok_end = static_cast<const char*>( std::memchr(tok, separator, size_t(line_end - tok)) );
         
-        diskio::sanitise_token(token);
+        if(tok_end == nullptr)  { tok_end = line_end; }
         
-        ++header_n_tokens;
+        eT& out_val = x.at(row,col);
         
-        header_tokens.push_back(token);
-        }
-      
-      if(header_n_tokens == uword(0))
-        {
-        header.reset();
-        }
-      else
-        {
-        header.set_size(1,header_n_tokens);
+        const uword N = uword(tok_end - tok);
         
-        for(uword i=0; i < header_n_tokens; ++i)  { header.at(i) = header_tokens[i]; }
+        (strict) ? diskio::convert_token_strict( out_val, tok, N ) : diskio::convert_token( out_val, tok, N );
+        
+        if(tok_end == line_end)  { break; }
+        
+        tok = tok_end + 1;
         }
+      
+      ptr = line_end + 1;
       }
-    }
+    };
   
-  if(load_okay)
+  if(n_chunks_used > 1)
     {
-    load_okay = diskio::load_csv_ascii(x, f, err_msg, separator, strict);
+    #if defined(ARMA_USE_OPENMP)
+      {
+      const int n_threads = mp_thread_limit::get();
+      
+      #pragma omp parallel for schedule(dynamic) num_threads(n_threads)
+      for(uword c=0; c < n_chunks_used; ++c)  { parse_chunk(c); }
+      }
+    #endif
+    }
+  else
+    {
+    for(uword c=0; c < n_chunks_used; ++c)  { parse_chunk(c); }
     }
   
-  f.close();
-  
-  return load_okay;
+  return true;
   }
 
 
@@ -2793,33 +3869,130 @@ diskio::load_hdf5_binary(Mat<eT>& x, const hdf5_name& spec, std::string& err_msg
         H5Sclose(filespace);
         }
       
-      H5Dclose(dataset);
+      H5Dclose(dataset);
+      
+      H5Fclose(fid);
+      
+      if(load_okay == false)
+        {
+        err_msg = "unsupported or missing HDF5 data";
+        }
+      }
+    else
+      {
+      err_msg = "cannot open";
+      }
+    
+    return load_okay;
+    }
+  #else
+    {
+    arma_ignore(x);
+    arma_ignore(spec);
+    arma_ignore(err_msg);
+    
+    arma_stop_logic_error("Mat::load(): use of HDF5 must be enabled");
+    
+    return false;
+    }
+  #endif
+  }
+
+
+
+//! Load a matrix in compressed binary format,
+//! with a header that indicates the matrix type as well as its dimensions
+template<typename eT>
+inline
+bool
+diskio::load_arma_zbinary(Mat<eT>& x, const std::string& name, std::string& err_msg)
+  {
+  arma_debug_sigprint();
+  
+  std::ifstream f;
+  f.open(name, std::fstream::binary);
+  
+  bool load_okay = f.is_open();
+  
+  if(load_okay)
+    {
+    load_okay = diskio::load_arma_zbinary(x, f, err_msg);
+    f.close();
+    }
+  
+  return load_okay;
+  }
+
+
+
+template<typename eT>
+inline
+bool
+diskio::load_arma_zbinary(Mat<eT>& x, std::istream& f, std::string& err_msg)
+  {
+  arma_debug_sigprint();
+  
+  std::streampos pos = f.tellg();
+  
+  bool load_okay = true;
+  
+  std::string f_header;
+  uword       f_n_rows;
+  uword       f_n_cols;
+  uword       f_block_elems;
+  
+  f >> f_header;
+  f >> f_n_rows;
+  f >> f_n_cols;
+  f >> f_block_elems;
+  
+  if(f_header == diskio::gen_zbin_header(x))
+    {
+    f.get();
+    
+    try { x.set_size(f_n_rows,f_n_cols); } catch(...) { err_msg = "not enough memory"; return false; }
+    
+    load_okay = diskio::load_zbin_array(x.memptr(), x.n_elem, f_block_elems, f, err_msg);
+    }
+  else
+    {
+    load_okay = false;
+    err_msg = "incorrect header";
+    }
+  
+  
+  // allow automatic conversion of u32/s32 matrices into u64/s64 matrices
+  
+  if(load_okay == false)
+    {
+    if( (sizeof(eT) == 8) && is_same_type<uword,eT>::yes )
+      {
+      Mat<u32>    tmp;
+      std::string junk;
+      
+      f.clear();
+      f.seekg(pos);
       
-      H5Fclose(fid);
+      load_okay = diskio::load_arma_zbinary(tmp, f, junk);
       
-      if(load_okay == false)
-        {
-        err_msg = "unsupported or missing HDF5 data";
-        }
+      if(load_okay)  { x = conv_to< Mat<eT> >::from(tmp); }
       }
     else
+    if( (sizeof(eT) == 8) && is_same_type<sword,eT>::yes )
       {
-      err_msg = "cannot open";
+      Mat<s32>    tmp;
+      std::string junk;
+      
+      f.clear();
+      f.seekg(pos);
+      
+      load_okay = diskio::load_arma_zbinary(tmp, f, junk);
+      
+      if(load_okay)  { x = conv_to< Mat<eT> >::from(tmp); }
       }
-    
-    return load_okay;
-    }
-  #else
-    {
-    arma_ignore(x);
-    arma_ignore(spec);
-    arma_ignore(err_msg);
-    
-    arma_stop_logic_error("Mat::load(): use of HDF5 must be enabled");
-    
-    return false;
     }
-  #endif
+  
+  return load_okay;
   }
 
 
@@ -2865,10 +4038,12 @@ diskio::load_auto_detect(Mat<eT>& x, std::istream& f, std::string& err_msg)
   
   const char* ARMA_MAT_TXT_str = "ARMA_MAT_TXT";
   const char* ARMA_MAT_BIN_str = "ARMA_MAT_BIN";
+  const char* ARMA_MAT_ZBN_str = "ARMA_MAT_ZBN";
   const char*           P5_str = "P5";
   
   const uword ARMA_MAT_TXT_len = uword(12);
   const uword ARMA_MAT_BIN_len = uword(12);
+  const uword ARMA_MAT_ZBN_len = uword(12);
   const uword           P5_len = uword(2);
   
   podarray<char> header(ARMA_MAT_TXT_len + 1);
@@ -2893,6 +4068,11 @@ diskio::load_auto_detect(Mat<eT>& x, std::istream& f, std::string& err_msg)
     return load_arma_binary(x, f, err_msg);
     }
   else
+  if( std::strncmp(ARMA_MAT_ZBN_str, header_mem, size_t(ARMA_MAT_ZBN_len)) == 0 )
+    {
+    return load_arma_zbinary(x, f, err_msg);
+    }
+  else
   if( std::strncmp(P5_str, header_mem, size_t(P5_len)) == 0 )
     {
     return load_pgm_binary(x, f, err_msg);
@@ -3241,8 +4421,11 @@ diskio::save_arma_binary(const SpMat<eT>& x, std::ostream& f)
   {
   arma_debug_sigprint();
   
-  f << diskio::gen_bin_header(x) << '\n';
-  f << x.n_rows << ' ' << x.n_cols << ' ' << x.n_nonzero << '\n';
+  std::ostringstream sizes;
+  
+  sizes << x.n_rows << ' ' << x.n_cols << ' ' << x.n_nonzero;
+  
+  diskio::write_bin_header(f, diskio::gen_bin_header(x), sizes.str());
   
   f.write( reinterpret_cast<const char*>(x.values),      std::streamsize(x.n_nonzero*sizeof(eT))     );
   f.write( reinterpret_cast<const char*>(x.row_indices), std::streamsize(x.n_nonzero*sizeof(uword))  );
@@ -3253,6 +4436,62 @@ diskio::save_arma_binary(const SpMat<eT>& x, std::ostream& f)
 
 
 
+//! Save a sparse matrix in compressed binary format,
+//! with a header that stores the matrix type as well as its dimensions
+template<typename eT>
+inline
+bool
+diskio::save_arma_zbinary(const SpMat<eT>& x, const std::string& final_name)
+  {
+  arma_debug_sigprint();
+  
+  const std::string tmp_name = diskio::gen_tmp_name(final_name);
+  
+  std::ofstream f(tmp_name, std::fstream::binary);
+  
+  bool save_okay = f.is_open();
+  
+  if(save_okay)
+    {
+    save_okay = diskio::save_arma_zbinary(x, f);
+    
+    f.flush();
+    f.close();
+    
+    if(save_okay)  { save_okay = diskio::safe_rename(tmp_name, final_name); }
+    }
+  
+  return save_okay;
+  }
+
+
+
+//! Save a sparse matrix in compressed binary format,
+//! with a header that stores the matrix type as well as its dimensions;
+//! the CSC arrays (values, row indices, column pointers) are compressed separately,
+//! and the size of the integer type used for the indices is recorded
+template<typename eT>
+inline
+bool
+diskio::save_arma_zbinary(const SpMat<eT>& x, std::ostream& f)
+  {
+  arma_debug_sigprint();
+  
+  std::ostringstream sizes;
+  
+  sizes << x.n_rows << ' ' << x.n_cols << ' ' << x.n_nonzero << ' ' << uword(diskio::zbin_block_elems) << ' ' << sizeof(uword);
+  
+  diskio::write_bin_header(f, diskio::gen_zbin_header(x), sizes.str());
+  
+  bool save_okay =              diskio::save_zbin_array(x.values,      x.n_nonzero,  f);
+  save_okay      = save_okay && diskio::save_zbin_array(x.row_indices, x.n_nonzero,  f);
+  save_okay      = save_okay && diskio::save_zbin_array(x.col_ptrs,    x.n_cols + 1, f);
+  
+  return save_okay;
+  }
+
+
+
 template<typename eT>
 inline
 bool
@@ -3795,6 +5034,136 @@ diskio::load_arma_binary(SpMat<eT>& x, std::istream& f, std::string& err_msg)
 
 
 
+//! Load a sparse matrix in compressed binary format,
+//! with a header that indicates the matrix type as well as its dimensions
+template<typename eT>
+inline
+bool
+diskio::load_arma_zbinary(SpMat<eT>& x, const std::string& name, std::string& err_msg)
+  {
+  arma_debug_sigprint();
+  
+  std::ifstream f;
+  f.open(name, std::fstream::binary);
+  
+  bool load_okay = f.is_open();
+  
+  if(load_okay)
+    {
+    load_okay = diskio::load_arma_zbinary(x, f, err_msg);
+    f.close();
+    }
+  
+  return load_okay;
+  }
+
+
+
+template<typename eT>
+inline
+bool
+diskio::load_arma_zbinary(SpMat<eT>& x, std::istream& f, std::string& err_msg)
+  {
+  arma_debug_sigprint();
+  
+  std::string f_header;
+  
+  f >> f_header;
+  
+  if(f_header != diskio::gen_zbin_header(x))  { err_msg = "incorrect header"; return false; }
+  
+  uword f_n_rows       = 0;
+  uword f_n_cols       = 0;
+  uword f_n_nz         = 0;
+  uword f_block_elems  = 0;
+  uword f_index_nbytes = 0;
+  
+  f >> f_n_rows;
+  f >> f_n_cols;
+  f >> f_n_nz;
+  f >> f_block_elems;
+  f >> f_index_nbytes;
+  
+  f.get();
+  
+  if( (f.good() == false) || ((f_index_nbytes != 4) && (f_index_nbytes != 8)) )  { err_msg = "incorrect header"; return false; }
+  
+  try { x.reserve(f_n_rows, f_n_cols, f_n_nz); } catch(...) { err_msg = "not enough memory"; return false; }
+  
+  if(diskio::load_zbin_array(access::rwp(x.values), x.n_nonzero, f_block_elems, f, err_msg) == false)  { return false; }
+  
+  uword* row_indices = access::rwp(x.row_indices);
+  uword* col_ptrs    = access::rwp(x.col_ptrs);
+  
+  bool load_okay = true;
+  
+  if(f_index_nbytes == sizeof(uword))
+    {
+    load_okay =              diskio::load_zbin_array(row_indices, x.n_nonzero,  f_block_elems, f, err_msg);
+    load_okay = load_okay && diskio::load_zbin_array(col_ptrs,    x.n_cols + 1, f_block_elems, f, err_msg);
+    }
+  else
+  if(f_index_nbytes == 4)
+    {
+    podarray<u32> tmp_a;
+    podarray<u32> tmp_b;
+    
+    try { tmp_a.set_size(x.n_nonzero); tmp_b.set_size(x.n_cols + 1); } catch(...) { err_msg = "not enough memory"; return false; }
+    
+    load_okay =              diskio::load_zbin_array(tmp_a.memptr(), x.n_nonzero,  f_block_elems, f, err_msg);
+    load_okay = load_okay && diskio::load_zbin_array(tmp_b.memptr(), x.n_cols + 1, f_block_elems, f, err_msg);
+    
+    if(load_okay)
+      {
+      arrayops::convert(row_indices, tmp_a.memptr(), x.n_nonzero );
+      arrayops::convert(col_ptrs,    tmp_b.memptr(), x.n_cols + 1);
+      }
+    }
+  else
+    {
+    podarray<u64> tmp_a;
+    podarray<u64> tmp_b;
+    
+    try { tmp_a.set_size(x.n_nonzero); tmp_b.set_size(x.n_cols + 1); } catch(...) { err_msg = "not enough memory"; return false; }
+    
+    load_okay =              diskio::load_zbin_array(tmp_a.memptr(), x.n_nonzero,  f_block_elems, f, err_msg);
+    load_okay = load_okay && diskio::load_zbin_array(tmp_b.memptr(), x.n_cols + 1, f_block_elems, f, err_msg);
+    
+    if(load_okay)
+      {
+      for(uword i=0; i < x.n_nonzero;  ++i)  { if(tmp_a[i] > u64(x.n_rows   ))  { load_okay = false; break; } }
+      for(uword i=0; i < x.n_cols + 1; ++i)  { if(tmp_b[i] > u64(x.n_nonzero))  { load_okay = false; break; } }
+      
+      if(load_okay)
+        {
+        arrayops::convert(row_indices, tmp_a.memptr(), x.n_nonzero );
+        arrayops::convert(col_ptrs,    tmp_b.memptr(), x.n_cols + 1);
+        }
+      else
+        {
+        err_msg = "inconsistent data";
+        }
+      }
+    }
+  
+  if(load_okay == false)  { x.reset(); return false; }
+  
+  bool check1 = true;  for(uword i=0; i < x.n_nonzero; ++i)  { if( (x.values[i] == eT(0)) || (row_indices[i] >= x.n_rows) )  { check1 = false; break; } }
+  bool check2 = true;  for(uword i=0; i < x.n_cols;    ++i)  { if(col_ptrs[i+1] < col_ptrs[i])  { check2 = false; break; } }
+  bool check3 = (col_ptrs[0] == 0) && (col_ptrs[x.n_cols] == x.n_nonzero);
+  
+  if((check1 == false) || (check2 == false) || (check3 == false))
+    {
+    x.reset();
+    err_msg = "inconsistent data";
+    return false;
+    }
+  
+  return true;
+  }
+
+
+
 // cubes
 
 
@@ -3976,21 +5345,73 @@ diskio::save_arma_ascii(const Cube<eT>& x, std::ostream& f)
       }
     }
   
-  const bool save_okay = f.good();
+  const bool save_okay = f.good();
+  
+  stream_state.restore(f);
+  
+  return save_okay;
+  }
+
+
+
+//! Save a cube in binary format,
+//! with a header that stores the cube type as well as its dimensions
+template<typename eT>
+inline
+bool
+diskio::save_arma_binary(const Cube<eT>& x, const std::string& final_name)
+  {
+  arma_debug_sigprint();
+  
+  const std::string tmp_name = diskio::gen_tmp_name(final_name);
+  
+  std::ofstream f(tmp_name, std::fstream::binary);
+  
+  bool save_okay = f.is_open();
+  
+  if(save_okay)
+    {
+    save_okay = diskio::save_arma_binary(x, f);
+    
+    f.flush();
+    f.close();
+    
+    if(save_okay)  { save_okay = diskio::safe_rename(tmp_name, final_name); }
+    }
+  
+  return save_okay;
+  }
+
+
+
+//! Save a cube in binary format,
+//! with a header that stores the cube type as well as its dimensions
+template<typename eT>
+inline
+bool
+diskio::save_arma_binary(const Cube<eT>& x, std::ostream& f)
+  {
+  arma_debug_sigprint();
+  
+  std::ostringstream sizes;
   
-  stream_state.restore(f);
+  sizes << x.n_rows << ' ' << x.n_cols << ' ' << x.n_slices;
   
-  return save_okay;
+  diskio::write_bin_header(f, diskio::gen_bin_header(x), sizes.str());
+  
+  f.write( reinterpret_cast<const char*>(x.mem), std::streamsize(x.n_elem*sizeof(eT)) );
+  
+  return f.good();
   }
 
 
 
-//! Save a cube in binary format,
+//! Save a cube in compressed binary format,
 //! with a header that stores the cube type as well as its dimensions
 template<typename eT>
 inline
 bool
-diskio::save_arma_binary(const Cube<eT>& x, const std::string& final_name)
+diskio::save_arma_zbinary(const Cube<eT>& x, const std::string& final_name)
   {
   arma_debug_sigprint();
   
@@ -4002,7 +5423,7 @@ diskio::save_arma_binary(const Cube<eT>& x, const std::string& final_name)
   
   if(save_okay)
     {
-    save_okay = diskio::save_arma_binary(x, f);
+    save_okay = diskio::save_arma_zbinary(x, f);
     
     f.flush();
     f.close();
@@ -4015,21 +5436,22 @@ diskio::save_arma_binary(const Cube<eT>& x, const std::string& final_name)
 
 
 
-//! Save a cube in binary format,
+//! Save a cube in compressed binary format,
 //! with a header that stores the cube type as well as its dimensions
 template<typename eT>
 inline
 bool
-diskio::save_arma_binary(const Cube<eT>& x, std::ostream& f)
+diskio::save_arma_zbinary(const Cube<eT>& x, std::ostream& f)
   {
   arma_debug_sigprint();
   
-  f << diskio::gen_bin_header(x) << '\n';
-  f << x.n_rows << ' ' << x.n_cols << ' ' << x.n_slices << '\n';
+  std::ostringstream sizes;
   
-  f.write( reinterpret_cast<const char*>(x.mem), std::streamsize(x.n_elem*sizeof(eT)) );
+  sizes << x.n_rows << ' ' << x.n_cols << ' ' << x.n_slices << ' ' << uword(diskio::zbin_block_elems);
   
-  return f.good();
+  diskio::write_bin_header(f, diskio::gen_zbin_header(x), sizes.str());
+  
+  return diskio::save_zbin_array(x.mem, x.n_elem, f);
   }
 
 
@@ -4598,6 +6020,105 @@ diskio::load_hdf5_binary(Cube<eT>& x, const hdf5_name& spec, std::string& err_ms
 
 
 
+//! Load a cube in compressed binary format,
+//! with a header that indicates the cube type as well as its dimensions
+template<typename eT>
+inline
+bool
+diskio::load_arma_zbinary(Cube<eT>& x, const std::string& name, std::string& err_msg)
+  {
+  arma_debug_sigprint();
+  
+  std::ifstream f;
+  f.open(name, std::fstream::binary);
+  
+  bool load_okay = f.is_open();
+  
+  if(load_okay)
+    {
+    load_okay = diskio::load_arma_zbinary(x, f, err_msg);
+    f.close();
+    }
+  
+  return load_okay;
+  }
+
+
+
+template<typename eT>
+inline
+bool
+diskio::load_arma_zbinary(Cube<eT>& x, std::istream& f, std::string& err_msg)
+  {
+  arma_debug_sigprint();
+  
+  std::streampos pos = f.tellg();
+  
+  bool load_okay = true;
+  
+  std::string f_header;
+  uword       f_n_rows;
+  uword       f_n_cols;
+  uword       f_n_slices;
+  uword       f_block_elems;
+  
+  f >> f_header;
+  f >> f_n_rows;
+  f >> f_n_cols;
+  f >> f_n_slices;
+  f >> f_block_elems;
+  
+  if(f_header == diskio::gen_zbin_header(x))
+    {
+    f.get();
+    
+    try { x.set_size(f_n_rows, f_n_cols, f_n_slices); } catch(...) { err_msg = "not enough memory"; return false; }
+    
+    load_okay = diskio::load_zbin_array(x.memptr(), x.n_elem, f_block_elems, f, err_msg);
+    }
+  else
+    {
+    load_okay = false;
+    err_msg = "incorrect header";
+    }
+  
+  
+  // allow automatic conversion of u32/s32 cubes into u64/s64 cubes
+  
+  if(load_okay == false)
+    {
+    if( (sizeof(eT) == 8) && is_same_type<uword,eT>::yes )
+      {
+      Cube<u32>   tmp;
+      std::string junk;
+      
+      f.clear();
+      f.seekg(pos);
+      
+      load_okay = diskio::load_arma_zbinary(tmp, f, junk);
+      
+      if(load_okay)  { x = conv_to< Cube<eT> >::from(tmp); }
+      }
+    else
+    if( (sizeof(eT) == 8) && is_same_type<sword,eT>::yes )
+      {
+      Cube<s32>   tmp;
+      std::string junk;
+      
+      f.clear();
+      f.seekg(pos);
+      
+      load_okay = diskio::load_arma_zbinary(tmp, f, junk);
+      
+      if(load_okay)  { x = conv_to< Cube<eT> >::from(tmp); }
+      }
+    }
+  
+  return load_okay;
+  }
+
+
+
 //! Try to load a cube by automatically determining its type
 template<typename eT>
 inline
@@ -4639,10 +6160,12 @@ diskio::load_auto_detect(Cube<eT>& x, std::istream& f, std::string& err_msg)
   
   const char* ARMA_CUB_TXT_str = "ARMA_CUB_TXT";
   const char* ARMA_CUB_BIN_str = "ARMA_CUB_BIN";
+  const char* ARMA_CUB_ZBN_str = "ARMA_CUB_ZBN";
   const char*           P6_str = "P6";
   
   const uword ARMA_CUB_TXT_len = uword(12);
   const uword ARMA_CUB_BIN_len = uword(12);
+  const uword ARMA_CUB_ZBN_len = uword(12);
   const uword           P6_len = uword(2);
   
   podarray<char> header(ARMA_CUB_TXT_len + 1);
@@ -4667,6 +6190,11 @@ diskio::load_auto_detect(Cube<eT>& x, std::istream& f, std::string& err_msg)
     return load_arma_binary(x, f, err_msg);
     }
   else
+  if( std::strncmp(ARMA_CUB_ZBN_str, header_mem, size_t(ARMA_CUB_ZBN_len)) == 0 )
+    {
+    return load_arma_zbinary(x, f, err_msg);
+    }
+  else
   if( std::strncmp(P6_str, header_mem, size_t(P6_len)) == 0 )
     {
     return load_ppm_binary(x, f, err_msg);
@@ -4859,6 +6387,159 @@ diskio::load_arma_binary(field<T1>& x, std::istream& f, std::string& err_msg)
 
 
 
+template<typename T1>
+inline
+bool
+diskio::save_arma_zbinary(const field<T1>& x, const std::string& final_name)
+  {
+  arma_debug_sigprint();
+  
+  const std::string tmp_name = diskio::gen_tmp_name(final_name);
+  
+  std::ofstream f( tmp_name, std::fstream::binary );
+  
+  bool save_okay = f.is_open();
+  
+  if(save_okay)
+    {
+    save_okay = diskio::save_arma_zbinary(x, f);
+    
+    f.flush();
+    f.close();
+    
+    if(save_okay)  { save_okay = diskio::safe_rename(tmp_name, final_name); }
+    }
+  
+  return save_okay;
+  }
+
+
+
+template<typename T1>
+inline
+bool
+diskio::save_arma_zbinary(const field<T1>& x, std::ostream& f)
+  {
+  arma_debug_sigprint();
+  
+  arma_type_check(( (is_Mat<T1>::value == false) && (is_Cube<T1>::value == false) ));
+  
+  if(x.n_slices <= 1)
+    {
+    f << "ARMA_FLD_ZBN" << '\n';
+    f << x.n_rows       << '\n';
+    f << x.n_cols       << '\n';
+    }
+  else
+    {
+    f << "ARMA_FL3_ZBN" << '\n';
+    f << x.n_rows       << '\n';
+    f << x.n_cols       << '\n';
+    f << x.n_slices     << '\n';
+    }
+  
+  bool save_okay = true;
+  
+  for(uword i=0; i<x.n_elem; ++i)
+    {
+    save_okay = diskio::save_arma_zbinary(x[i], f);
+    
+    if(save_okay == false)  { break; }
+    }
+  
+  return save_okay;
+  }
+
+
+
+template<typename T1>
+inline
+bool
+diskio::load_arma_zbinary(field<T1>& x, const std::string& name, std::string& err_msg)
+  {
+  arma_debug_sigprint();
+  
+  std::ifstream f( name, std::fstream::binary );
+  
+  bool load_okay = f.is_open();
+  
+  if(load_okay)
+    {
+    load_okay = diskio::load_arma_zbinary(x, f, err_msg);
+    f.close();
+    }
+  
+  return load_okay;
+  }
+
+
+
+template<typename T1>
+inline
+bool
+diskio::load_arma_zbinary(field<T1>& x, std::istream& f, std::string& err_msg)
+  {
+  arma_debug_sigprint();
+  
+  arma_type_check(( (is_Mat<T1>::value == false) && (is_Cube<T1>::value == false) ));
+  
+  bool load_okay = true;
+  
+  std::string f_type;
+  f >> f_type;
+  
+  if(f_type == "ARMA_FLD_ZBN")
+    {
+    uword f_n_rows;
+    uword f_n_cols;
+    
+    f >> f_n_rows;
+    f >> f_n_cols;
+    
+    try { x.set_size(f_n_rows, f_n_cols); } catch(...) { err_msg = "not enough memory"; return false; }
+    
+    f.get();
+    
+    for(uword i=0; i<x.n_elem; ++i)
+      {
+      load_okay = diskio::load_arma_zbinary(x[i], f, err_msg);
+      
+      if(load_okay == false)  { break; }
+      }
+    }
+  else
+  if(f_type == "ARMA_FL3_ZBN")
+    {
+    uword f_n_rows;
+    uword f_n_cols;
+    uword f_n_slices;
+    
+    f >> f_n_rows;
+    f >> f_n_cols;
+    f >> f_n_slices;
+    
+    try { x.set_size(f_n_rows, f_n_cols, f_n_slices); } catch(...) { err_msg = "not enough memory"; return false; }
+    
+    f.get();
+    
+    for(uword i=0; i<x.n_elem; ++i)
+      {
+      load_okay = diskio::load_arma_zbinary(x[i], f, err_msg);
+      
+      if(load_okay == false)  { break; }
+      }
+    }
+  else
+    {
+    load_okay = false;
+    err_msg = "unsupported field type";
+    }
+  
+  return load_okay;
+  }
+
+
+
 inline
 bool
 diskio::save_std_string(const field<std::string>& x, const std::string& final_name)
@@ -5039,6 +6720,8 @@ diskio::load_auto_detect(field<T1>& x, std::istream& f, std::string& err_msg)
   
   static const std::string ARMA_FLD_BIN = "ARMA_FLD_BIN";
   static const std::string ARMA_FL3_BIN = "ARMA_FL3_BIN";
+  static const std::string ARMA_FLD_ZBN = "ARMA_FLD_ZBN";
+  static const std::string ARMA_FL3_ZBN = "ARMA_FL3_ZBN";
   static const std::string           P6 = "P6";
   
   podarray<char> raw_header(uword(ARMA_FLD_BIN.length()) + 1);
@@ -5064,6 +6747,16 @@ diskio::load_auto_detect(field<T1>& x, std::istream& f, std::string& err_msg)
     return load_arma_binary(x, f, err_msg);
     }
   else
+  if(ARMA_FLD_ZBN == header.substr(0, ARMA_FLD_ZBN.length()))
+    {
+    return load_arma_zbinary(x, f, err_msg);
+    }
+  else
+  if(ARMA_FL3_ZBN == header.substr(0, ARMA_FL3_ZBN.length()))
+    {
+    return load_arma_zbinary(x, f, err_msg);
+    }
+  else
   if(P6 == header.substr(0, P6.length()))
     {
     return load_ppm_binary(x, f, err_msg);
@@ -257,6 +257,13 @@ eop_core<eop_type>::apply(outT& out, const eOp<T1, eop_type>& x)
   
   const bool use_mp = (arma_config::openmp) && (eOp<T1, eop_type>::use_mp || (is_same_type<eop_type, eop_pow>::value && (is_cx<eT>::yes || x.aux != eT(2))));
   
+  if( (vecmath::supported<eop_type,eT>::value) && (Proxy<T1>::use_at == false) )
+    {
+    typename Proxy<T1>::ea_type P = x.P.get_ea();
+    
+    if(vecmath::try_apply<eop_type>(out_mem, P, x.get_n_elem()))  { return; }
+    }
+  
   if(Proxy<T1>::use_at == false)
     {
     const uword n_elem = x.get_n_elem();
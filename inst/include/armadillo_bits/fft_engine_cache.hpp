@@ -0,0 +1,133 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2026 Dirk Eddelbuettel
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// https://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+
+//! \addtogroup fft_engine_cache
+//! @{
+
+
+//! Process-wide cache of FFT engines (twiddle factors and factorisation), keyed by transform length;
+//! separate caches exist for each engine type, ie. for each element type and direction.
+//! Cached engines are immutable and can be used concurrently by several threads.
+template<typename engine_type>
+struct fft_engine_cache
+  {
+  static constexpr uword max_entries = 32;
+  
+  typedef std::map< uword, std::shared_ptr<const engine_type> > map_type;
+  
+  inline static map_type& get_map()  { static map_type engines; return engines; }
+  
+  #if defined(ARMA_USE_STD_MUTEX)
+  inline static std::mutex& get_mutex()  { static std::mutex engines_mutex; return engines_mutex; }
+  #endif
+  
+  
+  inline
+  static
+  std::shared_ptr<const engine_type>
+  find(const uword N)
+    {
+    map_type& engines = fft_engine_cache::get_map();
+    
+    typename map_type::const_iterator it = engines.find(N);
+    
+    return (it != engines.end()) ? (*it).second : std::shared_ptr<const engine_type>();
+    }
+  
+  
+  inline
+  static
+  std::shared_ptr<const engine_type>
+  insert(const uword N, const std::shared_ptr<const engine_type>& engine)
+    {
+    map_type& engines = fft_engine_cache::get_map();
+    
+    typename map_type::const_iterator it = engines.find(N);
+    
+    if(it != engines.end())  { return (*it).second; }  // another thread got there first
+    
+    // engines still in use are kept alive by their shared_ptr
+    if(engines.size() >= max_entries)  { engines.clear(); }
+    
+    engines[N] = engine;
+    
+    return engine;
+    }
+  
+  
+  inline
+  static
+  std::shared_ptr<const engine_type>
+  get(const uword N)
+    {
+    arma_debug_sigprint();
+    
+    std::shared_ptr<const engine_type> engine;
+    
+    #if defined(ARMA_USE_OPENMP)
+      {
+      #pragma omp critical (arma_fft_engine_cache)
+        {
+        engine = fft_engine_cache::find(N);
+        }
+      }
+    #elif defined(ARMA_USE_STD_MUTEX)
+      {
+      const std::lock_guard<std::mutex> lock(fft_engine_cache::get_mutex());
+      
+      engine = fft_engine_cache::find(N);
+      }
+    #else
+      {
+      engine = fft_engine_cache::find(N);
+      }
+    #endif
+    
+    if(engine)  { return engine; }
+    
+    arma_debug_print("fft_engine_cache::get(): creating engine");
+    
+    // the engine is constructed outside of the lock, as this can be relatively slow
+    
+    const std::shared_ptr<const engine_type> new_engine = std::make_shared<const engine_type>(N);
+    
+    #if defined(ARMA_USE_OPENMP)
+      {
+      #pragma omp critical (arma_fft_engine_cache)
+        {
+        engine = fft_engine_cache::insert(N, new_engine);
+        }
+      }
+    #elif defined(ARMA_USE_STD_MUTEX)
+      {
+      const std::lock_guard<std::mutex> lock(fft_engine_cache::get_mutex());
+      
+      engine = fft_engine_cache::insert(N, new_engine);
+      }
+    #else
+      {
+      engine = fft_engine_cache::insert(N, new_engine);
+      }
+    #endif
+    
+    return engine;
+    }
+  };
+
+
+//! @}
@@ -63,11 +63,57 @@ struct fft_engine_kissfft
   const uword N;
   
   podarray<cx_type> coeffs_array;
-  podarray<cx_type> tmp_array;
   
   podarray<uword>   residue;
   podarray<uword>   radix;
   
+  uword max_radix_N = 0;  // largest radix handled by butterfly_N()
+  
+  // Bluestein's algorithm, used when the length has large prime factors:
+  // the transform is expressed as a convolution with a chirp, evaluated via transforms of a smooth length
+  
+  uword             bluestein_M = 0;
+  podarray<cx_type> bluestein_chirp;
+  podarray<cx_type> bluestein_filter;
+  
+  std::shared_ptr< const fft_engine_kissfft<cx_type,false> > bluestein_engine;
+  
+  
+  //! radices with a specialised butterfly; all other radices use butterfly_N()
+  inline
+  static
+  bool
+  has_butterfly(const uword r)
+    {
+    if(r <= 5)  { return true; }
+    
+    return (arma_config::optimise_fft) && ( (r == 7) || (r == 8) || (r == 11) || (r == 13) );
+    }
+  
+  
+  //! smallest length >= n with no prime factors other than 2, 3 and 5
+  inline
+  static
+  uword
+  smooth_length(const uword n)
+    {
+    uword best = 1;
+    
+    while(best < n)  { best *= 2; }
+    
+    for(uword p5 = 1; p5 < best; p5 *= 5)
+    for(uword p35 = p5; p35 < best; p35 *= 3)
+      {
+      uword len = p35;
+      
+      while(len < n)  { len *= 2; }
+      
+      best = (std::min)(best, len);
+      }
+    
+    return best;
+    }
+  
   
   template<bool fill>
   inline
@@ -76,18 +122,22 @@ struct fft_engine_kissfft
     {
     uword i = 0;
     
-    for(uword n = N, r=4; n >= 2; ++i)
+    for(uword n = N, r = ((arma_config::optimise_fft) ? 8 : 4); n >= 2; ++i)
       {
-      while( (n % r) > 0 )
+      // radix 8 is skipped when n has exactly 2^4 as a factor, as 4*4 is faster than 8*2
+      
+      while( ((n % r) > 0) || ((r == 8) && ((n % 16) == 0) && ((n % 32) != 0)) )
         {
         switch(r)
           {
+          case 8:  r  = 4; break;
           case 2:  r  = 3; break;
           case 4:  r  = 2; break;
           default: r += 2; break;
           }
         
-        if(r*r > n) { r = n; }
+        // once only odd candidates remain, n is prime if it has no factor up to sqrt(n)
+        if( ((r % 2) == 1) && (r*r > n) ) { r = n; }
         }
       
       n /= r;
@@ -117,6 +167,36 @@ struct fft_engine_kissfft
     
     calc_radix<true>();
     
+    uword slow_sum = 0;  // sum of the radices handled by butterfly_N(), each costing O(radix) per element
+    
+    for(uword i=0; i < len; ++i)
+      {
+      if(has_butterfly(radix[i]) == false)
+        {
+        max_radix_N = (std::max)(max_radix_N, radix[i]);
+        slow_sum   += radix[i];
+        }
+      }
+    
+    if( (arma_config::optimise_fft) && (slow_sum > 0) )
+      {
+      // Bluestein's algorithm costs two transforms of length M >= 2N-1, plus O(M) work;
+      // comparing N*slow_sum against M*log2(M) puts the crossover near a prime factor of 17 in timings
+      
+      const uword M = smooth_length(2*N - 1);
+      
+      uword log2_M = 0;
+      
+      for(uword n = M; n > 1; n /= 2)  { ++log2_M; }
+      
+      if( double(N) * double(slow_sum) > double(M) * double(log2_M) )
+        {
+        init_bluestein(M);
+        
+        return;
+        }
+      }
+    
     
     // calculate the constant coefficients
     
@@ -131,6 +211,57 @@ struct fft_engine_kissfft
   
   
   
+  inline
+  void
+  init_bluestein(const uword M)
+    {
+    arma_debug_sigprint();
+    
+    bluestein_M = M;
+    
+    bluestein_engine = std::make_shared< const fft_engine_kissfft<cx_type,false> >(M);
+    
+    // chirp[n] = exp(-i*pi*n^2/N) for the forward transform, conjugated for the inverse;
+    // n^2 is reduced modulo 2N to retain accuracy for large n
+    
+    bluestein_chirp.set_size(N);
+    
+    cx_type* chirp = bluestein_chirp.memptr();
+    
+    const T k = T( (inverse) ? +1 : -1 ) * std::acos( T(-1) ) / T(N);
+    
+    const uword two_N = 2*N;
+    
+    uword n_sq = 0;
+    
+    for(uword n=0; n < N; ++n)
+      {
+      chirp[n] = std::exp( cx_type(T(0), T(n_sq)*k) );
+      
+      n_sq += 2*n + 1;
+      
+      while(n_sq >= two_N)  { n_sq -= two_N; }
+      }
+    
+    // transform of the conjugated chirp, arranged for circular convolution and scaled by 1/M
+    
+    podarray<cx_type> b(M, arma_zeros_indicator());
+    
+    cx_type* b_mem = b.memptr();
+    
+    b_mem[0] = std::conj(chirp[0]);
+    
+    for(uword n=1; n < N; ++n)  { b_mem[n] = b_mem[M-n] = std::conj(chirp[n]); }
+    
+    bluestein_filter.set_size(M);
+    
+    bluestein_engine->run(bluestein_filter.memptr(), b_mem);
+    
+    arrayops::inplace_mul(bluestein_filter.memptr(), cx_type(T(1) / T(M)), M);
+    }
+  
+  
+  
   arma_hot
   inline
   void
@@ -307,14 +438,148 @@ struct fft_engine_kissfft
   arma_hot
   inline
   void
-  butterfly_N(cx_type* Y, const uword stride, const uword m, const uword r)
+  butterfly_8(cx_type* Y, const uword stride, const uword m) const
     {
     // arma_debug_sigprint();
     
     const cx_type* coeffs = coeffs_array.memptr();
     
-    tmp_array.set_min_size(r);
-    cx_type* tmp = tmp_array.memptr();
+    const T h = std::sqrt( T(0.5) );
+    
+    // sign of the imaginary unit in the factors: -1 for the forward transform, +1 for the inverse
+    const T s = (inverse) ? T(+1) : T(-1);
+    
+    for(uword i=0; i < m; ++i)
+      {
+      T re[8];
+      T im[8];
+      
+      re[0] = Y[i].real();
+      im[0] = Y[i].imag();
+      
+      for(uword q=1; q < 8; ++q)
+        {
+        const cx_type& y = Y[i + q*m];
+        const cx_type& c = coeffs[q*i*stride];
+        
+        re[q] = y.real()*c.real() - y.imag()*c.imag();
+        im[q] = y.real()*c.imag() + y.imag()*c.real();
+        }
+      
+      // first stage: pairs q and q+4
+      
+      const T a0r = re[0] + re[4];  const T a0i = im[0] + im[4];
+      const T b0r = re[0] - re[4];  const T b0i = im[0] - im[4];
+      const T a1r = re[1] + re[5];  const T a1i = im[1] + im[5];
+      const T b1r = re[1] - re[5];  const T b1i = im[1] - im[5];
+      const T a2r = re[2] + re[6];  const T a2i = im[2] + im[6];
+      const T b2r = re[2] - re[6];  const T b2i = im[2] - im[6];
+      const T a3r = re[3] + re[7];  const T a3i = im[3] + im[7];
+      const T b3r = re[3] - re[7];  const T b3i = im[3] - im[7];
+      
+      // multiply b1, b2, b3 by exp(s*i*pi*k/4) for k = 1, 2, 3
+      
+      const T c1r = h*(b1r - s*b1i);  const T c1i = h*(b1i + s*b1r);
+      const T c2r =     -s*b2i;       const T c2i =      s*b2r;
+      const T c3r = h*(-b3r - s*b3i); const T c3i = h*(-b3i + s*b3r);
+      
+      // transforms of length 4 over (a0,a1,a2,a3) and (b0,c1,c2,c3)
+      
+      const T e0r = a0r + a2r;  const T e0i = a0i + a2i;
+      const T e1r = a0r - a2r;  const T e1i = a0i - a2i;
+      const T e2r = a1r + a3r;  const T e2i = a1i + a3i;
+      const T e3r = -s*(a1i - a3i);  const T e3i = s*(a1r - a3r);
+      
+      const T f0r = b0r + c2r;  const T f0i = b0i + c2i;
+      const T f1r = b0r - c2r;  const T f1i = b0i - c2i;
+      const T f2r = c1r + c3r;  const T f2i = c1i + c3i;
+      const T f3r = -s*(c1i - c3i);  const T f3i = s*(c1r - c3r);
+      
+      Y[i      ] = cx_type(e0r + e2r, e0i + e2i);
+      Y[i + 4*m] = cx_type(e0r - e2r, e0i - e2i);
+      Y[i + 2*m] = cx_type(e1r + e3r, e1i + e3i);
+      Y[i + 6*m] = cx_type(e1r - e3r, e1i - e3i);
+      Y[i +   m] = cx_type(f0r + f2r, f0i + f2i);
+      Y[i + 5*m] = cx_type(f0r - f2r, f0i - f2i);
+      Y[i + 3*m] = cx_type(f1r + f3r, f1i + f3i);
+      Y[i + 7*m] = cx_type(f1r - f3r, f1i - f3i);
+      }
+    }
+  
+  
+  
+  //! butterfly for an odd prime radix r, exploiting the symmetry of the factors:
+  //! inputs q and r-q are combined, requiring (r-1)^2/2 real-by-complex multiplications instead of r^2 complex multiplications
+  template<uword r>
+  arma_hot
+  inline
+  void
+  butterfly_odd(cx_type* Y, const uword stride, const uword m) const
+    {
+    // arma_debug_sigprint();
+    
+    constexpr uword h = (r-1)/2;
+    
+    const cx_type* coeffs = coeffs_array.memptr();
+    
+    arma_aligned T w_real[r];
+    arma_aligned T w_imag[r];
+    
+    for(uword j=0; j < r; ++j)  { w_real[j] = coeffs[stride*m*j].real();  w_imag[j] = coeffs[stride*m*j].imag(); }
+    
+    arma_aligned cx_type sum[h];
+    arma_aligned cx_type dif[h];
+    
+    for(uword i=0; i < m; ++i)
+      {
+      const cx_type t0 = Y[i];
+      
+      cx_type acc = t0;
+      
+      for(uword q=1; q <= h; ++q)
+        {
+        const cx_type a = Y[i +    q *m] * coeffs[   q *i*stride];
+        const cx_type b = Y[i + (r-q)*m] * coeffs[(r-q)*i*stride];
+        
+        sum[q-1] = a + b;
+        dif[q-1] = a - b;
+        
+        acc += sum[q-1];
+        }
+      
+      Y[i] = acc;
+      
+      for(uword k=1; k <= h; ++k)
+        {
+        cx_type even = t0;
+        cx_type odd  = cx_type(T(0), T(0));
+        
+        for(uword q=1; q <= h; ++q)
+          {
+          const uword j = (q*k) % r;
+          
+          even += sum[q-1] * w_real[j];
+          odd  += dif[q-1] * w_imag[j];
+          }
+        
+        // odd part is multiplied by i
+        
+        Y[i +    k *m] = cx_type( even.real() - odd.imag(), even.imag() + odd.real() );
+        Y[i + (r-k)*m] = cx_type( even.real() + odd.imag(), even.imag() - odd.real() );
+        }
+      }
+    }
+  
+  
+  
+  arma_hot
+  inline
+  void
+  butterfly_N(cx_type* Y, const uword stride, const uword m, const uword r, cx_type* tmp) const
+    {
+    // arma_debug_sigprint();
+    
+    const cx_type* coeffs = coeffs_array.memptr();
     
     for(uword u=0; u < m; ++u)
       {
@@ -350,12 +615,61 @@ struct fft_engine_kissfft
   
   
   
+  //! the engine is not modified by run(), so a single engine can be shared by several threads
   inline
   void
-  run(cx_type* Y, const cx_type* X, const uword stage = 0, const uword stride = 1)
+  run(cx_type* Y, const cx_type* X) const
     {
     arma_debug_sigprint();
     
+    if(N <= 1)  { if(N == 1)  { Y[0] = X[0]; }  return; }
+    
+    if(bluestein_M > 0)  { run_bluestein(Y, X); return; }
+    
+    podarray<cx_type> tmp(max_radix_N);
+    
+    run_stage(Y, X, 0, 1, tmp.memptr());
+    }
+  
+  
+  
+  inline
+  void
+  run_bluestein(cx_type* Y, const cx_type* X) const
+    {
+    arma_debug_sigprint();
+    
+    const uword M = bluestein_M;
+    
+    podarray<cx_type> buffer(2*M);
+    
+    cx_type* A = buffer.memptr();
+    cx_type* B = A + M;
+    
+    const cx_type* chirp  = bluestein_chirp.memptr();
+    const cx_type* filter = bluestein_filter.memptr();
+    
+    for(uword n=0; n < N; ++n)  { A[n] = X[n] * chirp[n]; }
+    
+    arrayops::fill_zeros(A + N, M - N);
+    
+    bluestein_engine->run(B, A);
+    
+    // the inverse transform is evaluated as the conjugate of the forward transform of the conjugate
+    
+    for(uword k=0; k < M; ++k)  { A[k] = std::conj(B[k] * filter[k]); }
+    
+    bluestein_engine->run(B, A);
+    
+    for(uword k=0; k < N; ++k)  { Y[k] = chirp[k] * std::conj(B[k]); }
+    }
+  
+  
+  
+  inline
+  void
+  run_stage(cx_type* Y, const cx_type* X, const uword stage, const uword stride, cx_type* tmp) const
+    {
     const uword m = residue[stage];
     const uword r =   radix[stage];
     
@@ -370,18 +684,113 @@ struct fft_engine_kissfft
       const uword next_stage  = stage + 1;
       const uword next_stride = stride * r;
       
-      for(cx_type* Yi = Y; Yi != Y_end; Yi += m, X += stride)  { run(Yi, X, next_stage, next_stride); }
+      for(cx_type* Yi = Y; Yi != Y_end; Yi += m, X += stride)  { run_stage(Yi, X, next_stage, next_stride, tmp); }
       }
     
-    switch(r)
+    switch( (has_butterfly(r)) ? r : uword(0) )
+      {
+      case 2:  butterfly_2      (Y, stride, m        );  break;
+      case 3:  butterfly_3      (Y, stride, m        );  break;
+      case 4:  butterfly_4      (Y, stride, m        );  break;
+      case 5:  butterfly_5      (Y, stride, m        );  break;
+      case 7:  butterfly_odd<7> (Y, stride, m        );  break;
+      case 8:  butterfly_8      (Y, stride, m        );  break;
+      case 11: butterfly_odd<11>(Y, stride, m        );  break;
+      case 13: butterfly_odd<13>(Y, stride, m        );  break;
+      default: butterfly_N      (Y, stride, m, r, tmp);  break;
+      }
+    }
+  };
+
+
+
+//! Forward transform of real data of even length N, via a complex transform of length N/2:
+//! the even and odd samples are packed as the real and imaginary parts of N/2 complex numbers,
+//! and the spectrum is recovered from the half-length result using the conjugate symmetry of real data
+template<typename cx_type>
+struct fft_engine_kissfft_real
+  {
+  typedef typename get_pod_type<cx_type>::result T;
+  
+  const uword N;
+  const uword M;
+  
+  const fft_engine_kissfft<cx_type,false> half;
+  
+  podarray<cx_type> twiddles;
+  
+  
+  inline
+  fft_engine_kissfft_real(const uword in_N)
+    : N(in_N)
+    , M(in_N/2)
+    , half(in_N/2)
+    {
+    arma_debug_sigprint();
+    
+    arma_conform_check( ((N % 2) != 0), "fft_engine_kissfft_real: length must be even" );
+    
+    twiddles.set_size(M);
+    
+    cx_type* tw = twiddles.memptr();
+    
+    const T k = T(-2) * std::acos( T(-1) ) / T(N);
+    
+    for(uword i=0; i < M; ++i)  { tw[i] = std::exp( cx_type(T(0), i*k) ); }
+    }
+  
+  
+  
+  //! Y must have space for N elements; X holds N real values, which are read as N/2 complex numbers
+  inline
+  void
+  run(cx_type* Y, const T* X) const
+    {
+    arma_debug_sigprint();
+    
+    half.run(Y, reinterpret_cast<const cx_type*>(X));
+    
+    const cx_type* tw = twiddles.memptr();
+    
+    const cx_type Z0 = Y[0];
+    
+    Y[0] = cx_type( (Z0.real() + Z0.imag()), T(0) );
+    Y[M] = cx_type( (Z0.real() - Z0.imag()), T(0) );
+    
+    // the outputs for k and M-k depend on Z[k] and Z[M-k] only, so they are computed in pairs and stored in place
+    
+    for(uword k=1; k <= M/2; ++k)
       {
-      case 2:  butterfly_2(Y, stride, m   );  break;
-      case 3:  butterfly_3(Y, stride, m   );  break;
-      case 4:  butterfly_4(Y, stride, m   );  break;
-      case 5:  butterfly_5(Y, stride, m   );  break;
-      default: butterfly_N(Y, stride, m, r);  break;
+      const uword j = M - k;
+      
+      const cx_type Zk = Y[k];
+      const cx_type Zj = Y[j];
+      
+      const cx_type Xk = fft_engine_kissfft_real<cx_type>::combine(Zk, Zj, tw[k]);
+      const cx_type Xj = fft_engine_kissfft_real<cx_type>::combine(Zj, Zk, tw[j]);
+      
+      Y[k] = Xk;
+      Y[j] = Xj;
+      
+      Y[N-k] = std::conj(Xk);
+      Y[N-j] = std::conj(Xj);
       }
     }
+  
+  
+  
+  arma_inline
+  static
+  cx_type
+  combine(const cx_type& A, const cx_type& B, const cx_type& w)
+    {
+    // even part: (A + conj(B))/2;  odd part: (A - conj(B))/(2i)
+    
+    const cx_type even( T(0.5)*(A.real() + B.real()), T(0.5)*(A.imag() - B.imag()) );
+    const cx_type  odd( T(0.5)*(A.imag() + B.imag()), T(0.5)*(B.real() - A.real()) );
+    
+    return even + w*odd;
+    }
   };
 
 
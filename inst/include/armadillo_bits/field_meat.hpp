@@ -2669,6 +2669,10 @@ field_aux::save(const field< Mat<eT> >& x, const std::string& name, const file_t
     case arma_binary:
       return diskio::save_arma_binary(x, name);
       break;
+    
+    case arma_zbinary:
+      return diskio::save_arma_zbinary(x, name);
+      break;
       
     case ppm_binary:
       return diskio::save_ppm_binary(x, name);
@@ -2694,6 +2698,10 @@ field_aux::save(const field< Mat<eT> >& x, std::ostream& os, const file_type typ
     case arma_binary:
       return diskio::save_arma_binary(x, os);
       break;
+    
+    case arma_zbinary:
+      return diskio::save_arma_zbinary(x, os);
+      break;
       
     case ppm_binary:
       return diskio::save_ppm_binary(x, os);
@@ -2723,6 +2731,10 @@ field_aux::load(field< Mat<eT> >& x, const std::string& name, const file_type ty
     case arma_binary:
       return diskio::load_arma_binary(x, name, err_msg);
       break;
+    
+    case arma_zbinary:
+      return diskio::load_arma_zbinary(x, name, err_msg);
+      break;
       
     case ppm_binary:
       return diskio::load_ppm_binary(x, name, err_msg);
@@ -2752,6 +2764,10 @@ field_aux::load(field< Mat<eT> >& x, std::istream& is, const file_type type, std
     case arma_binary:
       return diskio::load_arma_binary(x, is, err_msg);
       break;
+    
+    case arma_zbinary:
+      return diskio::load_arma_zbinary(x, is, err_msg);
+      break;
       
     case ppm_binary:
       return diskio::load_ppm_binary(x, is, err_msg);
@@ -2777,6 +2793,10 @@ field_aux::save(const field< Col<eT> >& x, const std::string& name, const file_t
     case arma_binary:
       return diskio::save_arma_binary(x, name);
       break;
+    
+    case arma_zbinary:
+      return diskio::save_arma_zbinary(x, name);
+      break;
       
     case ppm_binary:
       return diskio::save_ppm_binary(x, name);
@@ -2802,6 +2822,10 @@ field_aux::save(const field< Col<eT> >& x, std::ostream& os, const file_type typ
     case arma_binary:
       return diskio::save_arma_binary(x, os);
       break;
+    
+    case arma_zbinary:
+      return diskio::save_arma_zbinary(x, os);
+      break;
       
     case ppm_binary:
       return diskio::save_ppm_binary(x, os);
@@ -2831,6 +2855,10 @@ field_aux::load(field< Col<eT> >& x, const std::string& name, const file_type ty
     case arma_binary:
       return diskio::load_arma_binary(x, name, err_msg);
       break;
+    
+    case arma_zbinary:
+      return diskio::load_arma_zbinary(x, name, err_msg);
+      break;
       
     case ppm_binary:
       return diskio::load_ppm_binary(x, name, err_msg);
@@ -2860,6 +2888,10 @@ field_aux::load(field< Col<eT> >& x, std::istream& is, const file_type type, std
     case arma_binary:
       return diskio::load_arma_binary(x, is, err_msg);
       break;
+    
+    case arma_zbinary:
+      return diskio::load_arma_zbinary(x, is, err_msg);
+      break;
       
     case ppm_binary:
       return diskio::load_ppm_binary(x, is, err_msg);
@@ -2885,6 +2917,10 @@ field_aux::save(const field< Row<eT> >& x, const std::string& name, const file_t
     case arma_binary:
       return diskio::save_arma_binary(x, name);
       break;
+    
+    case arma_zbinary:
+      return diskio::save_arma_zbinary(x, name);
+      break;
       
     case ppm_binary:
       return diskio::save_ppm_binary(x, name);
@@ -2910,6 +2946,10 @@ field_aux::save(const field< Row<eT> >& x, std::ostream& os, const file_type typ
     case arma_binary:
       return diskio::save_arma_binary(x, os);
       break;
+    
+    case arma_zbinary:
+      return diskio::save_arma_zbinary(x, os);
+      break;
       
     case ppm_binary:
       return diskio::save_ppm_binary(x, os);
@@ -2939,6 +2979,10 @@ field_aux::load(field< Row<eT> >& x, const std::string& name, const file_type ty
     case arma_binary:
       return diskio::load_arma_binary(x, name, err_msg);
       break;
+    
+    case arma_zbinary:
+      return diskio::load_arma_zbinary(x, name, err_msg);
+      break;
       
     case ppm_binary:
       return diskio::load_ppm_binary(x, name, err_msg);
@@ -2968,6 +3012,10 @@ field_aux::load(field< Row<eT> >& x, std::istream& is, const file_type type, std
     case arma_binary:
       return diskio::load_arma_binary(x, is, err_msg);
       break;
+    
+    case arma_zbinary:
+      return diskio::load_arma_zbinary(x, is, err_msg);
+      break;
       
     case ppm_binary:
       return diskio::load_ppm_binary(x, is, err_msg);
@@ -2994,6 +3042,10 @@ field_aux::save(const field< Cube<eT> >& x, const std::string& name, const file_
       return diskio::save_arma_binary(x, name);
       break;
     
+    case arma_zbinary:
+      return diskio::save_arma_zbinary(x, name);
+      break;
+    
     default:
       err_msg = "unsupported type";
       return false;
@@ -3015,6 +3067,10 @@ field_aux::save(const field< Cube<eT> >& x, std::ostream& os, const file_type ty
       return diskio::save_arma_binary(x, os);
       break;
     
+    case arma_zbinary:
+      return diskio::save_arma_zbinary(x, os);
+      break;
+    
     default:
       err_msg = "unsupported type";
       return false;
@@ -3037,6 +3093,10 @@ field_aux::load(field< Cube<eT> >& x, const std::string& name, const file_type t
       return diskio::load_arma_binary(x, name, err_msg);
       break;
     
+    case arma_zbinary:
+      return diskio::load_arma_zbinary(x, name, err_msg);
+      break;
+    
     default:
       err_msg = "unsupported type";
       return false;
@@ -3058,6 +3118,10 @@ field_aux::load(field< Cube<eT> >& x, std::istream& is, const file_type type, st
     case arma_binary:
       return diskio::load_arma_binary(x, is, err_msg);
       break;
+    
+    case arma_zbinary:
+      return diskio::load_arma_zbinary(x, is, err_msg);
+      break;
       
     default:
       err_msg = "unsupported type";
@@ -51,4 +51,55 @@ cor(const Base<typename T1::elem_type,T1>& A, const Base<typename T1::elem_type,
 
 
 
+//! weighted correlation; each row of X is an observation with weight w(i)
+template<typename T1, typename T2>
+arma_warn_unused
+inline
+Mat<typename T1::elem_type>
+wcor(const Base<typename T1::elem_type,T1>& X, const Base<typename T1::elem_type,T2>& w)
+  {
+  arma_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  
+  Mat<eT> out = wcov(X, w, 1);
+  
+  const Col<eT> s = sqrt(out.diag());
+  
+  out /= (s * s.t());
+  
+  return out;
+  }
+
+
+
+//! correlation using pairwise-complete observations: non-finite elements are ignored
+//! separately for each pair of columns
+template<typename T1>
+arma_warn_unused
+inline
+typename enable_if2< is_real<typename T1::elem_type>::value, Mat<typename T1::elem_type> >::result
+cor_pairwise(const Base<typename T1::elem_type,T1>& X)
+  {
+  arma_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  
+  const quasi_unwrap<T1> U(X.get_ref());
+  
+  const Mat<eT>& A = U.M;
+  
+  Mat<eT> out;
+  
+  if(A.n_elem == 0)  { return out; }
+  
+  const Mat<eT> AA(const_cast<eT*>(A.memptr()), ((A.n_rows == 1) ? A.n_cols : A.n_rows), ((A.n_rows == 1) ? A.n_rows : A.n_cols), false, true);
+  
+  op_cov::direct_cov_pairwise(out, AA, 0, true);
+  
+  return out;
+  }
+
+
+
 //! @}
@@ -51,4 +51,96 @@ cov(const Base<typename T1::elem_type,T1>& A, const Base<typename T1::elem_type,
 
 
 
+//! weighted covariance; each row of X is an observation with weight w(i)
+template<typename T1, typename T2>
+arma_warn_unused
+inline
+Mat<typename T1::elem_type>
+wcov(const Base<typename T1::elem_type,T1>& X, const Base<typename T1::elem_type,T2>& w, const uword norm_type = 0)
+  {
+  arma_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  
+  arma_conform_check( (norm_type > 1), "wcov(): parameter 'norm_type' must be 0 or 1" );
+  
+  const quasi_unwrap<T1> UX(X.get_ref());
+  const quasi_unwrap<T2> UW(w.get_ref());
+  
+  const Mat<eT>& A = UX.M;
+  
+  Mat<eT> out;
+  
+  if(A.n_elem == 0)  { return out; }
+  
+  const Mat<eT> AA(const_cast<eT*>(A.memptr()), ((A.n_rows == 1) ? A.n_cols : A.n_rows), ((A.n_rows == 1) ? A.n_rows : A.n_cols), false, true);
+  
+  op_cov::direct_wcov(out, AA, UW.M, norm_type);
+  
+  return out;
+  }
+
+
+
+//! covariance using pairwise-complete observations: non-finite elements are ignored
+//! separately for each pair of columns
+template<typename T1>
+arma_warn_unused
+inline
+typename enable_if2< is_real<typename T1::elem_type>::value, Mat<typename T1::elem_type> >::result
+cov_pairwise(const Base<typename T1::elem_type,T1>& X, const uword norm_type = 0)
+  {
+  arma_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  
+  arma_conform_check( (norm_type > 1), "cov_pairwise(): parameter 'norm_type' must be 0 or 1" );
+  
+  const quasi_unwrap<T1> U(X.get_ref());
+  
+  const Mat<eT>& A = U.M;
+  
+  Mat<eT> out;
+  
+  if(A.n_elem == 0)  { return out; }
+  
+  const Mat<eT> AA(const_cast<eT*>(A.memptr()), ((A.n_rows == 1) ? A.n_cols : A.n_rows), ((A.n_rows == 1) ? A.n_rows : A.n_cols), false, true);
+  
+  op_cov::direct_cov_pairwise(out, AA, norm_type, false);
+  
+  return out;
+  }
+
+
+
+//! upper triangle of the covariance matrix (including the diagonal), packed column by column
+template<typename T1>
+arma_warn_unused
+inline
+Col<typename T1::elem_type>
+cov_packed(const Base<typename T1::elem_type,T1>& X, const uword norm_type = 0)
+  {
+  arma_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  
+  arma_conform_check( (norm_type > 1), "cov_packed(): parameter 'norm_type' must be 0 or 1" );
+  
+  const quasi_unwrap<T1> U(X.get_ref());
+  
+  const Mat<eT>& A = U.M;
+  
+  Col<eT> out;
+  
+  if(A.n_elem == 0)  { return out; }
+  
+  const Mat<eT> AA(const_cast<eT*>(A.memptr()), ((A.n_rows == 1) ? A.n_cols : A.n_rows), ((A.n_rows == 1) ? A.n_rows : A.n_cols), false, true);
+  
+  op_cov::direct_cov_packed(out, AA, norm_type);
+  
+  return out;
+  }
+
+
+
 //! @}
@@ -42,7 +42,22 @@ spsolve_helper
   
   const char sig = (solver != nullptr) ? solver[0] : char(0);
   
-  arma_conform_check( ((sig != 'l') && (sig != 's')), "spsolve(): unknown solver" );
+  arma_conform_check( ((sig != 'l') && (sig != 's') && (sig != 'c') && (sig != 'b') && (sig != 'g')), "spsolve(): unknown solver" );
+  
+  if( (sig == 'c') || (sig == 'b') || (sig == 'g') )  // native iterative solvers: "cg", "bicgstab", "gmres"
+    {
+    if(settings.id == 1)  { arma_warn(1, "spsolve(): ignoring settings not applicable to iterative solvers"); }
+    
+    const iterative_opts iterative_opts_default;
+    
+    iterative_opts local_opts( (settings.id == 2) ? static_cast<const iterative_opts&>(settings) : iterative_opts_default );
+    
+         if(sig == 'c')  { local_opts.solver = iterative_opts::CG;       }
+    else if(sig == 'b')  { local_opts.solver = iterative_opts::BICGSTAB; }
+    else if(sig == 'g')  { local_opts.solver = iterative_opts::GMRES;    }
+    
+    return sp_iterative::apply(out, A.get_ref(), B.get_ref(), local_opts);
+    }
   
   T rcond = T(0);
   
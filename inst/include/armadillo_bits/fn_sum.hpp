@@ -144,4 +144,23 @@ sum(const T1& x, const uword dim)
 
 
 
+//! sum of CSR sparse matrix;
+//! row sums of a CSR matrix are column sums of its column-major transpose
+template<typename eT>
+arma_warn_unused
+inline
+SpMat<eT>
+sum(const SpMatR<eT>& x, const uword dim = 0)
+  {
+  arma_debug_sigprint();
+  
+  arma_conform_check( (dim > 1), "sum(): parameter 'dim' must be 0 or 1" );
+  
+  const SpMat<eT> tmp = sum(x.st(), ((dim == 0) ? uword(1) : uword(0)));
+  
+  return tmp.st();
+  }
+
+
+
 //! @}
@@ -0,0 +1,70 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2026 Dirk Eddelbuettel
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// https://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+
+//! \addtogroup fn_summarise
+//! @{
+
+
+
+//! obtain mean, variance, min, max, number of finite and non-finite elements for each column (dim=0) or row (dim=1),
+//! using one pass through the data
+template<typename T1>
+arma_warn_unused
+inline
+typename
+enable_if2
+  <
+  is_arma_type<T1>::value && is_real<typename T1::elem_type>::value,
+  summary_stats<typename T1::elem_type>
+  >::result
+summarise(const T1& X, const uword norm_type = 0, const uword dim = 0)
+  {
+  arma_debug_sigprint();
+  
+  summary_stats<typename T1::elem_type> out;
+  
+  op_summary::apply(out, X, norm_type, dim);
+  
+  return out;
+  }
+
+
+
+template<typename T1>
+arma_warn_unused
+inline
+typename
+enable_if2
+  <
+  is_arma_sparse_type<T1>::value && is_real<typename T1::elem_type>::value,
+  summary_stats<typename T1::elem_type>
+  >::result
+summarise(const T1& X, const uword norm_type = 0, const uword dim = 0)
+  {
+  arma_debug_sigprint();
+  
+  summary_stats<typename T1::elem_type> out;
+  
+  op_summary::apply(out, X, norm_type, dim);
+  
+  return out;
+  }
+
+
+
+//! @}
@@ -32,6 +32,7 @@ svds_helper
   const uword                              k,
   const typename T1::pod_type              tol,
   const bool                               calc_UV,
+  const eigs_opts&                         in_opts,
   const typename arma_blas_real_only<typename T1::elem_type>::result* junk = nullptr
   )
   {
@@ -83,7 +84,7 @@ svds_helper
     Col<eT> eigval;
     Mat<eT> eigvec;
     
-    eigs_opts opts;
+    eigs_opts opts = in_opts;
     opts.tol = (tol / Datum<T>::sqrt2);
     
     const bool status = eigs_sym(eigval, eigvec, C, kk, "la", opts);
@@ -150,6 +151,7 @@ svds_helper
   const uword                              k,
   const typename T1::pod_type              tol,
   const bool                               calc_UV,
+  const eigs_opts&                         in_opts,
   const typename arma_blas_cx_only<typename T1::elem_type>::result* junk = nullptr
   )
   {
@@ -207,7 +209,7 @@ svds_helper
     Col<eT> eigval_tmp;
     Mat<eT> eigvec;
     
-    eigs_opts opts;
+    eigs_opts opts = in_opts;
     opts.tol = (tol / Datum<T>::sqrt2);
     
     const bool status = eigs_gen(eigval_tmp, eigvec, C, kk, "lr", opts);
@@ -282,7 +284,7 @@ svds
   arma_debug_sigprint();
   arma_ignore(junk);
   
-  const bool status = svds_helper(U, S, V, X.get_ref(), k, tol, true);
+  const bool status = svds_helper(U, S, V, X.get_ref(), k, tol, true, eigs_opts());
   
   if(status == false)  { arma_warn(3, "svds(): decomposition failed"); }
 
@@ -310,7 +312,7 @@ svds
   Mat<typename T1::elem_type> U;
   Mat<typename T1::elem_type> V;
   
-  const bool status = svds_helper(U, S, V, X.get_ref(), k, tol, false);
+  const bool status = svds_helper(U, S, V, X.get_ref(), k, tol, false, eigs_opts());
   
   if(status == false)  { arma_warn(3, "svds(): decomposition failed"); }
   
@@ -340,7 +342,7 @@ svds
   Mat<typename T1::elem_type> U;
   Mat<typename T1::elem_type> V;
   
-  const bool status = svds_helper(U, S, V, X.get_ref(), k, tol, false);
+  const bool status = svds_helper(U, S, V, X.get_ref(), k, tol, false, eigs_opts());
   
   if(status == false)  { arma_stop_runtime_error("svds(): decomposition failed"); }
   
@@ -349,4 +351,63 @@ svds
 
 
 
+//! find the k largest singular values and corresponding singular vectors of sparse matrix X, with options for the underlying eigensolver
+template<typename T1>
+inline
+bool
+svds
+  (
+           Mat<typename T1::elem_type>&    U,
+           Col<typename T1::pod_type >&    S,
+           Mat<typename T1::elem_type>&    V,
+  const SpBase<typename T1::elem_type,T1>& X,
+  const uword                              k,
+  const eigs_opts&                         opts,
+  const typename arma_blas_real_or_cx_only<typename T1::elem_type>::result* junk = nullptr
+  )
+  {
+  arma_debug_sigprint();
+  arma_ignore(junk);
+  
+  typedef typename T1::pod_type T;
+  
+  const bool status = svds_helper(U, S, V, X.get_ref(), k, T(opts.tol), true, opts);
+  
+  if(status == false)  { arma_warn(3, "svds(): decomposition failed"); }
+  
+  return status;
+  }
+
+
+
+//! find the k largest singular values of sparse matrix X, with options for the underlying eigensolver
+template<typename T1>
+inline
+bool
+svds
+  (
+           Col<typename T1::pod_type >&    S,
+  const SpBase<typename T1::elem_type,T1>& X,
+  const uword                              k,
+  const eigs_opts&                         opts,
+  const typename arma_blas_real_or_cx_only<typename T1::elem_type>::result* junk = nullptr
+  )
+  {
+  arma_debug_sigprint();
+  arma_ignore(junk);
+  
+  typedef typename T1::pod_type T;
+  
+  Mat<typename T1::elem_type> U;
+  Mat<typename T1::elem_type> V;
+  
+  const bool status = svds_helper(U, S, V, X.get_ref(), k, T(opts.tol), false, opts);
+  
+  if(status == false)  { arma_warn(3, "svds(): decomposition failed"); }
+  
+  return status;
+  }
+
+
+
 //! @}
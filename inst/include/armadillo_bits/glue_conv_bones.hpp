@@ -49,5 +49,29 @@ struct glue_conv2
 
 
 
+//! FFT-based evaluation of conv() and conv2(), used when it is estimated to be faster than direct evaluation;
+//! only float, double, cx_float and cx_double elements are supported, for which do_fft is true
+template<bool do_fft>
+struct glue_conv_fft
+  {
+  template<typename eT> arma_inline static bool apply (Mat<eT>&, const Mat<eT>&, const Mat<eT>&, const bool)  { return false; }
+  template<typename eT> arma_inline static bool apply2(Mat<eT>&, const Mat<eT>&, const Mat<eT>&)              { return false; }
+  };
+
+
+
+template<>
+struct glue_conv_fft<true>
+  {
+  template<typename eT> inline static bool apply (Mat<eT>& out, const Mat<eT>& x, const Mat<eT>& h, const bool A_is_col);
+  template<typename eT> inline static bool apply2(Mat<eT>& out, const Mat<eT>& W, const Mat<eT>& G);
+  
+  template<typename cx_type, bool inverse> inline static void fft2_inplace(cx_type* Z, const uword n_rows, const uword n_cols);
+  
+  inline static double fft_cost(const uword N);
+  };
+
+
+
 //! @}
 
@@ -39,6 +39,8 @@ glue_conv::apply(Mat<eT>& out, const Mat<eT>& A, const Mat<eT>& B, const bool A_
   
   if( (h_n_elem == 0) || (x_n_elem == 0) )  { out.zeros(); return; }
   
+  if( glue_conv_fft< is_blas_type<eT>::value >::apply(out, x, h, A_is_col) )  { return; }
+  
   
   Col<eT> hh(h_n_elem, arma_nozeros_indicator());  // flipped version of h
   
@@ -270,6 +272,8 @@ glue_conv2::apply(Mat<eT>& out, const Mat<eT>& A, const Mat<eT>& B)
   
   if(G.is_empty() || W.is_empty())  { out.zeros(); return; }
   
+  if( glue_conv_fft< is_blas_type<eT>::value >::apply2(out, W, G) )  { return; }
+  
   
   Mat<eT> H(G.n_rows, G.n_cols, arma_nozeros_indicator());  // flipped filter coefficients
   
@@ -420,4 +424,346 @@ glue_conv2::apply(Mat<typename T1::elem_type>& out, const Glue<T1,T2,glue_conv2>
 
 
 
+///
+
+
+
+//! approximate cost of a complex transform of length N, in units of one multiply-add of direct convolution;
+//! the constant was found by timing conv() and conv2() against direct evaluation
+inline
+double
+glue_conv_fft<true>::fft_cost(const uword N)
+  {
+  double log2_N = 0.0;
+  
+  for(uword n = N; n > 1; n /= 2)  { log2_N += 1.0; }
+  
+  return double(3) * double(N) * (log2_N + double(1));
+  }
+
+
+
+//! full convolution via overlap-save: the output is split into segments of L-h+1 elements,
+//! each obtained from a circular convolution of length L, so that segments can be processed independently;
+//! for real data, two segments are processed with one complex transform, as the real and imaginary parts.
+//! returns false without modifying out if direct evaluation is estimated to be faster, or if x or h has non-finite values.
+template<typename eT>
+inline
+bool
+glue_conv_fft<true>::apply(Mat<eT>& out, const Mat<eT>& x, const Mat<eT>& h, const bool A_is_col)
+  {
+  arma_debug_sigprint();
+  
+  typedef typename get_pod_type<eT>::result T;
+  typedef std::complex<T>                   cx_type;
+  
+  const uword   h_n_elem = h.n_elem;
+  const uword   x_n_elem = x.n_elem;
+  const uword out_n_elem = h_n_elem + x_n_elem - 1;
+  
+  if( (arma_config::optimise_conv == false) || (h_n_elem < 32) )  { return false; }
+  
+  const uword segs_per_transform = (is_cx<eT>::value) ? uword(1) : uword(2);
+  
+  // choose the transform length with the lowest estimated cost;
+  // lengths are powers of 2, apart from a single transform covering the entire output
+  
+  const uword L_max = fft_engine_kissfft<cx_type,false>::smooth_length(out_n_elem);
+  
+  uword  L      = 0;
+  double L_cost = 0.0;
+  
+  for(uword len = 64; ; len *= 2)
+    {
+    const uword cur_len = (std::min)(len, L_max);
+    
+    if( (cur_len >= 2*h_n_elem) || (cur_len == L_max) )
+      {
+      const uword n_segs       = (out_n_elem + (cur_len - h_n_elem)) / (cur_len - h_n_elem + 1);
+      const uword n_transforms = (n_segs + segs_per_transform - 1) / segs_per_transform;
+      
+      // forward and inverse transforms, plus loading the segments and multiplying by the filter
+      const double cur_cost = double(3) * double(n_transforms) * fft_cost(cur_len);
+      
+      if( (L == 0) || (cur_cost < L_cost) )  { L = cur_len; L_cost = cur_cost; }
+      }
+    
+    if(cur_len == L_max)  { break; }
+    }
+  
+  // a complex multiply-add in direct evaluation is equivalent to four real ones
+  
+  const double direct_cost = double( (is_cx<eT>::value) ? 4 : 1 ) * double(x_n_elem) * double(h_n_elem);
+  
+  if( (L == 0) || (L_cost >= direct_cost) )  { return false; }
+  
+  // a transform spreads a non-finite value across all of its outputs
+  
+  if( x.internal_has_nonfinite() || h.internal_has_nonfinite() )  { return false; }
+  
+  arma_debug_print("glue_conv_fft::apply(): fft implementation");
+  
+  const std::shared_ptr< const fft_engine_kissfft<cx_type,false> > fwd_ptr = fft_engine_cache< fft_engine_kissfft<cx_type,false> >::get(L);
+  const std::shared_ptr< const fft_engine_kissfft<cx_type,true > > inv_ptr = fft_engine_cache< fft_engine_kissfft<cx_type,true > >::get(L);
+  
+  const fft_engine_kissfft<cx_type,false>& fwd = (*fwd_ptr);
+  const fft_engine_kissfft<cx_type,true >& inv = (*inv_ptr);
+  
+  // transform of the filter, including the scaling of the inverse transform
+  
+  podarray<cx_type> H(2*L, arma_zeros_indicator());
+  
+  cx_type* H_mem = H.memptr();
+  
+  const eT* h_mem = h.memptr();
+  const eT* x_mem = x.memptr();
+  
+  for(uword i=0; i < h_n_elem; ++i)  { H_mem[L+i] = cx_type(h_mem[i]); }
+  
+  fwd.run(H_mem, H_mem + L);
+  
+  arrayops::inplace_mul(H_mem, cx_type( T(1) / T(L) ), L);
+  
+  
+  Mat<eT> tmp;
+  
+  const bool is_alias = ( (&out == &x) || (&out == &h) );
+  
+  Mat<eT>& dest = (is_alias) ? tmp : out;
+  
+  (A_is_col) ? dest.set_size(out_n_elem, 1) : dest.set_size(1, out_n_elem);
+  
+  eT* dest_mem = dest.memptr();
+  
+  const uword offset = h_n_elem - 1;
+  const uword seg_len = L - offset;
+  
+  const uword n_segs       = (out_n_elem + seg_len - 1) / seg_len;
+  const uword n_transforms = (n_segs + segs_per_transform - 1) / segs_per_transform;
+  
+  const auto process = [&](const uword k, cx_type* Z)
+    {
+    cx_type* F = Z + L;
+    
+    arrayops::fill_zeros(Z, L);
+    
+    // Z[j] holds x[start + j - offset], with zeros outside of x
+    
+    for(uword part=0; part < segs_per_transform; ++part)
+      {
+      const uword seg = k*segs_per_transform + part;
+      
+      if(seg >= n_segs)  { break; }
+      
+      const uword start = seg * seg_len;
+      
+      const uword j_start = (start < offset) ? (offset - start) : uword(0);
+      const uword j_end   = (std::min)(L, x_n_elem + offset - start);
+      
+      const eT* x_seg = x_mem + (start + j_start - offset);
+      
+      cx_type* Z_seg = Z + j_start;
+      
+      const uword count = (j_end > j_start) ? (j_end - j_start) : uword(0);
+      
+      if(part == 0)  { for(uword j=0; j < count; ++j)  { Z_seg[j] = cx_type(x_seg[j]); } }
+      else           { for(uword j=0; j < count; ++j)  { Z_seg[j].imag( access::tmp_real(x_seg[j]) ); } }
+      }
+    
+    fwd.run(F, Z);
+    
+    for(uword j=0; j < L; ++j)  { F[j] *= H_mem[j]; }
+    
+    inv.run(Z, F);
+    
+    for(uword part=0; part < segs_per_transform; ++part)
+      {
+      const uword seg = k*segs_per_transform + part;
+      
+      if(seg >= n_segs)  { break; }
+      
+      const uword start = seg * seg_len;
+      const uword count = (std::min)(seg_len, out_n_elem - start);
+      
+      const cx_type* Z_seg = Z + offset;
+      
+      eT* dest_seg = dest_mem + start;
+      
+      if(part == 0)  { for(uword t=0; t < count; ++t)  { arrayops::convert_cx_scalar(dest_seg[t], Z_seg[t]); } }
+      else           { for(uword t=0; t < count; ++t)  { arrayops::convert_cx_scalar(dest_seg[t], cx_type(Z_seg[t].imag(), T(0))); } }
+      }
+    };
+  
+  op_fft_cx::run_vecs<cx_type>(n_transforms, 2*L, process);
+  
+  if(is_alias)  { out.steal_mem(tmp); }
+  
+  return true;
+  }
+
+
+
+//! full 2D convolution via a 2D transform of the zero-padded image and filter;
+//! for real data, the image and filter are transformed together as the real and imaginary parts.
+//! returns false without modifying out if direct evaluation is estimated to be faster, or if W or G has non-finite values.
+template<typename eT>
+inline
+bool
+glue_conv_fft<true>::apply2(Mat<eT>& out, const Mat<eT>& W, const Mat<eT>& G)
+  {
+  arma_debug_sigprint();
+  
+  typedef typename get_pod_type<eT>::result T;
+  typedef std::complex<T>                   cx_type;
+  
+  if( (arma_config::optimise_conv == false) || (G.n_elem < 64) )  { return false; }
+  
+  const uword out_n_rows = W.n_rows + G.n_rows - 1;
+  const uword out_n_cols = W.n_cols + G.n_cols - 1;
+  
+  const uword R = fft_engine_kissfft<cx_type,false>::smooth_length(out_n_rows);
+  const uword C = fft_engine_kissfft<cx_type,false>::smooth_length(out_n_cols);
+  
+  const double n_transforms = (is_cx<eT>::value) ? double(3) : double(2);
+  
+  const double cost = n_transforms * ( double(C) * fft_cost(R) + double(R) * fft_cost(C) );
+  
+  const double direct_cost = double( (is_cx<eT>::value) ? 4 : 1 ) * double(W.n_elem) * double(G.n_elem);
+  
+  if( cost >= direct_cost )  { return false; }
+  
+  if( W.internal_has_nonfinite() || G.internal_has_nonfinite() )  { return false; }
+  
+  arma_debug_print("glue_conv_fft::apply2(): fft implementation");
+  
+  const uword RC = R*C;
+  
+  const T scale = T(1) / T(RC);
+  
+  podarray<cx_type> Z(RC, arma_zeros_indicator());
+  
+  cx_type* Z_mem = Z.memptr();
+  
+  if(is_cx<eT>::value == false)
+    {
+    for(uword col=0; col < W.n_cols; ++col)
+      {
+      const eT* W_col = W.colptr(col);
+      
+      cx_type* Z_col = Z_mem + col*R;
+      
+      for(uword row=0; row < W.n_rows; ++row)  { Z_col[row] = cx_type(W_col[row]); }
+      }
+    
+    for(uword col=0; col < G.n_cols; ++col)
+      {
+      const eT* G_col = G.colptr(col);
+      
+      cx_type* Z_col = Z_mem + col*R;
+      
+      for(uword row=0; row < G.n_rows; ++row)  { Z_col[row].imag( access::tmp_real(G_col[row]) ); }
+      }
+    
+    glue_conv_fft<true>::fft2_inplace<cx_type,false>(Z_mem, R, C);
+    
+    // with Z = FFT(W + i*G), FFT(W)*FFT(G) at k is (Z[k]^2 - conj(Z[-k])^2) / (4i);
+    // elements k and -k are updated together
+    
+    const cx_type factor( T(0), -scale/T(4) );
+    
+    for(uword col=0; col < C; ++col)
+      {
+      const uword neg_col = (col == 0) ? uword(0) : (C - col);
+      
+      for(uword row=0; row < R; ++row)
+        {
+        const uword neg_row = (row == 0) ? uword(0) : (R - row);
+        
+        const uword a = row + col*R;
+        const uword b = neg_row + neg_col*R;
+        
+        if(a > b)  { continue; }
+        
+        const cx_type za = Z_mem[a];
+        const cx_type zb = Z_mem[b];
+        
+        const cx_type za_conj = std::conj(za);
+        const cx_type zb_conj = std::conj(zb);
+        
+        Z_mem[a] = factor * (za*za - zb_conj*zb_conj);
+        Z_mem[b] = factor * (zb*zb - za_conj*za_conj);
+        }
+      }
+    }
+  else
+    {
+    podarray<cx_type> Y(RC, arma_zeros_indicator());
+    
+    cx_type* Y_mem = Y.memptr();
+    
+    for(uword col=0; col < W.n_cols; ++col)  { for(uword row=0; row < W.n_rows; ++row)  { Z_mem[row + col*R] = cx_type(W.at(row,col)); } }
+    for(uword col=0; col < G.n_cols; ++col)  { for(uword row=0; row < G.n_rows; ++row)  { Y_mem[row + col*R] = cx_type(G.at(row,col)); } }
+    
+    glue_conv_fft<true>::fft2_inplace<cx_type,false>(Z_mem, R, C);
+    glue_conv_fft<true>::fft2_inplace<cx_type,false>(Y_mem, R, C);
+    
+    for(uword i=0; i < RC; ++i)  { Z_mem[i] *= (Y_mem[i] * scale); }
+    }
+  
+  glue_conv_fft<true>::fft2_inplace<cx_type,true>(Z_mem, R, C);
+  
+  out.set_size(out_n_rows, out_n_cols);
+  
+  for(uword col=0; col < out_n_cols; ++col)
+    {
+    eT* out_col = out.colptr(col);
+    
+    const cx_type* Z_col = Z_mem + col*R;
+    
+    for(uword row=0; row < out_n_rows; ++row)  { arrayops::convert_cx_scalar(out_col[row], Z_col[row]); }
+    }
+  
+  return true;
+  }
+
+
+
+//! unscaled 2D transform of a column-major array: transforms of all columns, followed by transforms of all rows
+template<typename cx_type, bool inverse>
+inline
+void
+glue_conv_fft<true>::fft2_inplace(cx_type* Z, const uword n_rows, const uword n_cols)
+  {
+  arma_debug_sigprint();
+  
+  const std::shared_ptr< const fft_engine_kissfft<cx_type,inverse> > col_engine = fft_engine_cache< fft_engine_kissfft<cx_type,inverse> >::get(n_rows);
+  const std::shared_ptr< const fft_engine_kissfft<cx_type,inverse> > row_engine = fft_engine_cache< fft_engine_kissfft<cx_type,inverse> >::get(n_cols);
+  
+  const auto process_col = [&](const uword col, cx_type* buffer)
+    {
+    cx_type* Z_col = Z + col*n_rows;
+    
+    arrayops::copy(buffer, Z_col, n_rows);
+    
+    col_engine->run(Z_col, buffer);
+    };
+  
+  op_fft_cx::run_vecs<cx_type>(n_cols, n_rows, process_col);
+  
+  const auto process_row = [&](const uword row, cx_type* buffer)
+    {
+    cx_type* buffer_out = buffer + n_cols;
+    
+    for(uword col=0; col < n_cols; ++col)  { buffer[col] = Z[row + col*n_rows]; }
+    
+    row_engine->run(buffer_out, buffer);
+    
+    for(uword col=0; col < n_cols; ++col)  { Z[row + col*n_rows] = buffer_out[col]; }
+    };
+  
+  op_fft_cx::run_vecs<cx_type>(n_rows, 2*n_cols, process_row);
+  }
+
+
+
 //! @}
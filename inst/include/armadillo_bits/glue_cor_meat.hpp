@@ -54,14 +54,7 @@ glue_cor::apply(Mat<typename T1::elem_type>& out, const Glue<T1,T2,glue_cor>& X)
     return;
     }
   
-  const uword N        = AA.n_rows;
-  const eT    norm_val = (norm_type == 0) ? ( (N > 1) ? eT(N-1) : eT(1) ) : eT(N);
-  
-  const Mat<eT> tmp1 = AA.each_row() - mean(AA,0);
-  const Mat<eT> tmp2 = BB.each_row() - mean(BB,0);
-  
-  out = tmp1.t() * tmp2;
-  out /= norm_val;
+  glue_cov::direct_cov(out, AA, BB, norm_type);
   
   out /= conv_to< Mat<eT> >::from( stddev(AA).t() * stddev(BB) );  // TODO: check for zeros?
   }
@@ -33,6 +33,8 @@ struct glue_cov
     };
   
   template<typename T1, typename T2> inline static void apply(Mat<typename T1::elem_type>& out, const Glue<T1,T2,glue_cov>& X);
+  
+  template<typename eT> inline static void direct_cov(Mat<eT>& out, const Mat<eT>& A, const Mat<eT>& B, const uword norm_type);
   };
 
 
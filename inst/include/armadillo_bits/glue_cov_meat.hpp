@@ -54,13 +54,57 @@ glue_cov::apply(Mat<typename T1::elem_type>& out, const Glue<T1,T2,glue_cov>& X)
     return;
     }
   
-  const uword N        = AA.n_rows;
-  const eT    norm_val = (norm_type == 0) ? ( (N > 1) ? eT(N-1) : eT(1) ) : eT(N);
+  glue_cov::direct_cov(out, AA, BB, norm_type);
+  }
+
+
+
+//! cross-covariance of the columns of A and B (rows are observations);
+//! the centred data is formed and accumulated one block of rows at a time
+template<typename eT>
+inline
+void
+glue_cov::direct_cov(Mat<eT>& out, const Mat<eT>& A, const Mat<eT>& B, const uword norm_type)
+  {
+  arma_debug_sigprint();
   
-  const Mat<eT> tmp1 = AA.each_row() - mean(AA,0);
-  const Mat<eT> tmp2 = BB.each_row() - mean(BB,0);
+  const uword N = A.n_rows;
+  
+  const eT norm_val = (norm_type == 0) ? ( (N > 1) ? eT(N-1) : eT(1) ) : eT(N);
+  
+  const Row<eT> mu_A = mean(A,0);
+  const Row<eT> mu_B = mean(B,0);
+  
+  const uword blk_n_rows = op_cov::block_n_obs( (std::max)(A.n_cols, B.n_cols) );
+  
+  if(N <= blk_n_rows)
+    {
+    const Mat<eT> tmp1 = A.each_row() - mu_A;
+    const Mat<eT> tmp2 = B.each_row() - mu_B;
+    
+    out = tmp1.t() * tmp2;
+    }
+  else
+    {
+    out.zeros(A.n_cols, B.n_cols);
+    
+    Mat<eT> blk_A;
+    Mat<eT> blk_B;
+    
+    for(uword row_start=0; row_start < N; row_start += blk_n_rows)
+      {
+      const uword row_end = (std::min)(row_start + blk_n_rows, N) - 1;
+      
+      blk_A = A.rows(row_start, row_end);
+      blk_B = B.rows(row_start, row_end);
+      
+      blk_A.each_row() -= mu_A;
+      blk_B.each_row() -= mu_B;
+      
+      out += blk_A.t() * blk_B;
+      }
+    }
   
-  out = tmp1.t() * tmp2;
   out /= norm_val;
   }
 
@@ -73,6 +73,9 @@ struct glue_times_sparse_dense
   template<typename T1, typename T2>
   inline static void apply_noalias_trans(Mat<typename T1::elem_type>& out, const T1& x, const T2& y);
   
+  template<typename eT>
+  inline static void apply_trans_blocked(Mat<eT>& out, const SpMat<eT>& A, const Mat<eT>& B);
+  
   template<typename T1, typename T2>
   inline static void apply_mixed(Mat< typename promote_type<typename T1::elem_type, typename T2::elem_type>::result >& out, const T1& X, const T2& Y);
   };
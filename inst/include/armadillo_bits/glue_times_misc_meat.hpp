@@ -394,46 +394,20 @@ glue_times_sparse_dense::apply_noalias(Mat<typename T1::elem_type>& out, const T
     {
     arma_debug_print("using column vector specialisation");
     
-    out.zeros(A_n_rows, 1);
+    out.set_size(A_n_rows, 1);
     
-          eT* out_mem = out.memptr();
-    const eT*   B_mem =   B.memptr();
+    const eT* B_mem = B.memptr();
     
-    typename SpMat<eT>::const_iterator A_it = A.begin();
-    
-    const uword nnz = A.n_nonzero;
-    
-    for(uword count = 0; count < nnz; ++count, ++A_it)
-      {
-      const eT    A_it_val = (*A_it);
-      const uword A_it_row = A_it.row();
-      const uword A_it_col = A_it.col();
-      
-      out_mem[A_it_row] += A_it_val * B_mem[A_it_col];
-      }
+    op_sp_sum::reduce_rows(out.memptr(), A_n_rows, A_n_cols, A.col_ptrs, A.row_indices, A.values, [B_mem](const eT A_val, const uword col) { return A_val * B_mem[col]; });
     }
   else
-  if(B_n_cols >= (B_n_rows / uword(100)))
+  if( (B_n_cols >= uword(8)) || ((arma_config::openmp) && (mp_thread_limit::in_parallel() == false) && mp_gate<eT>::eval(A.n_nonzero * B_n_cols)) )
     {
-    arma_debug_print("using transpose-based multiplication");
+    arma_debug_print("using blocked multiplication with transposed A");
     
     const SpMat<eT> At = A.st();
-    const   Mat<eT> Bt = B.st();
     
-    if(A_n_rows == B_n_cols)
-      {
-      glue_times_dense_sparse::apply_noalias(out, Bt, At);
-      
-      op_strans::apply_mat(out, out);  // since 'out' is square-sized, this will do an inplace transpose
-      }
-    else
-      {
-      Mat<eT> tmp;
-      
-      glue_times_dense_sparse::apply_noalias(tmp, Bt, At);
-      
-      op_strans::apply_mat(out, tmp);
-      }
+    glue_times_sparse_dense::apply_trans_blocked(out, At, B);
     }
   else
     {
@@ -525,48 +499,123 @@ glue_times_sparse_dense::apply_noalias_trans(Mat<typename T1::elem_type>& out, c
       }
     }
   else
-  if(B_n_cols >= (B_n_rows / uword(100)))
     {
-    arma_debug_print("using transpose-based multiplication (avoiding transpose of A)");
+    arma_debug_print("using blocked multiplication (avoiding transpose of A)");
+    
+    glue_times_sparse_dense::apply_trans_blocked(out, A, B);
+    }
+  }
+
+
+
+//! out = A.st() * B, without forming A.st();
+//! each column of A yields one row of out, so blocks of rows of out can be computed independently (and in parallel);
+//! four columns of B are processed together, keeping the partial sums in registers
+template<typename eT>
+inline
+void
+glue_times_sparse_dense::apply_trans_blocked(Mat<eT>& out, const SpMat<eT>& A, const Mat<eT>& B)
+  {
+  arma_debug_sigprint();
+  
+  A.sync();
+  
+  const uword out_n_rows = A.n_cols;
+  const uword out_n_cols = B.n_cols;
+  const uword B_n_rows   = B.n_rows;
+  
+  out.set_size(out_n_rows, out_n_cols);
+  
+  if(out.n_elem == 0)  { return; }
+  
+  if(A.n_nonzero == 0)  { out.zeros(); return; }
+  
+  const uword* A_col_ptrs    = A.col_ptrs;
+  const uword* A_row_indices = A.row_indices;
+  const eT*    A_values      = A.values;
+  
+  const eT*   B_mem = B.memptr();
+        eT* out_mem = out.memptr();
+  
+  const uword block_size = 256;
+  const uword n_blocks   = (out_n_rows + block_size - 1) / block_size;
+  
+  const auto worker = [&](const uword block)
+    {
+    const uword row_start = block * block_size;
+    const uword row_end   = (std::min)(row_start + block_size, out_n_rows);
     
-    const Mat<eT> Bt = B.st();
+    uword col = 0;
     
-    if(A_n_cols == B_n_cols)
-      {
-      glue_times_dense_sparse::apply_noalias(out, Bt, A);
-      
-      op_strans::apply_mat(out, out);  // since 'out' is square-sized, this will do an inplace transpose
-      }
-    else
+    for(; (col+3) < out_n_cols; col += 4)
       {
-      Mat<eT> tmp;
+      const eT* B0 = &(B_mem[(col  ) * B_n_rows]);
+      const eT* B1 = &(B_mem[(col+1) * B_n_rows]);
+      const eT* B2 = &(B_mem[(col+2) * B_n_rows]);
+      const eT* B3 = &(B_mem[(col+3) * B_n_rows]);
       
-      glue_times_dense_sparse::apply_noalias(tmp, Bt, A);
+      eT* out0 = &(out_mem[(col  ) * out_n_rows]);
+      eT* out1 = &(out_mem[(col+1) * out_n_rows]);
+      eT* out2 = &(out_mem[(col+2) * out_n_rows]);
+      eT* out3 = &(out_mem[(col+3) * out_n_rows]);
       
-      op_strans::apply_mat(out, tmp);
+      for(uword row = row_start; row < row_end; ++row)
+        {
+        eT acc0 = eT(0);
+        eT acc1 = eT(0);
+        eT acc2 = eT(0);
+        eT acc3 = eT(0);
+        
+        for(uword k = A_col_ptrs[row]; k < A_col_ptrs[row+1]; ++k)
+          {
+          const uword i   = A_row_indices[k];
+          const eT    val = A_values[k];
+          
+          acc0 += val * B0[i];
+          acc1 += val * B1[i];
+          acc2 += val * B2[i];
+          acc3 += val * B3[i];
+          }
+        
+        out0[row] = acc0;
+        out1[row] = acc1;
+        out2[row] = acc2;
+        out3[row] = acc3;
+        }
       }
-    }
-  else
-    {
-    arma_debug_print("using standard multiplication (avoiding transpose of A)");
-    
-    out.zeros(A_n_cols, B_n_cols);
     
-    typename SpMat<eT>::const_iterator A_it = A.begin();
-    
-    const uword nnz = A.n_nonzero;
-    
-    for(uword count = 0; count < nnz; ++count, ++A_it)
+    for(; col < out_n_cols; ++col)
       {
-      const eT    A_it_val = (*A_it);
-      const uword A_it_row = A_it.row();
-      const uword A_it_col = A_it.col();
+      const eT*   B_col = &(  B_mem[col * B_n_rows  ]);
+            eT* out_col = &(out_mem[col * out_n_rows]);
       
-      for(uword col = 0; col < B_n_cols; ++col)
+      for(uword row = row_start; row < row_end; ++row)
         {
-        out.at(A_it_col, col) += A_it_val * B.at(A_it_row, col);
+        eT acc = eT(0);
+        
+        for(uword k = A_col_ptrs[row]; k < A_col_ptrs[row+1]; ++k)  { acc += A_values[k] * B_col[A_row_indices[k]]; }
+        
+        out_col[row] = acc;
         }
       }
+    };
+  
+  if( (arma_config::openmp) && (mp_thread_limit::in_parallel() == false) && (n_blocks >= 2) && mp_gate<eT>::eval(A.n_nonzero * out_n_cols) )
+    {
+    #if defined(ARMA_USE_OPENMP)
+      {
+      arma_debug_print("openmp implementation");
+      
+      const int n_threads = mp_thread_limit::get();
+      
+      #pragma omp parallel for schedule(dynamic) num_threads(n_threads)
+      for(uword block=0; block < n_blocks; ++block)  { worker(block); }
+      }
+    #endif
+    }
+  else
+    {
+    for(uword block=0; block < n_blocks; ++block)  { worker(block); }
     }
   }
 
@@ -97,6 +97,22 @@ class gmm_full
     const bool            print_mode
     );
   
+  template<typename functor>
+  inline
+  bool
+  learn_online
+    (
+          functor         source,
+    const uword           n_gaus,
+    const gmm_dist_mode&  dist_mode,
+    const gmm_seed_mode&  seed_mode,
+    const uword           km_chunks,
+    const uword           em_chunks,
+    const eT              var_floor,
+    const bool            print_mode,
+    const eT              step_decay = eT(0.6)
+    );
+  
   
   //
   
@@ -155,6 +171,8 @@ class gmm_full
   inline void em_generate_acc(const Mat<eT>& X, const uword start_index, const uword end_index, Mat<eT>& acc_means, Cube<eT>& acc_fcovs, Col<eT>& acc_norm_lhoods, Col<eT>& gaus_log_lhoods, eT& progress_log_lhood) const;
   
   inline void em_fix_params(const eT var_floor);
+  
+  inline eT em_online_step(const Mat<eT>& X, const eT step, Row<eT>& stat_hefts, Mat<eT>& stat_means, Cube<eT>& stat_fcovs, const eT var_floor);
   };
 
 }
@@ -829,6 +829,260 @@ gmm_full<eT>::learn
 
 
 
+//! learn from a stream of chunks, each of which is obtained by calling source(X);
+//! the source fills X with the next chunk of samples (one per column) and returns false once the stream is exhausted;
+//! km_chunks and em_chunks give the number of chunks used by mini-batch k-means and stepwise EM, in that order;
+//! the first chunk is also used for the initial means and the Mahalanobis weights, and the last k-means chunk for the initial covariances;
+//! during EM the parameters are updated after each chunk, so the model can be checkpointed via save() from within the source
+template<typename eT>
+template<typename functor>
+inline
+bool
+gmm_full<eT>::learn_online
+  (
+        functor        source,
+  const uword          N_gaus,
+  const gmm_dist_mode& dist_mode,
+  const gmm_seed_mode& seed_mode,
+  const uword          km_chunks,
+  const uword          em_chunks,
+  const eT             var_floor,
+  const bool           print_mode,
+  const eT             step_decay
+  )
+  {
+  arma_debug_sigprint();
+  
+  const bool dist_mode_ok = (dist_mode == eucl_dist) || (dist_mode == maha_dist);
+  
+  const bool seed_mode_ok = \
+       (seed_mode == keep_existing)
+    || (seed_mode == static_subset)
+    || (seed_mode == static_spread)
+    || (seed_mode == random_subset)
+    || (seed_mode == random_spread);
+  
+  arma_conform_check( (dist_mode_ok         == false), "gmm_full::learn_online(): dist_mode must be eucl_dist or maha_dist" );
+  arma_conform_check( (seed_mode_ok         == false), "gmm_full::learn_online(): unknown seed_mode"                        );
+  arma_conform_check( ((var_floor >= eT(0)) == false), "gmm_full::learn_online(): variance floor must be > 0"               );
+  
+  arma_conform_check( ((step_decay > eT(0.5)) && (step_decay <= eT(1))) == false, "gmm_full::learn_online(): step_decay must be in the (0.5,1] interval" );
+  
+  Mat<eT> X;
+  
+  bool bad_chunk = false;
+  
+  if(source(X) == false)  { arma_warn(3, "gmm_full::learn_online(): source provided no data"); return false; }
+  
+  if(X.is_empty()              )  { arma_warn(3, "gmm_full::learn_online(): given chunk is empty"             ); return false; }
+  if(X.internal_has_nonfinite())  { arma_warn(3, "gmm_full::learn_online(): given chunk has non-finite values"); return false; }
+  
+  if(N_gaus == 0)  { reset(); return true; }
+  
+  if(dist_mode == maha_dist)
+    {
+    mah_aux = var(X,1,1);
+    
+    const uword mah_aux_n_elem = mah_aux.n_elem;
+          eT*   mah_aux_mem    = mah_aux.memptr();
+    
+    for(uword i=0; i < mah_aux_n_elem; ++i)
+      {
+      const eT val = mah_aux_mem[i];
+      
+      mah_aux_mem[i] = ((val != eT(0)) && arma_isfinite(val)) ? eT(1) / val : eT(1);
+      }
+    }
+  
+  
+  // copy current model, in case of failure by k-means and/or EM
+  
+  const gmm_full<eT> orig = (*this);
+  
+  
+  // initial means
+  
+  if(seed_mode == keep_existing)
+    {
+    if(means.is_empty()        )  { arma_warn(3, "gmm_full::learn_online(): no existing means"      ); return false; }
+    if(X.n_rows != means.n_rows)  { arma_warn(3, "gmm_full::learn_online(): dimensionality mismatch"); return false; }
+    }
+  else
+    {
+    if(X.n_cols < N_gaus)  { arma_warn(3, "gmm_full::learn_online(): number of vectors in first chunk is less than number of gaussians"); return false; }
+    
+    reset(X.n_rows, N_gaus);
+    
+    if(print_mode)  { get_cout_stream() << "gmm_full::learn_online(): generating initial means\n"; get_cout_stream().flush(); }
+    
+         if(dist_mode == eucl_dist)  { generate_initial_means<1>(X, seed_mode); }
+    else if(dist_mode == maha_dist)  { generate_initial_means<2>(X, seed_mode); }
+    }
+  
+  const uword N_dims = means.n_rows;
+  
+  // the first chunk is not yet used by k-means or EM
+  bool have_chunk = true;
+  
+  
+  // mini-batch k-means
+  
+  if(km_chunks > 0)
+    {
+    const arma_ostream_state stream_state(get_cout_stream());
+    
+    if(print_mode)
+      {
+      get_cout_stream().unsetf(ios::showbase);
+      get_cout_stream().unsetf(ios::uppercase);
+      get_cout_stream().unsetf(ios::showpos);
+      get_cout_stream().unsetf(ios::scientific);
+      
+      get_cout_stream().setf(ios::right);
+      }
+    
+    Row<uword> counts(N_gaus, arma_zeros_indicator());
+    
+    for(uword chunk=1; chunk <= km_chunks; ++chunk)
+      {
+      if(have_chunk == false)
+        {
+        if(gmm_online::next_chunk(source, X, N_dims, bad_chunk) == false)  { break; }
+        }
+      
+      have_chunk = false;
+      
+      if(X.n_cols == 0)  { continue; }
+      
+      const umat boundaries = internal_gen_boundaries(X.n_cols);
+      
+      const eT delta = (dist_mode == eucl_dist)
+                       ? gmm_online::km_update<eT,1>(access::rw(means), counts, X, boundaries, mah_aux.memptr())
+                       : gmm_online::km_update<eT,2>(access::rw(means), counts, X, boundaries, mah_aux.memptr());
+      
+      if(print_mode)
+        {
+        get_cout_stream() << "gmm_full::learn_online(): k-means: chunk: ";
+        get_cout_stream().setf(ios::fixed);
+        get_cout_stream().width(std::streamsize(4));
+        get_cout_stream() << chunk;
+        get_cout_stream() << "   delta: ";
+        get_cout_stream().unsetf(ios::fixed);
+        get_cout_stream() << delta << '\n';
+        get_cout_stream().flush();
+        }
+      }
+    
+    stream_state.restore(get_cout_stream());
+    
+    if(bad_chunk)  { arma_warn(3, "gmm_full::learn_online(): given chunk has non-finite values or mismatched dimensionality"); init(orig); return false; }
+    
+    if(means.internal_has_nonfinite())  { arma_warn(3, "gmm_full::learn_online(): k-means algorithm failed"); init(orig); return false; }
+    }
+  
+  
+  // initial fcovs
+  
+  const eT var_floor_actual = (eT(var_floor) > eT(0)) ? eT(var_floor) : std::numeric_limits<eT>::min();
+  
+  if(seed_mode != keep_existing)
+    {
+    if(print_mode)  { get_cout_stream() << "gmm_full::learn_online(): generating initial covariances\n"; get_cout_stream().flush(); }
+    
+         if(dist_mode == eucl_dist)  { generate_initial_params<1>(X, var_floor_actual); }
+    else if(dist_mode == maha_dist)  { generate_initial_params<2>(X, var_floor_actual); }
+    }
+  
+  
+  // stepwise EM (Cappe & Moulines, 2009): the sufficient statistics are a running average over the chunks,
+  // with the weight of each new chunk decaying as (k+2)^(-step_decay) for the k-th chunk (counting from zero)
+  
+  if(em_chunks > 0)
+    {
+    const arma_ostream_state stream_state(get_cout_stream());
+    
+    if(print_mode)
+      {
+      get_cout_stream().unsetf(ios::showbase);
+      get_cout_stream().unsetf(ios::uppercase);
+      get_cout_stream().unsetf(ios::showpos);
+      get_cout_stream().unsetf(ios::scientific);
+      
+      get_cout_stream().setf(ios::right);
+      }
+    
+    // sufficient statistics of the current model, per sample
+    
+    Row<eT>  stat_hefts = hefts;
+    Mat<eT>  stat_means = means;
+    Cube<eT> stat_fcovs = fcovs;
+    
+    stat_means.each_row() %= hefts;
+    
+    for(uword g=0; g < N_gaus; ++g)
+      {
+      Mat<eT>& stat_fcov = stat_fcovs.slice(g);
+      
+      stat_fcov += means.col(g) * means.col(g).t();
+      stat_fcov *= hefts[g];
+      }
+    
+    bool status = true;
+    
+    for(uword chunk=1; chunk <= em_chunks; ++chunk)
+      {
+      if(have_chunk == false)
+        {
+        if(gmm_online::next_chunk(source, X, N_dims, bad_chunk) == false)  { status = (bad_chunk == false); break; }
+        }
+      
+      have_chunk = false;
+      
+      if(X.n_cols == 0)  { continue; }
+      
+      const eT step = std::pow( eT(chunk+1), -step_decay );
+      
+      const eT avg_log_p = em_online_step(X, step, stat_hefts, stat_means, stat_fcovs, var_floor_actual);
+      
+      if(print_mode)
+        {
+        get_cout_stream() << "gmm_full::learn_online(): EM: chunk: ";
+        get_cout_stream().setf(ios::fixed);
+        get_cout_stream().width(std::streamsize(4));
+        get_cout_stream() << chunk;
+        get_cout_stream() << "   avg_log_p: ";
+        get_cout_stream().unsetf(ios::fixed);
+        get_cout_stream() << avg_log_p << '\n';
+        get_cout_stream().flush();
+        }
+      
+      if(arma_isnonfinite(avg_log_p))  { status = false; break; }
+      }
+    
+    stream_state.restore(get_cout_stream());
+    
+    for(uword g=0; g < N_gaus; ++g)
+      {
+      if(any(vectorise(fcovs.slice(g).diag()) <= eT(0)))  { status = false; }
+      }
+    
+    if(fcovs.internal_has_nonfinite())  { status = false; }
+    
+    if(hefts.internal_has_nonfinite())  { status = false; }
+    if(means.internal_has_nonfinite())  { status = false; }
+    
+    if(status == false)  { arma_warn(3, "gmm_full::learn_online(): EM algorithm failed, or given chunk has non-finite values or mismatched dimensionality"); init(orig); return false; }
+    }
+  
+  mah_aux.reset();
+  
+  init_constants();
+  
+  return true;
+  }
+
+
+
 //
 //
 //
@@ -2112,6 +2366,13 @@ gmm_full<eT>::km_iterate(const Mat<eT>& X, const uword max_iter, const bool verb
   
   running_mean_scalar<eT> rs_delta;
   
+  // pruned assignment pays off once there are enough means to skip
+  const bool use_bounds = (arma_config::optimise_kmeans) && (N_gaus >= km_bounds<eT,dist_id>::min_gaus);
+  
+  km_bounds<eT,dist_id> bounds( (use_bounds ? X_n_cols : uword(0)), mah_aux_mem );
+  
+  uword n_dist = 0;
+  
   #if defined(ARMA_USE_OPENMP)
     const umat boundaries = internal_gen_boundaries(X_n_cols);
     const uword n_threads = boundaries.n_cols;
@@ -2119,6 +2380,8 @@ gmm_full<eT>::km_iterate(const Mat<eT>& X, const uword max_iter, const bool verb
     field< Mat<eT>    > t_acc_means(n_threads);
     field< Row<uword> > t_acc_hefts(n_threads);
     field< Row<uword> > t_last_indx(n_threads);
+    
+    podarray<uword> t_n_dist(n_threads);
   #else
     const uword n_threads = 1;
   #endif
@@ -2127,6 +2390,8 @@ gmm_full<eT>::km_iterate(const Mat<eT>& X, const uword max_iter, const bool verb
   
   for(uword iter=1; iter <= max_iter; ++iter)
     {
+    if(use_bounds)  { bounds.update_means(old_means); }
+    
     #if defined(ARMA_USE_OPENMP)
       {
       for(uword t=0; t < n_threads; ++t)
@@ -2146,18 +2411,28 @@ gmm_full<eT>::km_iterate(const Mat<eT>& X, const uword max_iter, const bool verb
         const uword start_index = boundaries.at(0,t);
         const uword   end_index = boundaries.at(1,t);
         
+        t_n_dist[t] = (use_bounds) ? bounds.assign(X, start_index, end_index) : uword(0);
+        
         for(uword i=start_index; i <= end_index; ++i)
           {
           const eT* X_colptr = X.colptr(i);
           
-          eT     min_dist = Datum<eT>::inf;
-          uword  best_g   = 0;
+          uword best_g = 0;
           
-          for(uword g=0; g<N_gaus; ++g)
+          if(use_bounds)
             {
-            const eT dist = distance<eT,dist_id>::eval(N_dims, X_colptr, old_means.colptr(g), mah_aux_mem);
+            best_g = bounds.label(i);
+            }
+          else
+            {
+            eT min_dist = Datum<eT>::inf;
             
-            if(dist < min_dist)  { min_dist = dist;  best_g = g; }
+            for(uword g=0; g<N_gaus; ++g)
+              {
+              const eT dist = distance<eT,dist_id>::eval(N_dims, X_colptr, old_means.colptr(g), mah_aux_mem);
+              
+              if(dist < min_dist)  { min_dist = dist;  best_g = g; }
+              }
             }
           
           eT* t_acc_mean = t_acc_means_t.colptr(best_g);
@@ -2174,10 +2449,14 @@ gmm_full<eT>::km_iterate(const Mat<eT>& X, const uword max_iter, const bool verb
       acc_means = t_acc_means(0);
       acc_hefts = t_acc_hefts(0);
       
+      n_dist = t_n_dist[0];
+      
       for(uword t=1; t < n_threads; ++t)
         {
         acc_means += t_acc_means(t);
         acc_hefts += t_acc_hefts(t);
+        
+        n_dist += t_n_dist[t];
         }
       
       for(uword g=0; g < N_gaus;    ++g)
@@ -2195,18 +2474,28 @@ gmm_full<eT>::km_iterate(const Mat<eT>& X, const uword max_iter, const bool verb
       uword* acc_hefts_mem = acc_hefts.memptr();
       uword* last_indx_mem = last_indx.memptr();
       
+      n_dist = (use_bounds) ? bounds.assign(X, 0, X_n_cols-1) : uword(0);
+      
       for(uword i=0; i < X_n_cols; ++i)
         {
         const eT* X_colptr = X.colptr(i);
         
-        eT     min_dist = Datum<eT>::inf;
-        uword  best_g   = 0;
+        uword best_g = 0;
         
-        for(uword g=0; g<N_gaus; ++g)
+        if(use_bounds)
+          {
+          best_g = bounds.label(i);
+          }
+        else
           {
-          const eT dist = distance<eT,dist_id>::eval(N_dims, X_colptr, old_means.colptr(g), mah_aux_mem);
+          eT min_dist = Datum<eT>::inf;
           
-          if(dist < min_dist)  { min_dist = dist;  best_g = g; }
+          for(uword g=0; g<N_gaus; ++g)
+            {
+            const eT dist = distance<eT,dist_id>::eval(N_dims, X_colptr, old_means.colptr(g), mah_aux_mem);
+            
+            if(dist < min_dist)  { min_dist = dist;  best_g = g; }
+            }
           }
         
         eT* acc_mean = acc_means.colptr(best_g);
@@ -2297,7 +2586,17 @@ gmm_full<eT>::km_iterate(const Mat<eT>& X, const uword max_iter, const bool verb
       get_cout_stream() << "   delta: ";
       get_cout_stream().unsetf(ios::fixed);
       //get_cout_stream().setf(ios::scientific);
-      get_cout_stream() << rs_delta.mean() << '\n';
+      get_cout_stream() << rs_delta.mean();
+      
+      if(use_bounds)
+        {
+        // percentage of the sample-to-mean distances skipped via the bounds
+        const double pruned = 100.0 * (1.0 - double(n_dist) / (double(X_n_cols) * double(N_gaus)));
+        
+        get_cout_stream() << "   pruned: " << pruned << '%';
+        }
+      
+      get_cout_stream() << '\n';
       get_cout_stream().flush();
       }
     
@@ -2667,6 +2966,134 @@ gmm_full<eT>::em_generate_acc
 
 
 
+//! one step of stepwise EM: blend the sufficient statistics of the given chunk into the running statistics,
+//! and obtain the parameters from the running statistics; returns the average log-likelihood of the chunk
+template<typename eT>
+inline
+eT
+gmm_full<eT>::em_online_step(const Mat<eT>& X, const eT step, Row<eT>& stat_hefts, Mat<eT>& stat_means, Cube<eT>& stat_fcovs, const eT var_floor)
+  {
+  arma_debug_sigprint();
+  
+  const uword N_dims = means.n_rows;
+  const uword N_gaus = means.n_cols;
+  
+  init_constants(false);
+  
+  const umat boundaries = internal_gen_boundaries(X.n_cols);
+  
+  const uword n_threads = boundaries.n_cols;
+  
+  field<  Mat<eT> > t_acc_means(n_threads);
+  field< Cube<eT> > t_acc_fcovs(n_threads);
+  
+  field< Col<eT> > t_acc_norm_lhoods(n_threads);
+  field< Col<eT> > t_gaus_log_lhoods(n_threads);
+  
+  Col<eT>          t_progress_log_lhood(n_threads, arma_nozeros_indicator());
+  
+  for(uword t=0; t<n_threads; t++)
+    {
+    t_acc_means[t].set_size(N_dims, N_gaus);
+    t_acc_fcovs[t].set_size(N_dims, N_dims, N_gaus);
+    
+    t_acc_norm_lhoods[t].set_size(N_gaus);
+    t_gaus_log_lhoods[t].set_size(N_gaus);
+    }
+  
+  #if defined(ARMA_USE_OPENMP)
+    {
+    #pragma omp parallel for schedule(static)
+    for(uword t=0; t<n_threads; t++)
+      {
+      em_generate_acc(X, boundaries.at(0,t), boundaries.at(1,t), t_acc_means[t], t_acc_fcovs[t], t_acc_norm_lhoods[t], t_gaus_log_lhoods[t], t_progress_log_lhood[t]);
+      }
+    }
+  #else
+    {
+    em_generate_acc(X, boundaries.at(0,0), boundaries.at(1,0), t_acc_means[0], t_acc_fcovs[0], t_acc_norm_lhoods[0], t_gaus_log_lhoods[0], t_progress_log_lhood[0]);
+    }
+  #endif
+  
+  for(uword t=1; t<n_threads; t++)
+    {
+    t_acc_means[0] += t_acc_means[t];
+    t_acc_fcovs[0] += t_acc_fcovs[t];
+    
+    t_acc_norm_lhoods[0] += t_acc_norm_lhoods[t];
+    }
+  
+  const eT keep  = eT(1) - step;
+  const eT scale = step / eT(X.n_cols);
+  
+  stat_hefts *= keep;  stat_hefts += scale * t_acc_norm_lhoods[0].t();
+  stat_means *= keep;  stat_means += scale * t_acc_means[0];
+  stat_fcovs *= keep;  stat_fcovs += scale * t_acc_fcovs[0];
+  
+  eT* hefts_mem = access::rw(hefts).memptr();
+  
+  Mat<eT> mean_outer(N_dims, N_dims, arma_nozeros_indicator());
+  
+  // conditionally update each component, as in em_update_params()
+  for(uword g=0; g < N_gaus; ++g)
+    {
+    const eT stat_heft = (std::max)( stat_hefts[g], std::numeric_limits<eT>::min() );
+    
+    if(arma_isnonfinite(stat_heft))  { continue; }
+    
+    eT* acc_mean_mem = t_acc_means[0].colptr(g);
+    
+    const eT* stat_mean_mem = stat_means.colptr(g);
+    
+    for(uword d=0; d < N_dims; ++d)
+      {
+      acc_mean_mem[d] = stat_mean_mem[d] / stat_heft;
+      }
+    
+    const Col<eT> new_mean(acc_mean_mem, N_dims, false, true);
+    
+    mean_outer = new_mean * new_mean.t();
+    
+    Mat<eT>& acc_fcov = t_acc_fcovs[0].slice(g);
+    
+    acc_fcov  = stat_fcovs.slice(g) / stat_heft;
+    acc_fcov -= mean_outer;
+    
+    for(uword d=0; d < N_dims; ++d)
+      {
+      eT& val = acc_fcov.at(d,d);
+      
+      if(val < var_floor)  { val = var_floor; }
+      }
+    
+    if(acc_fcov.internal_has_nonfinite())  { continue; }
+    
+    eT log_det_val  = eT(0);
+    eT log_det_sign = eT(0);
+    
+    const bool log_det_status = log_det(log_det_val, log_det_sign, acc_fcov);
+    
+    const bool log_det_ok = ( log_det_status && (arma_isfinite(log_det_val)) && (log_det_sign > eT(0)) );
+    
+    const bool inv_ok = (log_det_ok) ? bool(auxlib::inv_sympd(mean_outer, acc_fcov)) : bool(false);  // mean_outer is used as a junk matrix
+    
+    if(log_det_ok && inv_ok)
+      {
+      hefts_mem[g] = stat_heft;
+      
+      arrayops::copy(access::rw(means).colptr(g), acc_mean_mem, N_dims);
+      
+      access::rw(fcovs).slice(g) = acc_fcov;
+      }
+    }
+  
+  em_fix_params(var_floor);
+  
+  return accu(t_progress_log_lhood) / eT(t_progress_log_lhood.n_elem);
+  }
+
+
+
 template<typename eT>
 inline
 void
@@ -113,6 +113,71 @@ struct distance<eT, uword(2)>
   };
 
 
+
+// km_bounds
+
+//! nearest-mean assignment for k-means with pruning via the triangle inequality (Hamerly's algorithm);
+//! each sample keeps an upper bound on the distance to its assigned mean and a lower bound on the distance to all other means;
+//! samples not resolved by the bounds are assigned in blocks, using matrix multiplication to evaluate the distances to all means
+
+template<typename eT, uword dist_id>
+class km_bounds
+  {
+  public:
+  
+  inline km_bounds(const uword in_n_samples, const eT* in_mah_aux_mem);
+  
+  inline void update_means(const Mat<eT>& means);
+  
+  inline uword assign(const Mat<eT>& X, const uword start_index, const uword end_index);
+  
+  arma_inline uword label(const uword i) const;
+  
+  static constexpr uword min_gaus = 8;   //!< minimum number of means for which pruning is worthwhile
+  
+  
+  private:
+  
+  inline void assign_block(const Mat<eT>& X, const uword* indices, const uword n_indices, Mat<eT>& X_block, Mat<eT>& dots);
+  
+  inline eT w_norm(const eT* x, const uword N_dims) const;
+  
+  static constexpr uword block_size = 256;
+  
+  const eT*  mah_aux_mem;
+  
+  bool       have_bounds;
+  
+  Row<uword> labels;
+  Col<eT>    upper;      //!< upper bound on the distance from each sample to its assigned mean
+  Col<eT>    lower;      //!< lower bound on the distance from each sample to all other means
+  
+  Mat<eT>    means;      //!< current means
+  Mat<eT>    w_means;    //!< current means, scaled by the Mahalanobis weights
+  Col<eT>    w_norms;    //!< weighted squared norms of the current means
+  Col<eT>    half_sep;   //!< half the distance from each mean to its nearest other mean
+  Col<eT>    drift;      //!< distance moved by each mean in the last update
+  
+  eT         max_drift_1;
+  eT         max_drift_2;
+  uword      max_drift_g;
+  };
+
+
+
+// gmm_online
+
+//! helpers for learning from a stream of chunks, via mini-batch k-means and stepwise EM
+struct gmm_online
+  {
+  template<typename eT, typename functor>
+  inline static bool next_chunk(functor& source, Mat<eT>& X, const uword N_dims, bool& bad_chunk);
+  
+  template<typename eT, uword dist_id>
+  inline static eT km_update(Mat<eT>& means, Row<uword>& counts, const Mat<eT>& X, const umat& boundaries, const eT* mah_aux_mem);
+  };
+
+
 }
 
 
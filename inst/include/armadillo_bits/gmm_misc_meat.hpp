@@ -187,6 +187,389 @@ distance<eT, uword(2)>::eval(const uword N, const eT* A, const eT* B, const eT*
   return (acc1 + acc2);
   }
 
+
+template<typename eT, uword dist_id>
+inline
+km_bounds<eT,dist_id>::km_bounds(const uword in_n_samples, const eT* in_mah_aux_mem)
+  : mah_aux_mem(in_mah_aux_mem)
+  , have_bounds(false)
+  , labels     (in_n_samples, arma_zeros_indicator())
+  , upper      (in_n_samples, arma_nozeros_indicator())
+  , lower      (in_n_samples, arma_nozeros_indicator())
+  , max_drift_1(eT(0))
+  , max_drift_2(eT(0))
+  , max_drift_g(0)
+  {
+  arma_debug_sigprint_this(this);
+  }
+
+
+
+template<typename eT, uword dist_id>
+inline
+eT
+km_bounds<eT,dist_id>::w_norm(const eT* x, const uword N_dims) const
+  {
+  eT acc = eT(0);
+  
+  if(dist_id == uword(2))
+    {
+    for(uword d=0; d < N_dims; ++d)  { acc += (x[d]*x[d]) * mah_aux_mem[d]; }
+    }
+  else
+    {
+    for(uword d=0; d < N_dims; ++d)  { acc += x[d]*x[d]; }
+    }
+  
+  return acc;
+  }
+
+
+
+//! take the means for the next assignment pass;
+//! the bounds of each sample are loosened by the distance its means have moved,
+//! and half the separation between the means is obtained from their Gram matrix
+template<typename eT, uword dist_id>
+inline
+void
+km_bounds<eT,dist_id>::update_means(const Mat<eT>& in_means)
+  {
+  arma_debug_sigprint();
+  
+  const uword N_dims = in_means.n_rows;
+  const uword N_gaus = in_means.n_cols;
+  
+  have_bounds = (means.n_cols == N_gaus) && (means.n_rows == N_dims);
+  
+  max_drift_1 = eT(0);
+  max_drift_2 = eT(0);
+  max_drift_g = 0;
+  
+  if(have_bounds)
+    {
+    drift.set_size(N_gaus);
+    
+    for(uword g=0; g < N_gaus; ++g)
+      {
+      const eT val = std::sqrt( distance<eT,dist_id>::eval(N_dims, means.colptr(g), in_means.colptr(g), mah_aux_mem) );
+      
+      drift[g] = val;
+      
+      if(val > max_drift_1)  { max_drift_2 = max_drift_1;  max_drift_1 = val;  max_drift_g = g; }
+      else
+      if(val > max_drift_2)  { max_drift_2 = val; }
+      }
+    }
+  
+  means   = in_means;
+  w_means = in_means;
+  
+  if(dist_id == uword(2))  { w_means.each_col() %= Col<eT>(const_cast<eT*>(mah_aux_mem), N_dims, false, true); }
+  
+  w_norms.set_size(N_gaus);
+  
+  for(uword g=0; g < N_gaus; ++g)  { w_norms[g] = w_norm(means.colptr(g), N_dims); }
+  
+  // the Gram matrix gives the squared distances up to rounding errors,
+  // so each estimate is reduced by a bound on the error to keep half_sep a lower bound
+  
+  half_sep.set_size(N_gaus);
+  half_sep.fill(Datum<eT>::inf);
+  
+  if(N_gaus > 1)
+    {
+    const Mat<eT> gram = means.t() * w_means;
+    
+    const eT tol_factor = eT(N_dims + 2) * Datum<eT>::eps;
+    
+    for(uword g=0; g < N_gaus; ++g)
+      {
+      eT min_val = Datum<eT>::inf;
+      
+      for(uword h=0; h < N_gaus; ++h)
+        {
+        if(h == g)  { continue; }
+        
+        const eT norms = w_norms[g] + w_norms[h];
+        const eT val   = norms - eT(2)*gram.at(h,g) - tol_factor*norms;
+        
+        if(val < min_val)  { min_val = val; }
+        }
+      
+      half_sep[g] = eT(0.5) * std::sqrt( (std::max)(min_val, eT(0)) );
+      }
+    }
+  }
+
+
+
+//! assign the samples in the given range to their nearest means;
+//! returns the number of sample-to-mean distances evaluated
+template<typename eT, uword dist_id>
+inline
+uword
+km_bounds<eT,dist_id>::assign(const Mat<eT>& X, const uword start_index, const uword end_index)
+  {
+  arma_debug_sigprint();
+  
+  const uword N_dims = means.n_rows;
+  const uword N_gaus = means.n_cols;
+  
+  // margin against rounding errors in the bounds;
+  // a sample is only skipped if its assigned mean is strictly closer than all others
+  const eT slack = eT(1) + eT(16) * Datum<eT>::eps;
+  
+  uword indices[block_size];
+  uword n_indices = 0;
+  uword n_dist    = 0;
+  
+  Mat<eT> X_block;
+  Mat<eT> dots;
+  
+  for(uword i=start_index; i <= end_index; ++i)
+    {
+    if(have_bounds)
+      {
+      const uword g = labels[i];
+      
+      const eT lower_i = lower[i] - ( (g == max_drift_g) ? max_drift_2 : max_drift_1 );
+      const eT limit   = (std::max)(half_sep[g], lower_i);
+      
+      eT upper_i = upper[i] + drift[g];
+      
+      lower[i] = lower_i;
+      
+      if( (upper_i * slack) >= limit )
+        {
+        upper_i = std::sqrt( distance<eT,dist_id>::eval(N_dims, X.colptr(i), means.colptr(g), mah_aux_mem) );
+        
+        ++n_dist;
+        }
+      
+      upper[i] = upper_i;
+      
+      if( (upper_i * slack) < limit )  { continue; }
+      }
+    
+    indices[n_indices] = i;  ++n_indices;
+    
+    if(n_indices == block_size)
+      {
+      assign_block(X, indices, n_indices, X_block, dots);
+      
+      n_dist += n_indices * N_gaus;  n_indices = 0;
+      }
+    }
+  
+  if(n_indices > 0)
+    {
+    assign_block(X, indices, n_indices, X_block, dots);
+    
+    n_dist += n_indices * N_gaus;
+    }
+  
+  return n_dist;
+  }
+
+
+
+//! assign a block of samples by evaluating the distances to all means as ||x||^2 - 2 x'c + ||c||^2;
+//! the means that can be the nearest within the rounding error of this expression are checked with the exact distance,
+//! so that the assignment (including ties) is the same as when the exact distance is evaluated for all means
+template<typename eT, uword dist_id>
+inline
+void
+km_bounds<eT,dist_id>::assign_block(const Mat<eT>& X, const uword* indices, const uword n_indices, Mat<eT>& X_block, Mat<eT>& dots)
+  {
+  arma_debug_sigprint();
+  
+  const uword N_dims = means.n_rows;
+  const uword N_gaus = means.n_cols;
+  
+  X_block.set_size(N_dims, n_indices);
+  
+  for(uword j=0; j < n_indices; ++j)  { arrayops::copy(X_block.colptr(j), X.colptr(indices[j]), N_dims); }
+  
+  dots = w_means.t() * X_block;
+  
+  const eT  tol_factor  = eT(N_dims + 2) * Datum<eT>::eps;
+  const eT* w_norms_mem = w_norms.memptr();
+  
+  for(uword j=0; j < n_indices; ++j)
+    {
+    const uword i = indices[j];
+    
+    const eT* X_colptr = X.colptr(i);
+    const eT  X_norm   = w_norm(X_colptr, N_dims);
+    
+    eT* est = dots.colptr(j);
+    
+    eT min_est = Datum<eT>::inf;
+    eT min_tol = eT(0);
+    
+    for(uword g=0; g < N_gaus; ++g)
+      {
+      const eT val = (X_norm + w_norms_mem[g]) - eT(2)*est[g];
+      
+      est[g] = val;
+      
+      if(val < min_est)  { min_est = val;  min_tol = tol_factor * (X_norm + w_norms_mem[g]); }
+      }
+    
+    const eT limit = min_est + min_tol;
+    
+    eT    min_dist = Datum<eT>::inf;
+    eT    sec_dist = Datum<eT>::inf;
+    uword best_g   = 0;
+    
+    for(uword g=0; g < N_gaus; ++g)
+      {
+      const eT est_lo = est[g] - tol_factor * (X_norm + w_norms_mem[g]);
+      
+      eT val = est_lo;
+      
+      if(est_lo <= limit)
+        {
+        val = distance<eT,dist_id>::eval(N_dims, X_colptr, means.colptr(g), mah_aux_mem);
+        
+        if(val < min_dist)
+          {
+          if(min_dist < sec_dist)  { sec_dist = min_dist; }
+          
+          min_dist = val;
+          best_g   = g;
+          
+          continue;
+          }
+        }
+      
+      if(val < sec_dist)  { sec_dist = val; }
+      }
+    
+    labels[i] = best_g;
+    upper[i]  = std::sqrt(min_dist);
+    lower[i]  = std::sqrt( (std::max)(sec_dist, eT(0)) );
+    }
+  }
+
+
+
+template<typename eT, uword dist_id>
+arma_inline
+uword
+km_bounds<eT,dist_id>::label(const uword i) const
+  {
+  return labels[i];
+  }
+
+
+
+//! fetch the next chunk of samples from the source;
+//! returns false at the end of the stream, and also if the chunk is not usable (indicated via bad_chunk)
+template<typename eT, typename functor>
+inline
+bool
+gmm_online::next_chunk(functor& source, Mat<eT>& X, const uword N_dims, bool& bad_chunk)
+  {
+  arma_debug_sigprint();
+  
+  bad_chunk = false;
+  
+  if(source(X) == false)  { return false; }
+  
+  if( (X.n_rows != N_dims) || X.internal_has_nonfinite() )  { bad_chunk = true; return false; }
+  
+  return true;
+  }
+
+
+
+//! one step of mini-batch k-means (Sculley, 2010): each mean moves towards the mean of the samples assigned to it in this chunk,
+//! with a step size given by the fraction of all its samples so far that are in this chunk;
+//! returns the average distance moved by the means
+template<typename eT, uword dist_id>
+inline
+eT
+gmm_online::km_update(Mat<eT>& means, Row<uword>& counts, const Mat<eT>& X, const umat& boundaries, const eT* mah_aux_mem)
+  {
+  arma_debug_sigprint();
+  
+  const uword X_n_cols = X.n_cols;
+  
+  const uword N_dims = means.n_rows;
+  const uword N_gaus = means.n_cols;
+  
+  km_bounds<eT,dist_id> bounds(X_n_cols, mah_aux_mem);
+  
+  bounds.update_means(means);
+  
+  #if defined(ARMA_USE_OPENMP)
+    {
+    const uword n_threads = boundaries.n_cols;
+    
+    #pragma omp parallel for schedule(static)
+    for(uword t=0; t < n_threads; ++t)
+      {
+      bounds.assign(X, boundaries.at(0,t), boundaries.at(1,t));
+      }
+    }
+  #else
+    {
+    arma_ignore(boundaries);
+    
+    bounds.assign(X, 0, X_n_cols-1);
+    }
+  #endif
+  
+  Mat<eT>    acc_means(N_dims, N_gaus, arma_zeros_indicator());
+  Row<uword> acc_hefts(        N_gaus, arma_zeros_indicator());
+  
+  uword* acc_hefts_mem = acc_hefts.memptr();
+  
+  for(uword i=0; i < X_n_cols; ++i)
+    {
+    const uword g = bounds.label(i);
+    
+    const eT* X_colptr = X.colptr(i);
+          eT* acc_mean = acc_means.colptr(g);
+    
+    for(uword d=0; d < N_dims; ++d)  { acc_mean[d] += X_colptr[d]; }
+    
+    acc_hefts_mem[g]++;
+    }
+  
+  running_mean_scalar<eT> rs_delta;
+  
+  uword* counts_mem = counts.memptr();
+  
+  podarray<eT> old_mean(N_dims);
+  
+  for(uword g=0; g < N_gaus; ++g)
+    {
+    const uword acc_heft = acc_hefts_mem[g];
+    
+    if(acc_heft == 0)  { rs_delta(eT(0)); continue; }
+    
+    counts_mem[g] += acc_heft;
+    
+    const eT step = eT(acc_heft) / eT(counts_mem[g]);
+    
+    const eT* acc_mean = acc_means.colptr(g);
+          eT* mean     = means.colptr(g);
+    
+    arrayops::copy(old_mean.memptr(), mean, N_dims);
+    
+    for(uword d=0; d < N_dims; ++d)
+      {
+      mean[d] += step * ( (acc_mean[d] / eT(acc_heft)) - mean[d] );
+      }
+    
+    rs_delta( distance<eT,dist_id>::eval(N_dims, old_mean.memptr(), mean, mah_aux_mem) );
+    }
+  
+  return rs_delta.mean();
+  }
+
 }
 
 
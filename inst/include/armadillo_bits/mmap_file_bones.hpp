@@ -0,0 +1,55 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2026 Dirk Eddelbuettel
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// https://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+
+//! \addtogroup mmap_file
+//! @{
+
+
+//! view of the entire contents of a file - INTERNAL USE ONLY!
+//! the file is memory-mapped when mmap() is available, otherwise it is read into memory;
+//! a writable mapping is private (copy-on-write), so changes are never written back to the file
+class mmap_file
+  {
+  public:
+  
+  const char* mem     = nullptr;  //!< start of the file contents
+  uword       n_bytes = 0;        //!< size of the file contents
+  
+  inline ~mmap_file();
+  inline  mmap_file();
+  
+  mmap_file(const mmap_file&)            = delete;
+  mmap_file& operator=(const mmap_file&) = delete;
+  
+  inline bool open(const std::string& name, const bool writable = false);
+  inline void close();
+  
+  arma_warn_unused inline bool is_mapped() const;
+  
+  
+  private:
+  
+  void*  map_ptr = nullptr;
+  size_t map_len = 0;
+  
+  podarray<char> buffer;
+  };
+
+
+
+//! @}
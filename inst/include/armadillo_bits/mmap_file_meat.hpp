@@ -0,0 +1,154 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2026 Dirk Eddelbuettel
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// https://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+
+//! \addtogroup mmap_file
+//! @{
+
+
+
+inline
+mmap_file::~mmap_file()
+  {
+  arma_debug_sigprint_this(this);
+  
+  close();
+  }
+
+
+
+inline
+mmap_file::mmap_file()
+  {
+  arma_debug_sigprint_this(this);
+  }
+
+
+
+inline
+bool
+mmap_file::open(const std::string& name, const bool writable)
+  {
+  arma_debug_sigprint();
+  
+  close();
+  
+  #if defined(ARMA_HAVE_MMAP)
+    {
+    const int fd = ::open(name.c_str(), O_RDONLY);
+    
+    if(fd < 0)  { return false; }
+    
+    struct stat info;
+    
+    const bool stat_ok = (::fstat(fd, &info) == 0) && S_ISREG(info.st_mode);
+    
+    if(stat_ok && (info.st_size > 0) && (uintmax_t(info.st_size) <= uintmax_t(std::numeric_limits<size_t>::max())))
+      {
+      const size_t len = size_t(info.st_size);
+      
+      const int prot = (writable) ? (PROT_READ | PROT_WRITE) : PROT_READ;
+      
+      void* ptr = ::mmap(nullptr, len, prot, MAP_PRIVATE, fd, 0);
+      
+      if(ptr != MAP_FAILED)
+        {
+        arma_debug_print("mmap_file::open(): mapped file");
+        
+        map_ptr = ptr;
+        map_len = len;
+        
+        mem     = static_cast<const char*>(ptr);
+        n_bytes = uword(len);
+        
+        ::close(fd);
+        
+        return true;
+        }
+      }
+    
+    ::close(fd);
+    
+    // fallthrough for empty files, non-regular files and mmap() failures
+    }
+  #else
+    {
+    arma_ignore(writable);
+    }
+  #endif
+  
+  std::ifstream f(name, std::fstream::binary);
+  
+  if(f.is_open() == false)  { return false; }
+  
+  f.seekg(0, std::ios::end);
+  
+  const std::streamoff len = std::streamoff(f.tellg());
+  
+  f.seekg(0, std::ios::beg);
+  
+  if(f.fail() || (len < 0))  { return false; }
+  
+  try { buffer.set_size(uword(len) + 1); } catch(...) { return false; }
+  
+  f.read(buffer.memptr(), std::streamsize(len));
+  
+  if(f.gcount() != std::streamsize(len))  { buffer.reset(); return false; }
+  
+  buffer[uword(len)] = char(0);
+  
+  mem     = buffer.memptr();
+  n_bytes = uword(len);
+  
+  return true;
+  }
+
+
+
+inline
+void
+mmap_file::close()
+  {
+  arma_debug_sigprint();
+  
+  #if defined(ARMA_HAVE_MMAP)
+    {
+    if(map_ptr != nullptr)  { ::munmap(map_ptr, map_len); }
+    }
+  #endif
+  
+  map_ptr = nullptr;
+  map_len = 0;
+  
+  buffer.reset();
+  
+  mem     = nullptr;
+  n_bytes = 0;
+  }
+
+
+
+inline
+bool
+mmap_file::is_mapped() const
+  {
+  return (map_ptr != nullptr);
+  }
+
+
+
+//! @}
@@ -0,0 +1,81 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2026 Dirk Eddelbuettel
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// https://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+
+//! \addtogroup mmap_obj
+//! @{
+
+
+//! Mat, Cube or SpMat object whose elements reside in a memory-mapped arma_binary or raw_binary file.
+//! The object aliases the mapped pages, so opening is O(1) and processes mapping the same file share physical memory.
+//! A read-only mapping only allows const access via get();
+//! a writable mapping is copy-on-write: modified pages are private to the process and never written back to the file.
+//! When the file cannot be aliased (unsupported file type, misaligned or converted data, no mmap() support),
+//! the object is loaded normally via .load().
+template<typename T1>
+class mmap_obj
+  {
+  public:
+  
+  typedef typename T1::elem_type elem_type;
+  
+  inline ~mmap_obj();
+  inline  mmap_obj();
+  
+  inline explicit mmap_obj(const std::string& name, const file_type type = arma_binary, const bool writable = false);
+  
+  mmap_obj(const mmap_obj&)            = delete;
+  mmap_obj& operator=(const mmap_obj&) = delete;
+  
+  inline bool load(const std::string& name, const file_type type = arma_binary, const bool writable = false);
+  inline void reset();
+  
+  arma_warn_unused inline bool is_mapped() const;
+  
+  arma_warn_unused inline const T1& get() const;
+  arma_warn_unused inline       T1& get_rw();
+  
+  inline operator const T1& () const;
+  
+  
+  private:
+  
+  mmap_file map;
+  
+  T1* obj_ptr = nullptr;
+  
+  bool mapped      = false;
+  bool mapped_rw   = false;
+  bool own_values  = true;   // SpMat only
+  bool own_indices = true;   // SpMat only
+  
+  inline void release();
+  
+  inline bool read_header(uword& offset, std::string& header, uword* sizes, const uword n_sizes) const;
+  
+  inline   Mat<elem_type>* map_obj(const file_type type, const bool writable, const   Mat<elem_type>* junk);
+  inline  Cube<elem_type>* map_obj(const file_type type, const bool writable, const  Cube<elem_type>* junk);
+  inline SpMat<elem_type>* map_obj(const file_type type, const bool writable, const SpMat<elem_type>* junk);
+  
+  inline void detach(  Mat<elem_type>& x);
+  inline void detach( Cube<elem_type>& x);
+  inline void detach(SpMat<elem_type>& x);
+  };
+
+
+
+//! @}
@@ -0,0 +1,498 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2026 Dirk Eddelbuettel
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// https://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+
+//! \addtogroup mmap_obj
+//! @{
+
+
+
+template<typename T1>
+inline
+mmap_obj<T1>::~mmap_obj()
+  {
+  arma_debug_sigprint_this(this);
+  
+  release();
+  }
+
+
+
+template<typename T1>
+inline
+mmap_obj<T1>::mmap_obj()
+  {
+  arma_debug_sigprint_this(this);
+  
+  obj_ptr = new T1();
+  }
+
+
+
+template<typename T1>
+inline
+mmap_obj<T1>::mmap_obj(const std::string& name, const file_type type, const bool writable)
+  {
+  arma_debug_sigprint_this(this);
+  
+  obj_ptr = new T1();
+  
+  const bool load_okay = load(name, type, writable);
+  
+  if(load_okay == false)
+    {
+    release();
+    
+    arma_stop_runtime_error("mmap_obj::mmap_obj(): couldn't load file");
+    }
+  }
+
+
+
+template<typename T1>
+inline
+bool
+mmap_obj<T1>::load(const std::string& name, const file_type type, const bool writable)
+  {
+  arma_debug_sigprint();
+  
+  reset();
+  
+  if( map.open(name, writable) && map.is_mapped() )
+    {
+    T1* tmp = map_obj(type, writable, obj_ptr);
+    
+    if(tmp != nullptr)
+      {
+      arma_debug_print("mmap_obj::load(): aliasing mapped file");
+      
+      delete obj_ptr;
+      
+      obj_ptr   = tmp;
+      mapped    = true;
+      mapped_rw = writable;
+      
+      return true;
+      }
+    }
+  
+  arma_debug_print("mmap_obj::load(): loading a copy");
+  
+  map.close();
+  
+  return (*obj_ptr).load(name, type);
+  }
+
+
+
+template<typename T1>
+inline
+void
+mmap_obj<T1>::reset()
+  {
+  arma_debug_sigprint();
+  
+  release();
+  
+  obj_ptr = new T1();
+  }
+
+
+
+template<typename T1>
+inline
+bool
+mmap_obj<T1>::is_mapped() const
+  {
+  return mapped;
+  }
+
+
+
+template<typename T1>
+inline
+const T1&
+mmap_obj<T1>::get() const
+  {
+  return (*obj_ptr);
+  }
+
+
+
+template<typename T1>
+inline
+T1&
+mmap_obj<T1>::get_rw()
+  {
+  arma_conform_check( (mapped && (mapped_rw == false)), "mmap_obj::get_rw(): object is mapped read-only" );
+  
+  return (*obj_ptr);
+  }
+
+
+
+template<typename T1>
+inline
+mmap_obj<T1>::operator const T1& () const
+  {
+  return (*obj_ptr);
+  }
+
+
+
+template<typename T1>
+inline
+void
+mmap_obj<T1>::release()
+  {
+  arma_debug_sigprint();
+  
+  // the object must be destroyed before the mapping is removed
+  
+  if(obj_ptr != nullptr)
+    {
+    detach(*obj_ptr);
+    
+    delete obj_ptr;
+    
+    obj_ptr = nullptr;
+    }
+  
+  map.close();
+  
+  mapped    = false;
+  mapped_rw = false;
+  }
+
+
+
+//! parse the header of an arma_binary file and find the start of the data
+template<typename T1>
+inline
+bool
+mmap_obj<T1>::read_header(uword& offset, std::string& header, uword* sizes, const uword n_sizes) const
+  {
+  arma_debug_sigprint();
+  
+  // the header, sizes and any padding always fit within the first 256 bytes
+  
+  std::istringstream ss( std::string(map.mem, (std::min)(map.n_bytes, uword(256))) );
+  
+  ss >> header;
+  
+  for(uword i=0; i < n_sizes; ++i)  { ss >> sizes[i]; }
+  
+  ss.get();
+  
+  if(ss.fail())  { return false; }
+  
+  const std::streamoff pos = std::streamoff(ss.tellg());
+  
+  if( (pos <= 0) || (uword(pos) > map.n_bytes) )  { return false; }
+  
+  offset = uword(pos);
+  
+  return true;
+  }
+
+
+
+template<typename T1>
+inline
+Mat<typename T1::elem_type>*
+mmap_obj<T1>::map_obj(const file_type type, const bool writable, const Mat<elem_type>* junk)
+  {
+  arma_debug_sigprint();
+  arma_ignore(junk);
+  
+  typedef elem_type eT;
+  
+  uword f_n_rows = 0;
+  uword f_n_cols = 0;
+  uword offset   = 0;
+  
+  if(type == raw_binary)
+    {
+    f_n_rows = map.n_bytes / uword(sizeof(eT));
+    f_n_cols = 1;
+    }
+  else
+  if(type == arma_binary)
+    {
+    std::string f_header;
+    uword       f_sizes[2];
+    
+    if(read_header(offset, f_header, f_sizes, 2) == false)  { return nullptr; }
+    
+    // a mismatched header is handled by Mat::load(), which allows conversion of u32/s32 data
+    if(f_header != diskio::gen_bin_header(Mat<eT>()))  { return nullptr; }
+    
+    f_n_rows = f_sizes[0];
+    f_n_cols = f_sizes[1];
+    
+    const uword n_avail = (map.n_bytes - offset) / uword(sizeof(eT));
+    
+    if( (f_n_rows > 0) && (f_n_cols > (n_avail / f_n_rows)) )  { return nullptr; }
+    }
+  else
+    {
+    return nullptr;
+    }
+  
+  const char* data = map.mem + offset;
+  
+  if( (std::size_t(data) % alignof(eT)) != 0 )  { return nullptr; }
+  
+  eT* aux_mem = const_cast<eT*>( reinterpret_cast<const eT*>(data) );
+  
+  Mat<eT>* out = nullptr;
+  
+  try { out = new Mat<eT>(aux_mem, f_n_rows, f_n_cols, false, (writable == false)); } catch(...) { return nullptr; }
+  
+  return out;
+  }
+
+
+
+template<typename T1>
+inline
+Cube<typename T1::elem_type>*
+mmap_obj<T1>::map_obj(const file_type type, const bool writable, const Cube<elem_type>* junk)
+  {
+  arma_debug_sigprint();
+  arma_ignore(junk);
+  
+  typedef elem_type eT;
+  
+  uword f_n_rows   = 0;
+  uword f_n_cols   = 0;
+  uword f_n_slices = 0;
+  uword offset     = 0;
+  
+  if(type == raw_binary)
+    {
+    f_n_rows   = map.n_bytes / uword(sizeof(eT));
+    f_n_cols   = 1;
+    f_n_slices = 1;
+    }
+  else
+  if(type == arma_binary)
+    {
+    std::string f_header;
+    uword       f_sizes[3];
+    
+    if(read_header(offset, f_header, f_sizes, 3) == false)  { return nullptr; }
+    
+    if(f_header != diskio::gen_bin_header(Cube<eT>()))  { return nullptr; }
+    
+    f_n_rows   = f_sizes[0];
+    f_n_cols   = f_sizes[1];
+    f_n_slices = f_sizes[2];
+    
+    const uword n_avail = (map.n_bytes - offset) / uword(sizeof(eT));
+    
+    if( (f_n_rows > 0) && (f_n_cols > (n_avail / f_n_rows)) )  { return nullptr; }
+    
+    const uword n_elem_slice = f_n_rows * f_n_cols;
+    
+    if( (n_elem_slice > 0) && (f_n_slices > (n_avail / n_elem_slice)) )  { return nullptr; }
+    }
+  else
+    {
+    return nullptr;
+    }
+  
+  const char* data = map.mem + offset;
+  
+  if( (std::size_t(data) % alignof(eT)) != 0 )  { return nullptr; }
+  
+  eT* aux_mem = const_cast<eT*>( reinterpret_cast<const eT*>(data) );
+  
+  Cube<eT>* out = nullptr;
+  
+  try { out = new Cube<eT>(aux_mem, f_n_rows, f_n_cols, f_n_slices, false, (writable == false)); } catch(...) { return nullptr; }
+  
+  return out;
+  }
+
+
+
+//! the values and row indices are aliased when suitably aligned; the column pointers are always copied.
+//! modifying a sparse matrix may reallocate its arrays, so only read-only mappings are supported
+template<typename T1>
+inline
+SpMat<typename T1::elem_type>*
+mmap_obj<T1>::map_obj(const file_type type, const bool writable, const SpMat<elem_type>* junk)
+  {
+  arma_debug_sigprint();
+  arma_ignore(junk);
+  
+  typedef elem_type eT;
+  
+  if( (type != arma_binary) || writable )  { return nullptr; }
+  
+  uword       offset = 0;
+  std::string f_header;
+  uword       f_sizes[3];
+  
+  if(read_header(offset, f_header, f_sizes, 3) == false)  { return nullptr; }
+  
+  if(f_header != diskio::gen_bin_header(SpMat<eT>()))  { return nullptr; }
+  
+  const uword f_n_rows = f_sizes[0];
+  const uword f_n_cols = f_sizes[1];
+  const uword f_n_nz   = f_sizes[2];
+  
+  const uword n_avail = map.n_bytes - offset;
+  
+  if( f_n_nz > (n_avail / uword(sizeof(eT) + sizeof(uword))) )  { return nullptr; }
+  
+  const uword n_remain = n_avail - f_n_nz * uword(sizeof(eT) + sizeof(uword));
+  
+  if( f_n_cols >= (n_remain / uword(sizeof(uword))) )  { return nullptr; }
+  
+  const char* f_values      = map.mem  + offset;
+  const char* f_row_indices = f_values + f_n_nz * uword(sizeof(eT));
+  const char* f_col_ptrs    = f_row_indices + f_n_nz * uword(sizeof(uword));
+  
+  // the element following the values must be zero to ensure integrity of iterators;
+  // in the file it overlaps the start of the row indices
+  
+  bool alias_values = ( (std::size_t(f_values) % alignof(eT)) == 0 ) && ( uword(sizeof(eT)) <= (n_avail - f_n_nz * uword(sizeof(eT))) );
+  
+  if(alias_values)
+    {
+    for(uword i=0; i < uword(sizeof(eT)); ++i)  { if(f_row_indices[i] != char(0))  { alias_values = false; break; } }
+    }
+  
+  // the element following the row indices is the first column pointer, which is checked to be zero below
+  
+  const bool alias_indices = ( (std::size_t(f_row_indices) % alignof(uword)) == 0 );
+  
+  if( (alias_values == false) && (alias_indices == false) )  { return nullptr; }
+  
+  SpMat<eT>* out = nullptr;
+  
+  try
+    {
+    out = new SpMat<eT>(f_n_rows, f_n_cols);
+    
+    uword* col_ptrs = access::rwp(out->col_ptrs);
+    
+    std::memcpy(col_ptrs, f_col_ptrs, (f_n_cols+1) * sizeof(uword));
+    
+    // inconsistent data (eg. saved with 32 bit uword) is handled by SpMat::load()
+    
+    bool check = (col_ptrs[0] == uword(0)) && (col_ptrs[f_n_cols] == f_n_nz);
+    
+    for(uword i=0; (i < f_n_cols) && check; ++i)  { check = (col_ptrs[i+1] >= col_ptrs[i]); }
+    
+    if(check == false)  { delete out; return nullptr; }
+    
+    memory::release(access::rw(out->values));
+    memory::release(access::rw(out->row_indices));
+    
+    access::rw(out->values)      = nullptr;
+    access::rw(out->row_indices) = nullptr;
+    
+    if(alias_values)
+      {
+      access::rw(out->values) = reinterpret_cast<const eT*>(f_values);
+      }
+    else
+      {
+      eT* values = memory::acquire<eT>(f_n_nz + 1);
+      
+      std::memcpy(values, f_values, f_n_nz * sizeof(eT));
+      
+      values[f_n_nz] = eT(0);
+      
+      access::rw(out->values) = values;
+      }
+    
+    if(alias_indices)
+      {
+      access::rw(out->row_indices) = reinterpret_cast<const uword*>(f_row_indices);
+      }
+    else
+      {
+      uword* row_indices = memory::acquire<uword>(f_n_nz + 1);
+      
+      std::memcpy(row_indices, f_row_indices, f_n_nz * sizeof(uword));
+      
+      row_indices[f_n_nz] = uword(0);
+      
+      access::rw(out->row_indices) = row_indices;
+      }
+    
+    access::rw(out->n_nonzero) = f_n_nz;
+    }
+  catch(...)
+    {
+    if(out != nullptr)  { detach(*out); delete out; }
+    
+    return nullptr;
+    }
+  
+  return out;
+  }
+
+
+
+template<typename T1>
+inline
+void
+mmap_obj<T1>::detach(Mat<elem_type>& x)
+  {
+  // memory not allocated by Mat is never released by Mat
+  arma_ignore(x);
+  }
+
+
+
+template<typename T1>
+inline
+void
+mmap_obj<T1>::detach(Cube<elem_type>& x)
+  {
+  arma_ignore(x);
+  }
+
+
+
+template<typename T1>
+inline
+void
+mmap_obj<T1>::detach(SpMat<elem_type>& x)
+  {
+  arma_debug_sigprint();
+  
+  // prevent the destructor from releasing arrays which alias the mapping
+  
+  const char* map_beg = map.mem;
+  const char* map_end = map.mem + map.n_bytes;
+  
+  const char* values      = reinterpret_cast<const char*>(x.values);
+  const char* row_indices = reinterpret_cast<const char*>(x.row_indices);
+  
+  if( (map_beg != nullptr) && (values      >= map_beg) && (values      < map_end) )  { access::rw(x.values)      = nullptr; }
+  if( (map_beg != nullptr) && (row_indices >= map_beg) && (row_indices < map_end) )  { access::rw(x.row_indices) = nullptr; }
+  }
+
+
+
+//! @}
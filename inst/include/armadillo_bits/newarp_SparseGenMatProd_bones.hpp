@@ -26,8 +26,7 @@ class SparseGenMatProd
   {
   private:
   
-  const SpMat<eT>& op_mat;
-        SpMat<eT>  op_mat_st;
+  spmv_plan<eT> plan;
   
   
   public:
@@ -35,6 +34,8 @@ class SparseGenMatProd
   const uword n_rows;  // number of rows of the underlying matrix
   const uword n_cols;  // number of columns of the underlying matrix
   
+  mutable double time_matvec = 0.0;  // seconds spent in perform_op()
+  
   inline SparseGenMatProd(const SpMat<eT>& mat_obj);
   
   inline void perform_op(eT* x_in, eT* y_out) const;
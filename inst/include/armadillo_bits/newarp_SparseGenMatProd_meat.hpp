@@ -23,13 +23,12 @@ namespace newarp
 template<typename eT>
 inline
 SparseGenMatProd<eT>::SparseGenMatProd(const SpMat<eT>& mat_obj)
-  : op_mat(mat_obj)
-  , n_rows(mat_obj.n_rows)
+  : n_rows(mat_obj.n_rows)
   , n_cols(mat_obj.n_cols)
   {
   arma_debug_sigprint();
   
-  op_mat_st = op_mat.st(); // pre-calculate transpose
+  plan.inspect(mat_obj);  // pre-calculate row-major form
   }
 
 
@@ -43,20 +42,12 @@ SparseGenMatProd<eT>::perform_op(eT* x_in, eT* y_out) const
   {
   arma_debug_sigprint();
   
-  // // OLD METHOD
-  // 
-  // const Col<eT> x(x_in , n_cols, false, true);
-  //       Col<eT> y(y_out, n_rows, false, true);
-  // 
-  // y = op_mat * x;
+  wall_clock timer;
+  timer.tic();
   
+  plan.apply(y_out, x_in);
   
-  // NEW METHOD
-  
-  const Row<eT> x(x_in , n_cols, false, true);
-        Row<eT> y(y_out, n_rows, false, true);
-  
-  y =  x * op_mat_st;
+  time_matvec += timer.toc();
   }
 
 
@@ -30,6 +30,15 @@ struct  op_accu_mat
   template<typename T1>
   static inline typename T1::elem_type apply_proxy_at(const Proxy<T1>& P);
   
+  template<typename T1>
+  static inline typename T1::elem_type apply_proxy_range(const Proxy<T1>& P, const uword start, const uword end);
+  
+  template<typename T1>
+  static inline typename T1::elem_type apply_proxy_mp(const Proxy<T1>& P, const uword start, const uword end);
+  
+  template<typename T1>
+  static inline typename T1::elem_type apply_proxy(const Proxy<T1>& P);
+  
   template<typename T1>
   static inline typename T1::elem_type apply(const T1& X);
   
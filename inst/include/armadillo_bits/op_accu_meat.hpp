@@ -109,6 +109,126 @@ op_accu_mat::apply_proxy_at(const Proxy<T1>& P)
 
 
 
+//! sum of elements in the linear range [start, end), in column-major order
+template<typename T1>
+inline
+typename T1::elem_type
+op_accu_mat::apply_proxy_range(const Proxy<T1>& P, const uword start, const uword end)
+  {
+  typedef typename T1::elem_type eT;
+  
+  eT val1 = eT(0);
+  eT val2 = eT(0);
+  
+  if(Proxy<T1>::use_at == false)
+    {
+    typename Proxy<T1>::ea_type Pea = P.get_ea();
+    
+    uword i,j;
+    for(i=start, j=start+1; j < end; i+=2, j+=2)  { val1 += Pea[i]; val2 += Pea[j]; }
+    
+    if(i < end)  { val1 += Pea[i]; }
+    }
+  else
+    {
+    const uword n_rows = P.get_n_rows();
+    
+    uword row = start % n_rows;
+    uword col = start / n_rows;
+    
+    for(uword i=start; i < end; ++i)
+      {
+      val1 += P.at(row,col);
+      
+      ++row;
+      
+      if(row == n_rows)  { row = 0; ++col; }
+      }
+    }
+  
+  return (val1 + val2);
+  }
+
+
+
+//! sum of elements in the linear range [start, end), evaluated in parallel;
+//! the range is split into chunks which depend only on its length, so the result does not depend on the number of threads
+template<typename T1>
+inline
+typename T1::elem_type
+op_accu_mat::apply_proxy_mp(const Proxy<T1>& P, const uword start, const uword end)
+  {
+  arma_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  
+  const uword N = (end > start) ? (end - start) : uword(0);
+  
+  if(N == 0)  { return eT(0); }
+  
+  const uword max_n_chunks = 256;
+  
+  const uword n_chunks   = (std::min)(max_n_chunks, (N + 1023) / 1024);
+  const uword chunk_size = (N + n_chunks - 1) / n_chunks;
+  
+  eT partial[max_n_chunks];
+  
+  #if defined(ARMA_USE_OPENMP)
+    {
+    const int n_threads = mp_thread_limit::get();
+    
+    #pragma omp parallel for schedule(static) num_threads(n_threads)
+    for(uword c=0; c < n_chunks; ++c)
+      {
+      const uword chunk_start = start + c*chunk_size;
+      const uword chunk_end   = (std::min)(chunk_start + chunk_size, end);
+      
+      partial[c] = (chunk_start < chunk_end) ? op_accu_mat::apply_proxy_range(P, chunk_start, chunk_end) : eT(0);
+      }
+    }
+  #else
+    {
+    for(uword c=0; c < n_chunks; ++c)
+      {
+      const uword chunk_start = start + c*chunk_size;
+      const uword chunk_end   = (std::min)(chunk_start + chunk_size, end);
+      
+      partial[c] = (chunk_start < chunk_end) ? op_accu_mat::apply_proxy_range(P, chunk_start, chunk_end) : eT(0);
+      }
+    }
+  #endif
+  
+  eT val = eT(0);
+  
+  for(uword c=0; c < n_chunks; ++c)  { val += partial[c]; }
+  
+  return val;
+  }
+
+
+
+//! fused reduction: elements of the expression are consumed directly, without evaluating the expression into a temporary matrix
+template<typename T1>
+inline
+typename T1::elem_type
+op_accu_mat::apply_proxy(const Proxy<T1>& P)
+  {
+  arma_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  
+  if( (arma_config::openmp) && (Proxy<T1>::use_mp) && (mp_gate<eT>::eval(P.get_n_elem())) )
+    {
+    arma_debug_print("op_accu_mat::apply_proxy(): parallel evaluation");
+    
+    return op_accu_mat::apply_proxy_mp(P, uword(0), P.get_n_elem());
+    }
+  
+  return (Proxy<T1>::use_at) ? op_accu_mat::apply_proxy_at(P) : op_accu_mat::apply_proxy_linear(P);
+  }
+
+
+
 template<typename T1>
 inline
 typename T1::elem_type
@@ -116,7 +236,7 @@ op_accu_mat::apply(const T1& X)
   {
   arma_debug_sigprint();
   
-  if( (quasi_unwrap<T1>::has_orig_mem) || (is_Mat<typename Proxy<T1>::stored_type>::value) || (arma_config::openmp && Proxy<T1>::use_mp) )
+  if( (quasi_unwrap<T1>::has_orig_mem) || (is_Mat<typename Proxy<T1>::stored_type>::value) )
     {
     const quasi_unwrap<T1> U(X);
     
@@ -125,7 +245,7 @@ op_accu_mat::apply(const T1& X)
   
   const Proxy<T1> P(X);
   
-  return (Proxy<T1>::use_at) ? op_accu_mat::apply_proxy_at(P) : op_accu_mat::apply_proxy_linear(P);
+  return op_accu_mat::apply_proxy(P);
   }
 
 
@@ -248,7 +368,7 @@ op_accu_mat::apply(const eOp<T1,eop_square>& expr)
   
   const Proxy<expr_type> P(expr);
   
-  return (Proxy<expr_type>::use_at) ? op_accu_mat::apply_proxy_at(P) : op_accu_mat::apply_proxy_linear(P);
+  return op_accu_mat::apply_proxy(P);
   }
 
 
@@ -280,7 +400,7 @@ op_accu_mat::apply(const eOp<T1,eop_pow>& expr)
   
   const Proxy<expr_type> P(expr);
   
-  return (Proxy<expr_type>::use_at) ? op_accu_mat::apply_proxy_at(P) : op_accu_mat::apply_proxy_linear(P);
+  return op_accu_mat::apply_proxy(P);
   }
 
 
@@ -341,7 +461,7 @@ op_accu_mat::apply(const eGlue<T1,T2,eglue_schur>& expr)
   
   const Proxy<expr_type> P(expr);
   
-  return (Proxy<expr_type>::use_at) ? op_accu_mat::apply_proxy_at(P) : op_accu_mat::apply_proxy_linear(P);
+  return op_accu_mat::apply_proxy(P);
   }
 
 
@@ -53,13 +53,7 @@ op_cor::apply(Mat<typename T1::elem_type>& out, const Op<T1,op_cor>& in)
                       ? Mat<eT>(const_cast<eT*>(A.memptr()), A.n_cols, A.n_rows, false, false)
                       : Mat<eT>(const_cast<eT*>(A.memptr()), A.n_rows, A.n_cols, false, false);
   
-  const uword N        = AA.n_rows;
-  const eT    norm_val = (norm_type == 0) ? ( (N > 1) ? eT(N-1) : eT(1) ) : eT(N);
-  
-  const Mat<eT> tmp = AA.each_row() - mean(AA,0);
-  
-  out = tmp.t() * tmp;
-  out /= norm_val;
+  op_cov::direct_cov(out, AA, norm_type);
   
   const Col<eT> s = sqrt(out.diag());
   
@@ -107,13 +101,7 @@ op_cor::apply(Mat<typename T1::elem_type>& out, const Op< Op<T1,op_htrans>, op_c
                         ? Mat<eT>(const_cast<eT*>(A.memptr()), A.n_cols, A.n_rows, false, false)
                         : Mat<eT>(const_cast<eT*>(A.memptr()), A.n_rows, A.n_cols, false, false);
     
-    const uword N        = AA.n_cols;
-    const eT    norm_val = (norm_type == 0) ? ( (N > 1) ? eT(N-1) : eT(1) ) : eT(N);
-    
-    const Mat<eT> tmp = AA.each_col() - mean(AA,1);
-    
-    out = tmp * tmp.t();
-    out /= norm_val;
+    op_cov::direct_cov_trans(out, AA, norm_type);
     
     const Col<eT> s = sqrt(out.diag());
     
@@ -27,6 +27,19 @@ struct op_cov
   {
   template<typename T1> inline static void apply(Mat<typename T1::elem_type>& out, const Op< T1,               op_cov>& in);
   template<typename T1> inline static void apply(Mat<typename T1::elem_type>& out, const Op< Op<T1,op_htrans>, op_cov>& in);
+  
+  //
+  
+  inline static uword block_n_obs(const uword n_vars);
+  
+  template<typename eT> inline static void direct_cov      (Mat<eT>& out, const Mat<eT>& X, const uword norm_type);
+  template<typename eT> inline static void direct_cov_trans(Mat<eT>& out, const Mat<eT>& X, const uword norm_type);
+  
+  template<typename eT> inline static void direct_wcov(Mat<eT>& out, const Mat<eT>& X, const Mat<eT>& w, const uword norm_type);
+  
+  template<typename eT> inline static void direct_cov_pairwise(Mat<eT>& out, const Mat<eT>& X, const uword norm_type, const bool do_cor);
+  
+  template<typename eT> inline static void direct_cov_packed(Col<eT>& out, const Mat<eT>& X, const uword norm_type);
   };
 
 
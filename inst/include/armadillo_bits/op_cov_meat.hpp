@@ -46,13 +46,7 @@ op_cov::apply(Mat<typename T1::elem_type>& out, const Op<T1,op_cov>& in)
                       ? Mat<eT>(const_cast<eT*>(A.memptr()), A.n_cols, A.n_rows, false, false)
                       : Mat<eT>(const_cast<eT*>(A.memptr()), A.n_rows, A.n_cols, false, false);
   
-  const uword N        = AA.n_rows;
-  const eT    norm_val = (norm_type == 0) ? ( (N > 1) ? eT(N-1) : eT(1) ) : eT(N);
-  
-  const Mat<eT> tmp = AA.each_row() - mean(AA,0);
-  
-  out = tmp.t() * tmp;
-  out /= norm_val;
+  op_cov::direct_cov(out, AA, norm_type);
   }
 
 
@@ -89,14 +83,356 @@ op_cov::apply(Mat<typename T1::elem_type>& out, const Op< Op<T1,op_htrans>, op_c
                         ? Mat<eT>(const_cast<eT*>(A.memptr()), A.n_cols, A.n_rows, false, false)
                         : Mat<eT>(const_cast<eT*>(A.memptr()), A.n_rows, A.n_cols, false, false);
     
-    const uword N        = AA.n_cols;
-    const eT    norm_val = (norm_type == 0) ? ( (N > 1) ? eT(N-1) : eT(1) ) : eT(N);
+    op_cov::direct_cov_trans(out, AA, norm_type);
+    }
+  }
+
+
+
+//! number of observations processed per block; each block holds about 2^20 elements
+inline
+uword
+op_cov::block_n_obs(const uword n_vars)
+  {
+  return (std::max)( uword(64), uword(1048576) / (std::max)(n_vars, uword(1)) );
+  }
+
+
+
+//! covariance of the columns of X (rows are observations);
+//! the data is centred and accumulated one block of rows at a time,
+//! so a full centred copy of X is never formed
+template<typename eT>
+inline
+void
+op_cov::direct_cov(Mat<eT>& out, const Mat<eT>& X, const uword norm_type)
+  {
+  arma_debug_sigprint();
+  
+  const uword N = X.n_rows;
+  const uword P = X.n_cols;
+  
+  const eT norm_val = (norm_type == 0) ? ( (N > 1) ? eT(N-1) : eT(1) ) : eT(N);
+  
+  const Row<eT> mu = mean(X,0);
+  
+  const uword B = op_cov::block_n_obs(P);
+  
+  if(N <= B)
+    {
+    const Mat<eT> tmp = X.each_row() - mu;
+    
+    out = tmp.t() * tmp;
+    }
+  else
+    {
+    out.zeros(P,P);
+    
+    Mat<eT> blk;
     
-    const Mat<eT> tmp = AA.each_col() - mean(AA,1);
+    for(uword row_start=0; row_start < N; row_start += B)
+      {
+      const uword row_end = (std::min)(row_start + B, N) - 1;
+      
+      blk = X.rows(row_start, row_end);
+      
+      blk.each_row() -= mu;
+      
+      out += blk.t() * blk;
+      }
+    }
+  
+  out /= norm_val;
+  }
+
+
+
+//! covariance of the rows of X (columns are observations)
+template<typename eT>
+inline
+void
+op_cov::direct_cov_trans(Mat<eT>& out, const Mat<eT>& X, const uword norm_type)
+  {
+  arma_debug_sigprint();
+  
+  const uword N = X.n_cols;
+  const uword P = X.n_rows;
+  
+  const eT norm_val = (norm_type == 0) ? ( (N > 1) ? eT(N-1) : eT(1) ) : eT(N);
+  
+  const Col<eT> mu = mean(X,1);
+  
+  const uword B = op_cov::block_n_obs(P);
+  
+  if(N <= B)
+    {
+    const Mat<eT> tmp = X.each_col() - mu;
     
     out = tmp * tmp.t();
-    out /= norm_val;
     }
+  else
+    {
+    out.zeros(P,P);
+    
+    Mat<eT> blk;
+    
+    for(uword col_start=0; col_start < N; col_start += B)
+      {
+      const uword col_end = (std::min)(col_start + B, N) - 1;
+      
+      blk = X.cols(col_start, col_end);
+      
+      blk.each_col() -= mu;
+      
+      out += blk * blk.t();
+      }
+    }
+  
+  out /= norm_val;
+  }
+
+
+
+//! weighted covariance of the columns of X;
+//! norm_type = 0 gives the unbiased estimate for reliability weights: sum(w) - sum(w^2)/sum(w);
+//! norm_type = 1 normalises by sum(w)
+template<typename eT>
+inline
+void
+op_cov::direct_wcov(Mat<eT>& out, const Mat<eT>& X, const Mat<eT>& w, const uword norm_type)
+  {
+  arma_debug_sigprint();
+  
+  typedef typename get_pod_type<eT>::result T;
+  
+  const uword N = X.n_rows;
+  const uword P = X.n_cols;
+  
+  arma_conform_check( (w.is_vec() == false) && (w.is_empty() == false), "wcov(): weights must be given as a vector" );
+  arma_conform_check( (w.n_elem != N),                                  "wcov(): number of weights must match the number of observations" );
+  
+  const eT* w_mem = w.memptr();
+  
+  eT V1 = eT(0);
+  eT V2 = eT(0);
+  
+  for(uword i=0; i < N; ++i)
+    {
+    const eT wi = w_mem[i];
+    
+    if( (access::tmp_real(wi) < T(0)) || (arma_isnonfinite(wi)) )  { arma_stop_logic_error("wcov(): weights must be finite and non-negative"); return; }
+    
+    V1 += wi;
+    V2 += wi*wi;
+    }
+  
+  if(access::tmp_real(V1) <= T(0))  { arma_stop_logic_error("wcov(): sum of weights must be positive"); return; }
+  
+  const eT norm_val = (norm_type == 0) ? (V1 - V2/V1) : V1;
+  
+  const Row<eT> mu = (trans(Col<eT>(const_cast<eT*>(w_mem), N, false, true)) * X) / V1;
+  
+  const uword B = op_cov::block_n_obs(P);
+  
+  out.zeros(P,P);
+  
+  Mat<eT> blk;
+  Col<eT> sqrt_w;
+  
+  for(uword row_start=0; row_start < N; row_start += B)
+    {
+    const uword row_end = (std::min)(row_start + B, N) - 1;
+    
+    blk    = X.rows(row_start, row_end);
+    sqrt_w = sqrt( Col<eT>(const_cast<eT*>(&(w_mem[row_start])), row_end - row_start + 1, false, true) );
+    
+    blk.each_row() -= mu;
+    blk.each_col() %= sqrt_w;
+    
+    out += blk.t() * blk;
+    }
+  
+  out /= norm_val;
+  }
+
+
+
+//! covariance (or correlation) of the columns of X, using for each pair of columns
+//! only the observations where both values are finite (pairwise-complete observations);
+//! the per-pair sums are accumulated via matrix multiplications over blocks of rows
+template<typename eT>
+inline
+void
+op_cov::direct_cov_pairwise(Mat<eT>& out, const Mat<eT>& X, const uword norm_type, const bool do_cor)
+  {
+  arma_debug_sigprint();
+  
+  const uword N = X.n_rows;
+  const uword P = X.n_cols;
+  
+  if(X.internal_has_nonfinite() == false)
+    {
+    arma_debug_print("op_cov::direct_cov_pairwise(): no non-finite elements");
+    
+    op_cov::direct_cov(out, X, norm_type);
+    
+    if(do_cor)
+      {
+      const Col<eT> s = sqrt(out.diag());
+      
+      out /= (s * s.t());
+      }
+    
+    return;
+    }
+  
+  // shift each column by the mean of its finite elements, for numerical stability
+  
+  Row<eT> shift(P, arma_zeros_indicator());
+  
+  for(uword col=0; col < P; ++col)
+    {
+    const eT* colmem = X.colptr(col);
+    
+    eT    acc = eT(0);
+    uword n   = 0;
+    
+    for(uword row=0; row < N; ++row)
+      {
+      const eT val = colmem[row];
+      
+      if(arma_isfinite(val))  { acc += val; ++n; }
+      }
+    
+    shift[col] = (n > 0) ? eT(acc / eT(n)) : eT(0);
+    }
+  
+  Mat<eT> NN(P, P, arma_zeros_indicator());  // number of pairwise-complete observations
+  Mat<eT> SS(P, P, arma_zeros_indicator());  // SS(i,j) = sum of z_i over observations where both i and j are finite
+  Mat<eT> ZZ(P, P, arma_zeros_indicator());  // sum of z_i * z_j
+  Mat<eT> QQ;                                // QQ(i,j) = sum of z_i^2 over observations where both i and j are finite
+  
+  if(do_cor)  { QQ.zeros(P,P); }
+  
+  const uword B = op_cov::block_n_obs(P);
+  
+  Mat<eT> Zb;
+  Mat<eT> Mb;
+  
+  for(uword row_start=0; row_start < N; row_start += B)
+    {
+    const uword row_end = (std::min)(row_start + B, N) - 1;
+    const uword n_blk   = row_end - row_start + 1;
+    
+    Zb.set_size(n_blk, P);
+    Mb.set_size(n_blk, P);
+    
+    for(uword col=0; col < P; ++col)
+      {
+      const eT* X_colmem = &(X.at(row_start, col));
+            eT* Z_colmem = Zb.colptr(col);
+            eT* M_colmem = Mb.colptr(col);
+      
+      const eT col_shift = shift[col];
+      
+      for(uword i=0; i < n_blk; ++i)
+        {
+        const eT val = X_colmem[i];
+        
+        const bool ok = arma_isfinite(val);
+        
+        Z_colmem[i] = (ok) ? eT(val - col_shift) : eT(0);
+        M_colmem[i] = (ok) ? eT(1)               : eT(0);
+        }
+      }
+    
+    NN += Mb.t() * Mb;
+    SS += Zb.t() * Mb;
+    ZZ += Zb.t() * Zb;
+    
+    if(do_cor)  { QQ += trans(square(Zb)) * Mb; }
+    }
+  
+  out.set_size(P,P);
+  
+  for(uword j=0; j < P; ++j)
+  for(uword i=0; i < P; ++i)
+    {
+    const eT n = NN.at(i,j);
+    
+    if(access::tmp_real(n) < 2)  { out.at(i,j) = Datum<eT>::nan; continue; }
+    
+    const eT s_i = SS.at(i,j);  // sum of z_i where both are finite
+    const eT s_j = SS.at(j,i);  // sum of z_j where both are finite
+    
+    const eT c_ij = ZZ.at(i,j) - (s_i * s_j) / n;
+    
+    if(do_cor)
+      {
+      const eT v_i = QQ.at(i,j) - (s_i * s_i) / n;
+      const eT v_j = QQ.at(j,i) - (s_j * s_j) / n;
+      
+      out.at(i,j) = c_ij / std::sqrt(v_i * v_j);
+      }
+    else
+      {
+      const eT norm_val = (norm_type == 0) ? eT(n - eT(1)) : n;
+      
+      out.at(i,j) = c_ij / norm_val;
+      }
+    }
+  }
+
+
+
+//! upper triangle of the covariance of the columns of X (including the diagonal), packed column by column;
+//! column j of the upper triangle is accumulated as a matrix-vector product of the first j+1 centred columns with centred column j,
+//! so only the packed output and one block of rows are held in memory
+template<typename eT>
+inline
+void
+op_cov::direct_cov_packed(Col<eT>& out, const Mat<eT>& X, const uword norm_type)
+  {
+  arma_debug_sigprint();
+  
+  const uword N = X.n_rows;
+  const uword P = X.n_cols;
+  
+  const eT norm_val = (norm_type == 0) ? ( (N > 1) ? eT(N-1) : eT(1) ) : eT(N);
+  
+  const Row<eT> mu = mean(X,0);
+  
+  const uword B = op_cov::block_n_obs(P);
+  
+  out.zeros( (P*(P+1))/2 );
+  
+  Mat<eT> blk;
+  
+  for(uword row_start=0; row_start < N; row_start += B)
+    {
+    const uword row_end = (std::min)(row_start + B, N) - 1;
+    const uword n_blk   = row_end - row_start + 1;
+    
+    blk = X.rows(row_start, row_end);
+    
+    blk.each_row() -= mu;
+    
+    eT* out_mem = out.memptr();
+    
+    for(uword col=0; col < P; ++col)
+      {
+      const Mat<eT> lead(blk.memptr(), n_blk, col+1, false, true);
+      const Col<eT> x_j (blk.colptr(col), n_blk, false, true);
+      
+      Col<eT> out_j(out_mem, col+1, false, true);
+      
+      out_j += lead.t() * x_j;
+      
+      out_mem += (col+1);
+      }
+    }
+  
+  out /= norm_val;
   }
 
 
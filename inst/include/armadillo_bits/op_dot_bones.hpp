@@ -64,6 +64,34 @@ struct op_dot
   template<typename eT>
   arma_hot inline static eT direct_dot(const uword n_elem, const eT* const A, const eT* const B, const eT* C);
   
+  //! the transpose of a vector does not change the order of its elements, so dot() can use the vector itself;
+  //! a conjugate transpose can only be bypassed for real elements
+  template<typename T1>
+  struct strip_vec_trans
+    {
+    static constexpr bool do_strip = false;
+    
+    arma_inline static const T1& get(const T1& X) { return X; }
+    };
+  
+  template<typename T1>
+  struct strip_vec_trans< Op<T1, op_htrans> >
+    {
+    static constexpr bool do_strip = (is_cx<typename T1::elem_type>::no) && (T1::is_row || T1::is_col);
+    
+    template<bool strip = do_strip> arma_inline static typename enable_if2< strip,                   const T1& >::result get(const Op<T1, op_htrans>& X) { return X.m; }
+    template<bool strip = do_strip> arma_inline static typename enable_if2<!strip, const Op<T1, op_htrans>& >::result get(const Op<T1, op_htrans>& X) { return X;   }
+    };
+  
+  template<typename T1>
+  struct strip_vec_trans< Op<T1, op_strans> >
+    {
+    static constexpr bool do_strip = (T1::is_row || T1::is_col);
+    
+    template<bool strip = do_strip> arma_inline static typename enable_if2< strip,                   const T1& >::result get(const Op<T1, op_strans>& X) { return X.m; }
+    template<bool strip = do_strip> arma_inline static typename enable_if2<!strip, const Op<T1, op_strans>& >::result get(const Op<T1, op_strans>& X) { return X;   }
+    };
+  
   template<typename T1, typename T2>
   arma_hot inline static typename T1::elem_type apply(const T1& X, const T2& Y);
   
@@ -72,6 +100,12 @@ struct op_dot
   
   template<typename T1, typename T2>
   arma_hot inline static typename arma_cx_only<typename T1::elem_type>::result apply_proxy_linear(const Proxy<T1>& PA, const Proxy<T2>& PB);
+  
+  template<typename T1, typename T2>
+  arma_hot inline static typename T1::elem_type apply_proxy_range(const Proxy<T1>& PA, const Proxy<T2>& PB, const uword start, const uword end);
+  
+  template<typename T1, typename T2>
+  arma_hot inline static typename T1::elem_type apply_proxy_mp(const Proxy<T1>& PA, const Proxy<T2>& PB);
   };
 
 
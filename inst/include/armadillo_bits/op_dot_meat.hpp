@@ -272,6 +272,13 @@ op_dot::apply(const T1& X, const T2& Y)
   
   typedef typename T1::elem_type eT;
   
+  if(op_dot::strip_vec_trans<T1>::do_strip || op_dot::strip_vec_trans<T2>::do_strip)
+    {
+    arma_debug_print("op_dot::apply(): bypassing transpose of vector");
+    
+    return op_dot::apply( op_dot::strip_vec_trans<T1>::get(X), op_dot::strip_vec_trans<T2>::get(Y) );
+    }
+  
   if(is_subview_row<T1>::value && is_subview_row<T2>::value)
     {
     const subview_row<eT>& A = reinterpret_cast< const subview_row<eT>& >(X);
@@ -348,9 +355,11 @@ op_dot::apply(const T1& X, const T2& Y)
   
   constexpr bool use_at = (Proxy<T1>::use_at) || (Proxy<T2>::use_at);
   
+  constexpr bool use_mp = (arma_config::openmp) && ((Proxy<T1>::use_mp) || (Proxy<T2>::use_mp));
+  
   constexpr bool have_direct_mem = (quasi_unwrap<T1>::has_orig_mem) && (quasi_unwrap<T2>::has_orig_mem);
   
-  if(proxy_is_mat || use_at || have_direct_mem)
+  if(proxy_is_mat || have_direct_mem)
     {
     arma_debug_print("op_dot::apply(): direct_mem optimisation");
     
@@ -367,6 +376,17 @@ op_dot::apply(const T1& X, const T2& Y)
   
   arma_conform_check( (PA.get_n_elem() != PB.get_n_elem()), "dot(): objects must have the same number of elements" );
   
+  if(use_at)
+    {
+    // elements are visited in column-major order via at(), tracking the layout of each object separately
+    
+    if(use_mp && mp_gate<eT>::eval(PA.get_n_elem()))  { return op_dot::apply_proxy_mp(PA,PB); }
+    
+    return op_dot::apply_proxy_range(PA, PB, uword(0), PA.get_n_elem());
+    }
+  
+  if(use_mp && mp_gate<eT>::eval(PA.get_n_elem()))  { return op_dot::apply_proxy_mp(PA,PB); }
+  
   return op_dot::apply_proxy_linear(PA,PB);
   }
 
@@ -451,6 +471,128 @@ op_dot::apply_proxy_linear(const Proxy<T1>& PA, const Proxy<T2>& PB)
 
 
 
+//! dot product of elements in the linear range [start, end), in column-major order
+template<typename T1, typename T2>
+inline
+typename T1::elem_type
+op_dot::apply_proxy_range(const Proxy<T1>& PA, const Proxy<T2>& PB, const uword start, const uword end)
+  {
+  typedef typename T1::elem_type eT;
+  
+  eT val1 = eT(0);
+  eT val2 = eT(0);
+  
+  if( (Proxy<T1>::use_at == false) && (Proxy<T2>::use_at == false) )
+    {
+    typename Proxy<T1>::ea_type A = PA.get_ea();
+    typename Proxy<T2>::ea_type B = PB.get_ea();
+    
+    uword i,j;
+    for(i=start, j=start+1; j < end; i+=2, j+=2)
+      {
+      val1 += (A[i] * B[i]);
+      val2 += (A[j] * B[j]);
+      }
+    
+    if(i < end)  { val1 += (A[i] * B[i]); }
+    }
+  else
+  if( (PA.get_n_rows() == PB.get_n_rows()) && (PA.get_n_cols() == PB.get_n_cols()) )
+    {
+    const uword n_rows = PA.get_n_rows();
+    
+    uword row = start % n_rows;
+    uword col = start / n_rows;
+    
+    for(uword i=start; i < end; ++i)
+      {
+      val1 += (PA.at(row,col) * PB.at(row,col));
+      
+      ++row;
+      
+      if(row == n_rows)  { row = 0; ++col; }
+      }
+    }
+  else
+    {
+    const uword A_n_rows = PA.get_n_rows();
+    const uword B_n_rows = PB.get_n_rows();
+    
+    uword A_row = start % A_n_rows;
+    uword A_col = start / A_n_rows;
+    
+    uword B_row = start % B_n_rows;
+    uword B_col = start / B_n_rows;
+    
+    for(uword i=start; i < end; ++i)
+      {
+      val1 += (PA.at(A_row,A_col) * PB.at(B_row,B_col));
+      
+      ++A_row;  if(A_row == A_n_rows)  { A_row = 0; ++A_col; }
+      ++B_row;  if(B_row == B_n_rows)  { B_row = 0; ++B_col; }
+      }
+    }
+  
+  return (val1 + val2);
+  }
+
+
+
+//! as per op_accu_mat::apply_proxy_mp(), the result does not depend on the number of threads
+template<typename T1, typename T2>
+inline
+typename T1::elem_type
+op_dot::apply_proxy_mp(const Proxy<T1>& PA, const Proxy<T2>& PB)
+  {
+  arma_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  
+  const uword N = PA.get_n_elem();
+  
+  if(N == 0)  { return eT(0); }
+  
+  const uword max_n_chunks = 256;
+  
+  const uword n_chunks   = (std::min)(max_n_chunks, (N + 1023) / 1024);
+  const uword chunk_size = (N + n_chunks - 1) / n_chunks;
+  
+  eT partial[max_n_chunks];
+  
+  #if defined(ARMA_USE_OPENMP)
+    {
+    const int n_threads = mp_thread_limit::get();
+    
+    #pragma omp parallel for schedule(static) num_threads(n_threads)
+    for(uword c=0; c < n_chunks; ++c)
+      {
+      const uword chunk_start = c*chunk_size;
+      const uword chunk_end   = (std::min)(chunk_start + chunk_size, N);
+      
+      partial[c] = (chunk_start < chunk_end) ? op_dot::apply_proxy_range(PA, PB, chunk_start, chunk_end) : eT(0);
+      }
+    }
+  #else
+    {
+    for(uword c=0; c < n_chunks; ++c)
+      {
+      const uword chunk_start = c*chunk_size;
+      const uword chunk_end   = (std::min)(chunk_start + chunk_size, N);
+      
+      partial[c] = (chunk_start < chunk_end) ? op_dot::apply_proxy_range(PA, PB, chunk_start, chunk_end) : eT(0);
+      }
+    }
+  #endif
+  
+  eT val = eT(0);
+  
+  for(uword c=0; c < n_chunks; ++c)  { val += partial[c]; }
+  
+  return val;
+  }
+
+
+
 //
 // op_norm_dot
 
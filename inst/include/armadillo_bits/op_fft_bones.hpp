@@ -39,6 +39,9 @@ struct op_fft_cx
   
   template<typename eT, bool inverse>
   inline static void apply_noalias(Mat<eT>& out, const Mat<eT>& X, const uword a, const uword b);
+  
+  template<typename eT, typename functor>
+  inline static void run_vecs(const uword n_vecs, const uword buffer_len, const functor& process);
   };
 
 
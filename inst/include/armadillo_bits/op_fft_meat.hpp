@@ -93,60 +93,89 @@ op_fft_real::apply( Mat< std::complex<typename T1::pod_type> >& out, const mtOp<
   const uword N_orig = (is_vec)              ? n_elem         : n_rows;
   const uword N_user = (in.aux_uword_b == 0) ? in.aux_uword_a : N_orig;
   
-  #if defined(ARMA_USE_FFTW3)
-    const uword N_exec = (is_vec) ? uword(1) : n_cols;
-    fft_engine_wrapper<out_eT,false> worker(N_user, N_exec);
-  #else
-    fft_engine_kissfft<out_eT,false> worker(N_user);
-  #endif
+  // a vector is processed as one column; for a matrix, each column is processed separately
+  
+  const uword n_vecs = (is_vec) ? uword(1) : n_cols;
   
   if(is_vec)
     {
     (n_cols == 1) ? out.set_size(N_user, 1) : out.set_size(1, N_user);
-    
-    if( (out.n_elem == 0) || (N_orig == 0) )  { out.zeros(); return; }
-    
-    if( (N_user == 1) && (N_orig >= 1) )  { out[0] = out_eT( X[0] ); return; }
-    
-    podarray<out_eT> data(N_user, arma_zeros_indicator());
-    
-          out_eT* data_mem = data.memptr();
-    const  in_eT*    X_mem =    X.memptr();
-    
-    const uword N = (std::min)(N_user, N_orig);
-    
-    for(uword i=0; i < N; ++i)  { data_mem[i].real(X_mem[i]); }
-    
-    worker.run( out.memptr(), data_mem );
     }
   else
     {
-    // process each column separately
-    
     out.set_size(N_user, n_cols);
+    }
+  
+  if( (out.n_elem == 0) || (N_orig == 0) )  { out.zeros(); return; }
+  
+  const in_eT* X_mem = X.memptr();
+  
+  if(N_user == 1)
+    {
+    for(uword v=0; v < n_vecs; ++v)  { out[v] = out_eT( X_mem[v*N_orig] ); }
     
-    if( (out.n_elem == 0) || (N_orig == 0) )  { out.zeros(); return; }
-    
-    if( (N_user == 1) && (N_orig >= 1) )
-      {
-      for(uword col=0; col < n_cols; ++col)  { out.at(0,col).real( X.at(0,col) ); }
-      
-      return;
-      }
+    return;
+    }
+  
+  const uword N = (std::min)(N_user, N_orig);
+  
+  #if defined(ARMA_USE_FFTW3)
+    {
+    fft_engine_wrapper<out_eT,false> worker(N_user, n_vecs);
     
     podarray<out_eT> data(N_user, arma_zeros_indicator());
     
     out_eT* data_mem = data.memptr();
     
-    const uword N = (std::min)(N_user, N_orig);
-    
-    for(uword col=0; col < n_cols; ++col)
+    for(uword v=0; v < n_vecs; ++v)
       {
-      for(uword i=0; i < N; ++i)  { data_mem[i].real( X.at(i, col) ); }
+      const in_eT* X_vec = X_mem + v*N_orig;
+      
+      for(uword i=0; i < N; ++i)  { data_mem[i].real( X_vec[i] ); }
       
-      worker.run( out.colptr(col), data_mem );
+      worker.run( out.memptr() + v*N_user, data_mem );
       }
     }
+  #else
+    {
+    if((N_user % 2) == 0)
+      {
+      // real-to-complex transform via a complex transform of half the length
+      
+      const std::shared_ptr< const fft_engine_kissfft_real<out_eT> > worker_ptr = fft_engine_cache< fft_engine_kissfft_real<out_eT> >::get(N_user);
+      
+      const fft_engine_kissfft_real<out_eT>& worker = (*worker_ptr);
+      
+      const auto process = [&](const uword v, in_eT* data_mem)
+        {
+        const in_eT* X_vec = X_mem + v*N_orig;
+        
+        if(N_orig < N_user)  { arrayops::copy(data_mem, X_vec, N); X_vec = data_mem; }
+        
+        worker.run( out.memptr() + v*N_user, X_vec );
+        };
+      
+      op_fft_cx::run_vecs<in_eT>(n_vecs, ((N_orig < N_user) ? N_user : uword(0)), process);
+      }
+    else
+      {
+      const std::shared_ptr< const fft_engine_kissfft<out_eT,false> > worker_ptr = fft_engine_cache< fft_engine_kissfft<out_eT,false> >::get(N_user);
+      
+      const fft_engine_kissfft<out_eT,false>& worker = (*worker_ptr);
+      
+      const auto process = [&](const uword v, out_eT* data_mem)
+        {
+        const in_eT* X_vec = X_mem + v*N_orig;
+        
+        for(uword i=0; i < N; ++i)  { data_mem[i].real( X_vec[i] ); }
+        
+        worker.run( out.memptr() + v*N_user, data_mem );
+        };
+      
+      op_fft_cx::run_vecs<out_eT>(n_vecs, N_user, process);
+      }
+    }
+  #endif
   }
 
 
@@ -189,6 +218,8 @@ op_fft_cx::apply_noalias(Mat<eT>& out, const Mat<eT>& X, const uword a, const uw
   {
   arma_debug_sigprint();
   
+  typedef typename get_pod_type<eT>::result T;
+  
   const uword n_rows = X.n_rows;
   const uword n_cols = X.n_cols;
   const uword n_elem = X.n_elem;
@@ -198,93 +229,123 @@ op_fft_cx::apply_noalias(Mat<eT>& out, const Mat<eT>& X, const uword a, const uw
   const uword N_orig = (is_vec) ? n_elem : n_rows;
   const uword N_user = (b == 0) ? a      : N_orig;
   
-  #if defined(ARMA_USE_FFTW3)
-    const uword N_exec = (is_vec) ? uword(1) : n_cols;
-    fft_engine_wrapper<eT,inverse> worker(N_user, N_exec);
-  #else
-    fft_engine_kissfft<eT,inverse> worker(N_user);
-  #endif
+  // a vector is processed as one column; for a matrix, each column is processed separately
+  
+  const uword n_vecs = (is_vec) ? uword(1) : n_cols;
   
   if(is_vec)
     {
     (n_cols == 1) ? out.set_size(N_user, 1) : out.set_size(1, N_user);
+    }
+  else
+    {
+    out.set_size(N_user, n_cols);
+    }
+  
+  if( (out.n_elem == 0) || (N_orig == 0) )  { out.zeros(); return; }
+  
+  const eT* X_mem = X.memptr();
+  
+  if(N_user == 1)
+    {
+    for(uword v=0; v < n_vecs; ++v)  { out[v] = X_mem[v*N_orig]; }
+    
+    return;
+    }
+  
+  const uword N = (std::min)(N_user, N_orig);
+  
+  // correct the scaling for the inverse transform
+  const eT k = eT( T(1) / T(N_user) );
+  
+  #if defined(ARMA_USE_FFTW3)
+    {
+    fft_engine_wrapper<eT,inverse> worker(N_user, n_vecs);
     
-    if( (out.n_elem == 0) || (N_orig == 0) )  { out.zeros(); return; }
+    podarray<eT> data(N_user, arma_zeros_indicator());
     
-    if( (N_user == 1) && (N_orig >= 1) )  { out[0] = X[0]; return; }
+    eT* data_mem = data.memptr();
     
-    if(N_user > N_orig)
+    for(uword v=0; v < n_vecs; ++v)
       {
-      podarray<eT> data(N_user);
+      const eT* X_vec = X_mem + v*N_orig;
       
-      eT* data_mem = data.memptr();
+      if(N_orig < N_user)  { arrayops::copy(data_mem, X_vec, N); X_vec = data_mem; }
       
-      arrayops::fill_zeros( &data_mem[N_orig], (N_user - N_orig) );
+      eT* out_vec = out.memptr() + v*N_user;
       
-      arrayops::copy(data_mem, X.memptr(), (std::min)(N_user, N_orig));
+      worker.run( out_vec, X_vec );
       
-      worker.run( out.memptr(), data_mem );
-      }
-    else
-      {
-      worker.run( out.memptr(), X.memptr() );
+      if(inverse)  { arrayops::inplace_mul(out_vec, k, N_user); }
       }
     }
-  else
+  #else
     {
-    // process each column separately
-    
-    out.set_size(N_user, n_cols);
+    const std::shared_ptr< const fft_engine_kissfft<eT,inverse> > worker_ptr = fft_engine_cache< fft_engine_kissfft<eT,inverse> >::get(N_user);
     
-    if( (out.n_elem == 0) || (N_orig == 0) )  { out.zeros(); return; }
+    const fft_engine_kissfft<eT,inverse>& worker = (*worker_ptr);
     
-    if( (N_user == 1) && (N_orig >= 1) )
+    const auto process = [&](const uword v, eT* data_mem)
       {
-      for(uword col=0; col < n_cols; ++col)  { out.at(0,col) = X.at(0,col); }
+      const eT* X_vec = X_mem + v*N_orig;
       
-      return;
-      }
+      if(N_orig < N_user)  { arrayops::copy(data_mem, X_vec, N); X_vec = data_mem; }
+      
+      eT* out_vec = out.memptr() + v*N_user;
+      
+      worker.run( out_vec, X_vec );
+      
+      if(inverse)  { arrayops::inplace_mul(out_vec, k, N_user); }
+      };
+    
+    op_fft_cx::run_vecs<eT>(n_vecs, ((N_orig < N_user) ? N_user : uword(0)), process);
+    }
+  #endif
+  }
+
+
+
+//! Apply process(v, buffer) to each of n_vecs vectors, where buffer holds buffer_len zero-initialised elements private to the calling thread.
+//! The vectors are processed in parallel if OpenMP is enabled and the amount of work is large enough.
+template<typename eT, typename functor>
+inline
+void
+op_fft_cx::run_vecs(const uword n_vecs, const uword buffer_len, const functor& process)
+  {
+  arma_debug_sigprint();
+  
+  #if defined(ARMA_USE_OPENMP)
+    {
+    const uword n_work = n_vecs * (std::max)(buffer_len, uword(64));
     
-    if(N_user > N_orig)
+    if( (n_vecs >= 2) && (n_work >= uword(4096)) && mp_gate<eT,true>::eval(n_work) )
       {
-      podarray<eT> data(N_user);
+      arma_debug_print("openmp implementation");
       
-      eT* data_mem = data.memptr();
+      const uword n_threads = uword(mp_thread_limit::get());
       
-      arrayops::fill_zeros( &data_mem[N_orig], (N_user - N_orig) );
+      podarray<eT> buffer(buffer_len * n_threads, arma_zeros_indicator());
       
-      const uword N = (std::min)(N_user, N_orig);
+      eT* buffer_mem = buffer.memptr();
       
-      for(uword col=0; col < n_cols; ++col)
+      #pragma omp parallel for schedule(static) num_threads(int(n_threads))
+      for(uword v=0; v < n_vecs; ++v)
         {
-        arrayops::copy(data_mem, X.colptr(col), N);
+        const uword thread_id = uword(omp_get_thread_num());
         
-        worker.run( out.colptr(col), data_mem );
-        }
-      }
-    else
-      {
-      for(uword col=0; col < n_cols; ++col)
-        {
-        worker.run( out.colptr(col), X.colptr(col) );
+        process(v, buffer_mem + buffer_len*thread_id);
         }
+      
+      return;
       }
     }
-    
+  #endif
   
-  // correct the scaling for the inverse transform
-  if(inverse)
-    {
-    typedef typename get_pod_type<eT>::result T;
-    
-    const T k = T(1) / T(N_user);
-    
-    eT* out_mem = out.memptr();
-    
-    const uword out_n_elem = out.n_elem;
-    
-    for(uword i=0; i < out_n_elem; ++i)  { out_mem[i] *= k; }
-    }
+  podarray<eT> buffer(buffer_len, arma_zeros_indicator());
+  
+  eT* buffer_mem = buffer.memptr();
+  
+  for(uword v=0; v < n_vecs; ++v)  { process(v, buffer_mem); }
   }
 
 
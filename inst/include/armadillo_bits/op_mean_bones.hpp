@@ -38,6 +38,9 @@ struct op_mean
   template<typename eT>
   inline static void apply_noalias_promote(Mat<eT>& out, const Mat<eT>& X, const uword dim);
   
+  template<typename T1>
+  inline static void apply_proxy_noalias(Mat<typename T1::elem_type>& out, const Proxy<T1>& P, const uword dim);
+  
   // cubes
   
   template<typename T1>
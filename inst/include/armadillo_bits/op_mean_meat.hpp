@@ -34,6 +34,28 @@ op_mean::apply(Mat<typename T1::elem_type>& out, const Op<T1,op_mean>& in)
   
   arma_conform_check( (dim > 1), "mean(): parameter 'dim' must be 0 or 1" );
   
+  if( (quasi_unwrap<T1>::has_orig_mem == false) && (is_Mat<typename Proxy<T1>::stored_type>::value == false) && (is_fp16<eT>::no) && (is_cx_fp16<eT>::no) )
+    {
+    arma_debug_print("op_mean::apply(): using proxy");
+    
+    const Proxy<T1> P(in.m);
+    
+    if(P.is_alias(out))
+      {
+      Mat<eT> tmp;
+      
+      op_mean::apply_proxy_noalias(tmp, P, dim);
+      
+      out.steal_mem(tmp);
+      }
+    else
+      {
+      op_mean::apply_proxy_noalias(out, P, dim);
+      }
+    
+    return;
+    }
+  
   const quasi_unwrap<T1> U(in.m);
   
   if(U.is_alias(out))
@@ -63,6 +85,17 @@ op_mean::apply(Mat_noalias<typename T1::elem_type>& out, const Op<T1,op_mean>& i
   
   arma_conform_check( (dim > 1), "mean(): parameter 'dim' must be 0 or 1" );
   
+  typedef typename T1::elem_type eT;
+  
+  if( (quasi_unwrap<T1>::has_orig_mem == false) && (is_Mat<typename Proxy<T1>::stored_type>::value == false) && (is_fp16<eT>::no) && (is_cx_fp16<eT>::no) )
+    {
+    const Proxy<T1> P(in.m);
+    
+    op_mean::apply_proxy_noalias(out, P, dim);
+    
+    return;
+    }
+  
   const quasi_unwrap<T1> U(in.m);
   
   op_mean::apply_noalias(out, U.M, dim);
@@ -179,6 +212,69 @@ op_mean::apply_noalias_promote(Mat<eT>& out, const Mat<eT>& X, const uword dim)
 
 
 
+//! the expression is evaluated element-by-element within the reduction, without a temporary matrix
+template<typename T1>
+inline
+void
+op_mean::apply_proxy_noalias(Mat<typename T1::elem_type>& out, const Proxy<T1>& P, const uword dim)
+  {
+  arma_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  typedef typename T1::pod_type   T;
+  
+  const uword P_n_rows = P.get_n_rows();
+  const uword P_n_cols = P.get_n_cols();
+  
+  if(dim == 0)
+    {
+    if(P_n_rows == 0)  { out.set_size(0, P_n_cols); return; }
+    
+    op_sum::apply_proxy_noalias(out, P, dim);
+    
+    out /= T(P_n_rows);
+    }
+  else
+  if(dim == 1)
+    {
+    if(P_n_cols == 0)  { out.set_size(P_n_rows, 0); return; }
+    
+    op_sum::apply_proxy_noalias(out, P, dim);
+    
+    out /= T(P_n_cols);
+    }
+  
+  if(out.internal_has_nonfinite() == false)  { return; }
+  
+  // handle possible overflow; see also op_mean::direct_mean_robust()
+  
+  eT* out_mem = out.memptr();
+  
+  const uword n_lanes = (dim == 0) ? P_n_cols : P_n_rows;
+  const uword N       = (dim == 0) ? P_n_rows : P_n_cols;
+  
+  for(uword lane=0; lane < n_lanes; ++lane)
+    {
+    if(arma_isfinite(out_mem[lane]))  { continue; }
+    
+    eT   r_mean     = eT(0);
+    bool all_finite = true;
+    
+    for(uword i=0; i < N; ++i)
+      {
+      const eT val = (dim == 0) ? P.at(i,lane) : P.at(lane,i);
+      
+      if(arma_isnonfinite(val))  { all_finite = false; break; }
+      
+      r_mean = r_mean + (val - r_mean) / T(i+1);
+      }
+    
+    if(all_finite)  { out_mem[lane] = r_mean; }
+    }
+  }
+
+
+
 //
 
 
@@ -439,7 +535,7 @@ op_mean::mean_all(const T1& X)
   
   eT result = eT(0);
   
-  if( (is_Mat<typename Proxy<T1>::stored_type>::value == false) && (Proxy<T1>::use_at == false) && (Proxy<T1>::use_mp == false) && (is_fp16<T>::no) )
+  if( (is_Mat<typename Proxy<T1>::stored_type>::value == false) && (quasi_unwrap<T1>::has_orig_mem == false) && (is_fp16<T>::no) )
     {
     arma_debug_print("op_mean::mean_all(): using proxy");
     
@@ -487,25 +583,7 @@ op_mean::mean_all_proxy(const Proxy<T1>& P)
   
   const uword N = P.get_n_elem();
   
-  const typename Proxy<T1>::ea_type Pea = P.get_ea();
-  
-  eT acc1 = eT(0);
-  eT acc2 = eT(0);
-  
-  uword i,j;
-  
-  for(i=0, j=1; j < N; i+=2, j+=2)
-    {
-    acc1 += Pea[i];
-    acc2 += Pea[j];
-    }
-  
-  if(i < N)
-    {
-    acc1 += Pea[i];
-    }
-  
-  const eT mean = (acc1 + acc2) / T(N);
+  const eT mean = op_accu_mat::apply_proxy(P) / T(N);
   
   if(arma_isfinite(mean))  { return mean; }
   
@@ -513,13 +591,37 @@ op_mean::mean_all_proxy(const Proxy<T1>& P)
   
   eT r_mean = eT(0);
   
-  for(uword ii=0; ii < N; ++ii)
+  if(Proxy<T1>::use_at == false)
+    {
+    const typename Proxy<T1>::ea_type Pea = P.get_ea();
+    
+    for(uword ii=0; ii < N; ++ii)
+      {
+      const eT val = Pea[ii];
+      
+      if(arma_isnonfinite(val))  { return mean; }
+      
+      r_mean = r_mean + (val - r_mean) / T(ii+1);
+      }
+    }
+  else
     {
-    const eT val = Pea[ii];
+    const uword n_rows = P.get_n_rows();
+    const uword n_cols = P.get_n_cols();
     
-    if(arma_isnonfinite(val))  { return mean; }
+    uword ii = 0;
     
-    r_mean = r_mean + (val - r_mean) / T(ii+1);
+    for(uword col=0; col < n_cols; ++col)
+    for(uword row=0; row < n_rows; ++row)
+      {
+      const eT val = P.at(row,col);
+      
+      if(arma_isnonfinite(val))  { return mean; }
+      
+      r_mean = r_mean + (val - r_mean) / T(ii+1);
+      
+      ++ii;
+      }
     }
   
   return r_mean;
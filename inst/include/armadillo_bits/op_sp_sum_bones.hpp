@@ -28,6 +28,12 @@ struct op_sp_sum
   
   template<typename eT, typename T1>
   inline static void apply(Mat<eT>& out, const mtSpReduceOp<eT, SpOp<T1, spop_square>, op_sp_sum>& in);
+  
+  template<typename eT, typename out_eT, typename functor>
+  inline static void reduce_cols(out_eT* out_mem, const uword n_cols, const uword* col_ptrs, const eT* values, const functor& f);
+  
+  template<typename eT, typename out_eT, typename functor>
+  inline static void reduce_rows(out_eT* out_mem, const uword n_rows, const uword n_cols, const uword* col_ptrs, const uword* row_indices, const eT* values, const functor& f);
   };
 
 
@@ -58,26 +58,24 @@ op_sp_sum::apply(Mat<eT>& out, const mtSpReduceOp<eT, T1, op_sp_sum>& in)
       }
     else
       {
-      const    eT* values  = p.get_values();
-      const uword* colptrs = p.get_col_ptrs();
-      
-      for(uword col = 0; col < p_n_cols; ++col)
-        {
-        const eT*   coldata = &(values[ colptrs[col] ]);
-        const uword N       = colptrs[col + 1] - colptrs[col];
-        
-        out_mem[col] = arrayops::accumulate(coldata, N);
-        }
+      op_sp_sum::reduce_cols(out_mem, p_n_cols, p.get_col_ptrs(), p.get_values(), [](const eT* coldata, const uword N) { return arrayops::accumulate(coldata, N); });
       }
     }
   else
   if(dim == 1)  // find the sum in each row
     {
-    typename SpProxy<T1>::const_iterator_type it = p.begin();
-    
-    const uword N = p.get_n_nonzero();
-    
-    for(uword i=0; i < N; ++i)  { out_mem[it.row()] += (*it); ++it; }
+    if(SpProxy<T1>::use_iterator)
+      {
+      typename SpProxy<T1>::const_iterator_type it = p.begin();
+      
+      const uword N = p.get_n_nonzero();
+      
+      for(uword i=0; i < N; ++i)  { out_mem[it.row()] += (*it); ++it; }
+      }
+    else
+      {
+      op_sp_sum::reduce_rows(out_mem, p_n_rows, p_n_cols, p.get_col_ptrs(), p.get_row_indices(), p.get_values(), [](const eT val, const uword) { return val; });
+      }
     }
   }
 
@@ -120,26 +118,132 @@ op_sp_sum::apply(Mat<eT>& out, const mtSpReduceOp<eT, SpOp<T1, spop_square>, op_
       }
     else
       {
-      const    eT* values  = p.get_values();
-      const uword* colptrs = p.get_col_ptrs();
+      op_sp_sum::reduce_cols(out_mem, p_n_cols, p.get_col_ptrs(), p.get_values(), [](const eT* coldata, const uword N) { return op_dot::direct_dot(N, coldata, coldata); });
+      }
+    }
+  else
+  if(dim == 1)  // find the sum of squares in each row
+    {
+    if(SpProxy<T1>::use_iterator)
+      {
+      typename SpProxy<T1>::const_iterator_type it = p.begin();
+      
+      const uword N = p.get_n_nonzero();
+      
+      for(uword i=0; i < N; ++i)  { const eT val = (*it); out_mem[it.row()] += (val*val); ++it; }
+      }
+    else
+      {
+      op_sp_sum::reduce_rows(out_mem, p_n_rows, p_n_cols, p.get_col_ptrs(), p.get_row_indices(), p.get_values(), [](const eT val, const uword) { return val*val; });
+      }
+    }
+  }
+
+
+
+//! out_mem[col] = f(pointer to the values in column col, number of values in column col);
+//! the columns are independent, so they are processed in parallel when OpenMP is enabled
+template<typename eT, typename out_eT, typename functor>
+inline
+void
+op_sp_sum::reduce_cols(out_eT* out_mem, const uword n_cols, const uword* col_ptrs, const eT* values, const functor& f)
+  {
+  arma_debug_sigprint();
+  
+  if( (arma_config::openmp) && (mp_thread_limit::in_parallel() == false) && (n_cols >= 2) && mp_gate<eT>::eval(col_ptrs[n_cols]) )
+    {
+    #if defined(ARMA_USE_OPENMP)
+      {
+      arma_debug_print("openmp implementation");
+      
+      const int n_threads = mp_thread_limit::get();
+      
+      #pragma omp parallel for schedule(static) num_threads(n_threads)
+      for(uword col=0; col < n_cols; ++col)
+        {
+        out_mem[col] = f( &(values[ col_ptrs[col] ]), (col_ptrs[col+1] - col_ptrs[col]) );
+        }
+      }
+    #endif
+    }
+  else
+    {
+    for(uword col=0; col < n_cols; ++col)
+      {
+      out_mem[col] = f( &(values[ col_ptrs[col] ]), (col_ptrs[col+1] - col_ptrs[col]) );
+      }
+    }
+  }
+
+
+
+//! out_mem[row] = sum of f(value, col) over the values in row row, where col is the column of each value;
+//! with OpenMP, each thread accumulates a range of columns with a similar number of non-zeros into its own buffer,
+//! and the buffers are summed afterwards; this is only worthwhile when there are enough non-zeros per row
+template<typename eT, typename out_eT, typename functor>
+inline
+void
+op_sp_sum::reduce_rows(out_eT* out_mem, const uword n_rows, const uword n_cols, const uword* col_ptrs, const uword* row_indices, const eT* values, const functor& f)
+  {
+  arma_debug_sigprint();
+  
+  const uword nnz = col_ptrs[n_cols];
+  
+  if( (arma_config::openmp) && (mp_thread_limit::in_parallel() == false) && (n_cols >= 2) && (nnz >= (uword(2) * n_rows)) && mp_gate<eT>::eval(nnz) )
+    {
+    #if defined(ARMA_USE_OPENMP)
+      {
+      arma_debug_print("openmp implementation");
       
-      for(uword col = 0; col < p_n_cols; ++col)
+      const int   n_threads   = mp_thread_limit::get();
+      const uword n_threads_u = uword(n_threads);
+      
+      podarray<uword> col_start(n_threads_u + 1);
+      
+      for(uword t=0; t < n_threads_u; ++t)
         {
-        const eT*   coldata = &(values[ colptrs[col] ]);
-        const uword N       = colptrs[col + 1] - colptrs[col];
+        const uword target = uword( (double(nnz) * double(t)) / double(n_threads_u) );
         
-        out_mem[col] = op_dot::direct_dot(N, coldata, coldata);
+        col_start[t] = uword( std::lower_bound(col_ptrs, col_ptrs + n_cols, target) - col_ptrs );
+        }
+      
+      col_start[n_threads_u] = n_cols;
+      
+      Mat<out_eT> partial(n_rows, n_threads_u, arma_nozeros_indicator());
+      
+      #pragma omp parallel for schedule(static) num_threads(n_threads)
+      for(uword t=0; t < n_threads_u; ++t)
+        {
+        out_eT* acc = partial.colptr(t);
+        
+        arrayops::fill_zeros(acc, n_rows);
+        
+        for(uword col = col_start[t]; col < col_start[t+1]; ++col)
+          {
+          for(uword k = col_ptrs[col]; k < col_ptrs[col+1]; ++k)  { acc[ row_indices[k] ] += f(values[k], col); }
+          }
+        }
+      
+      #pragma omp parallel for schedule(static) num_threads(n_threads)
+      for(uword row=0; row < n_rows; ++row)
+        {
+        out_eT acc = out_eT(0);
+        
+        for(uword t=0; t < n_threads_u; ++t)  { acc += partial.at(row,t); }
+        
+        out_mem[row] = acc;
         }
       }
+    #endif
     }
   else
-  if(dim == 1)  // find the sum of squares in each row
     {
-    typename SpProxy<T1>::const_iterator_type it = p.begin();
-    
-    const uword N = p.get_n_nonzero();
+    arrayops::fill_zeros(out_mem, n_rows);
     
-    for(uword i=0; i < N; ++i)  { const eT val = (*it); out_mem[it.row()] += (val*val); ++it; }
+    for(uword col=0; col < n_cols; ++col)
+      {
+      for(uword k = col_ptrs[col]; k < col_ptrs[col+1]; ++k)  { out_mem[ row_indices[k] ] += f(values[k], col); }
+      }
     }
   }
 
@@ -77,6 +77,14 @@ op_sp_var::apply_slow
     
     out.zeros(1, p_n_cols);
     
+    if(SpProxy<T1>::use_iterator == false)
+      {
+      // We can use direct memory access to calculate the variance.
+      op_sp_sum::reduce_cols(out.memptr(), p_n_cols, p.get_col_ptrs(), p.get_values(), [p_n_rows, norm_type](const in_eT* coldata, const uword len) { return op_sp_var::direct_var(coldata, len, p_n_rows, norm_type); });
+      
+      return;
+      }
+    
     for(uword col = 0; col < p_n_cols; ++col)
       {
       if(SpProxy<T1>::use_iterator)
@@ -110,6 +118,16 @@ op_sp_var::apply_slow
     
     out.zeros(p_n_rows, 1);
     
+    if(SpProxy<T1>::use_iterator == false)
+      {
+      // the rows of the matrix are the columns of its transpose, which can be accessed directly
+      const SpMat<in_eT> Xt = strans(p.Q);
+      
+      op_sp_sum::reduce_cols(out.memptr(), p_n_rows, Xt.col_ptrs, Xt.values, [p_n_cols, norm_type](const in_eT* rowdata, const uword len) { return op_sp_var::direct_var(rowdata, len, p_n_cols, norm_type); });
+      
+      return;
+      }
+    
     for(uword row = 0; row < p_n_rows; ++row)
       {
       // We have to use an iterator here regardless of whether or not we can
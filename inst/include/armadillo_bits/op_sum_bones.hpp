@@ -58,6 +58,9 @@ struct op_sum
   template<typename T1>
   inline static void apply_proxy_noalias(Mat<typename T1::elem_type>& out, const Proxy<T1>& P, const uword dim);
   
+  template<typename T1>
+  inline static void apply_proxy_noalias_mp(Mat<typename T1::elem_type>& out, const Proxy<T1>& P, const uword dim);
+  
   
   // cubes
   
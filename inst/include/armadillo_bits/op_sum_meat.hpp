@@ -120,7 +120,7 @@ op_sum::apply_generic(Mat<typename T1::elem_type>& out, const Op<T1,op_sum>& in)
   
   arma_conform_check( (dim > 1), "sum(): parameter 'dim' must be 0 or 1" );
   
-  if((quasi_unwrap<T1>::has_orig_mem) || (is_Mat<typename Proxy<T1>::stored_type>::value) || (arma_config::openmp && Proxy<T1>::use_mp))
+  if((quasi_unwrap<T1>::has_orig_mem) || (is_Mat<typename Proxy<T1>::stored_type>::value))
     {
     const quasi_unwrap<T1> U(in.m);
     
@@ -242,7 +242,7 @@ op_sum::apply_generic(Mat_noalias<typename T1::elem_type>& out, const Op<T1,op_s
   
   arma_conform_check( (dim > 1), "sum(): parameter 'dim' must be 0 or 1" );
   
-  if((quasi_unwrap<T1>::has_orig_mem) || (is_Mat<typename Proxy<T1>::stored_type>::value) || (arma_config::openmp && Proxy<T1>::use_mp))
+  if((quasi_unwrap<T1>::has_orig_mem) || (is_Mat<typename Proxy<T1>::stored_type>::value))
     {
     const quasi_unwrap<T1> U(in.m);
     
@@ -369,6 +369,13 @@ op_sum::apply_proxy_noalias(Mat<typename T1::elem_type>& out, const Proxy<T1>& P
   
   if(P.get_n_elem() == 0)  { out.zeros(); return; }
   
+  if( (arma_config::openmp) && (Proxy<T1>::use_mp) && (mp_gate<eT>::eval(P.get_n_elem())) )
+    {
+    op_sum::apply_proxy_noalias_mp(out, P, dim);
+    
+    return;
+    }
+  
   eT* out_mem = out.memptr();
   
   if(Proxy<T1>::use_at == false)
@@ -455,6 +462,89 @@ op_sum::apply_proxy_noalias(Mat<typename T1::elem_type>& out, const Proxy<T1>& P
 
 
 
+//! the expression is evaluated element-by-element within the reduction, without a temporary matrix;
+//! out must already have the correct size
+template<typename T1>
+inline
+void
+op_sum::apply_proxy_noalias_mp(Mat<typename T1::elem_type>& out, const Proxy<T1>& P, const uword dim)
+  {
+  arma_debug_sigprint();
+  
+  #if defined(ARMA_USE_OPENMP)
+    {
+    typedef typename T1::elem_type eT;
+    
+    const uword P_n_rows = P.get_n_rows();
+    const uword P_n_cols = P.get_n_cols();
+    
+    eT* out_mem = out.memptr();
+    
+    const int n_threads = mp_thread_limit::get();
+    
+    if(dim == 0)
+      {
+      if(P_n_cols >= uword(n_threads))
+        {
+        #pragma omp parallel for schedule(static) num_threads(n_threads)
+        for(uword col=0; col < P_n_cols; ++col)
+          {
+          out_mem[col] = op_accu_mat::apply_proxy_range(P, col*P_n_rows, (col+1)*P_n_rows);
+          }
+        }
+      else
+        {
+        // too few columns to keep all threads busy; parallelise within each column instead
+        
+        for(uword col=0; col < P_n_cols; ++col)
+          {
+          out_mem[col] = op_accu_mat::apply_proxy_mp(P, col*P_n_rows, (col+1)*P_n_rows);
+          }
+        }
+      }
+    else
+      {
+      if(P_n_rows == 1)
+        {
+        out_mem[0] = op_accu_mat::apply_proxy_mp(P, uword(0), P_n_cols);
+        
+        return;
+        }
+      
+      // blocks of rows are processed by separate threads;
+      // within each block, the columns are traversed in storage order
+      
+      const uword block_size = 64;
+      const uword n_blocks   = (P_n_rows + block_size - 1) / block_size;
+      
+      #pragma omp parallel for schedule(static) num_threads(n_threads)
+      for(uword block=0; block < n_blocks; ++block)
+        {
+        const uword row_start = block * block_size;
+        const uword row_end   = (std::min)(row_start + block_size, P_n_rows);
+        
+        for(uword row=row_start; row < row_end; ++row)  { out_mem[row] = (Proxy<T1>::use_at) ? P.at(row,0) : P[row]; }
+        
+        for(uword col=1; col < P_n_cols; ++col)
+          {
+          const uword offset = col*P_n_rows;
+          
+          for(uword row=row_start; row < row_end; ++row)  { out_mem[row] += (Proxy<T1>::use_at) ? P.at(row,col) : P[offset + row]; }
+          }
+        }
+      }
+    }
+  #else
+    {
+    arma_ignore(out);
+    arma_ignore(P);
+    arma_ignore(dim);
+    }
+  #endif
+  }
+
+
+
 //
 // cubes
 
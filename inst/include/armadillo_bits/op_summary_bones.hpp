@@ -0,0 +1,104 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2026 Dirk Eddelbuettel
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// https://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+
+//! \addtogroup op_summary
+//! @{
+
+
+
+//! Column-wise (dim=0) or row-wise (dim=1) statistics obtained via a single pass through the data.
+//! Non-finite elements are counted and excluded from the other statistics.
+template<typename eT>
+class summary_stats
+  {
+  public:
+  
+  Mat<eT>    mean;
+  Mat<eT>    var;
+  Mat<eT>    min;
+  Mat<eT>    max;
+  Mat<uword> count;        //!< number of finite elements
+  Mat<uword> n_nonfinite;  //!< number of non-finite elements (NaN, +Inf, -Inf)
+  
+  uword norm_type;
+  uword dim;
+  
+  inline summary_stats();
+  
+  inline void reset(const uword n_elem, const uword in_norm_type, const uword in_dim);
+  };
+
+
+
+//! running statistics for one lane, updated via Welford's algorithm and merged via Chan's method
+template<typename eT>
+struct op_summary_acc
+  {
+  uword n;
+  eT    mean;
+  eT    m2;
+  eT    min_val;
+  eT    max_val;
+  uword n_nonfinite;
+  
+  inline op_summary_acc();
+  
+  arma_inline void push(const eT val);
+  
+  inline void merge(const op_summary_acc<eT>& B);
+  inline void merge(const uword B_n, const eT B_mean, const eT B_m2, const eT B_min, const eT B_max);
+  
+  inline void push_block(const eT* X, const uword N);
+  };
+
+
+
+struct op_summary
+  {
+  static constexpr uword block_size = 1024;  // number of elements processed per block; small enough to remain in L1 cache
+  
+  template<typename T1>
+  inline static void apply(summary_stats<typename T1::elem_type>& out, const Base<typename T1::elem_type, T1>& X, const uword norm_type, const uword dim);
+  
+  template<typename eT>
+  inline static void apply(summary_stats<eT>& out, const subview<eT>& X, const uword norm_type, const uword dim);
+  
+  template<typename T1>
+  inline static void apply(summary_stats<typename T1::elem_type>& out, const SpBase<typename T1::elem_type, T1>& X, const uword norm_type, const uword dim);
+  
+  //
+  
+  template<typename eT, typename MatT>
+  inline static void apply_dense_dim0(summary_stats<eT>& out, const MatT& X);
+  
+  template<typename eT, typename MatT>
+  inline static void apply_dense_dim1(summary_stats<eT>& out, const MatT& X);
+  
+  template<typename eT>
+  inline static void apply_sparse_dim0(summary_stats<eT>& out, const SpMat<eT>& X);
+  
+  template<typename eT>
+  inline static void apply_sparse_dim1(summary_stats<eT>& out, const SpMat<eT>& X);
+  
+  template<typename eT>
+  inline static void store(summary_stats<eT>& out, const uword i, const op_summary_acc<eT>& acc);
+  };
+
+
+
+//! @}
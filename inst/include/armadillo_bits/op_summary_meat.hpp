@@ -0,0 +1,590 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2026 Dirk Eddelbuettel
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// https://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+
+//! \addtogroup op_summary
+//! @{
+
+
+
+template<typename eT>
+inline
+summary_stats<eT>::summary_stats()
+  : norm_type(0)
+  , dim(0)
+  {
+  arma_debug_sigprint();
+  }
+
+
+
+template<typename eT>
+inline
+void
+summary_stats<eT>::reset(const uword n_elem, const uword in_norm_type, const uword in_dim)
+  {
+  arma_debug_sigprint();
+  
+  const uword local_n_rows = (in_dim == 0) ? uword(1) : n_elem;
+  const uword local_n_cols = (in_dim == 0) ? n_elem   : uword(1);
+  
+  mean.set_size(local_n_rows, local_n_cols);
+  var.set_size(local_n_rows, local_n_cols);
+  min.set_size(local_n_rows, local_n_cols);
+  max.set_size(local_n_rows, local_n_cols);
+  count.set_size(local_n_rows, local_n_cols);
+  n_nonfinite.set_size(local_n_rows, local_n_cols);
+  
+  norm_type = in_norm_type;
+  dim       = in_dim;
+  }
+
+
+
+//
+
+
+
+template<typename eT>
+inline
+op_summary_acc<eT>::op_summary_acc()
+  : n          (uword(0))
+  , mean       (eT(0))
+  , m2         (eT(0))
+  , min_val    (+Datum<eT>::inf)
+  , max_val    (-Datum<eT>::inf)
+  , n_nonfinite(uword(0))
+  {
+  }
+
+
+
+template<typename eT>
+arma_inline
+void
+op_summary_acc<eT>::push(const eT val)
+  {
+  if(arma_isfinite(val))
+    {
+    ++n;
+    
+    const eT delta = val - mean;
+    
+    mean += delta / eT(n);
+    m2   += delta * (val - mean);
+    
+    min_val = (val < min_val) ? val : min_val;
+    max_val = (val > max_val) ? val : max_val;
+    }
+  else
+    {
+    ++n_nonfinite;
+    }
+  }
+
+
+
+template<typename eT>
+inline
+void
+op_summary_acc<eT>::merge(const op_summary_acc<eT>& B)
+  {
+  n_nonfinite += B.n_nonfinite;
+  
+  merge(B.n, B.mean, B.m2, B.min_val, B.max_val);
+  }
+
+
+
+template<typename eT>
+inline
+void
+op_summary_acc<eT>::merge(const uword B_n, const eT B_mean, const eT B_m2, const eT B_min, const eT B_max)
+  {
+  if(B_n == 0)  { return; }
+  
+  if(n == 0)
+    {
+    n       = B_n;
+    mean    = B_mean;
+    m2      = B_m2;
+    min_val = B_min;
+    max_val = B_max;
+    
+    return;
+    }
+  
+  const uword new_n = n + B_n;
+  const eT    delta = B_mean - mean;
+  const eT    ratio = eT(B_n) / eT(new_n);
+  
+  mean += delta * ratio;
+  m2   += B_m2 + delta * delta * (eT(n) * ratio);
+  n     = new_n;
+  
+  min_val = (B_min < min_val) ? B_min : min_val;
+  max_val = (B_max > max_val) ? B_max : max_val;
+  }
+
+
+
+//! process a contiguous block: first pass obtains count, sum, min and max;
+//! the second pass (over data still in cache) obtains the sum of squared deviations about the block mean
+template<typename eT>
+inline
+void
+op_summary_acc<eT>::push_block(const eT* X, const uword N)
+  {
+  const uword block_size = op_summary::block_size;
+  
+  uword i = 0;
+  
+  while(i < N)
+    {
+    const uword len = (std::min)(block_size, N - i);
+    
+    const eT* Xb = &(X[i]);
+    
+    uword block_n   = 0;
+    eT    block_sum = eT(0);
+    eT    block_min = +Datum<eT>::inf;
+    eT    block_max = -Datum<eT>::inf;
+    
+    for(uword j=0; j < len; ++j)
+      {
+      const eT val = Xb[j];
+      
+      if(arma_isfinite(val))
+        {
+        ++block_n;
+        
+        block_sum += val;
+        
+        block_min = (val < block_min) ? val : block_min;
+        block_max = (val > block_max) ? val : block_max;
+        }
+      }
+    
+    n_nonfinite += (len - block_n);
+    
+    if(block_n > 0)
+      {
+      const eT block_mean = block_sum / eT(block_n);
+      
+      eT block_m2 = eT(0);
+      
+      if(block_n == len)
+        {
+        for(uword j=0; j < len; ++j)  { const eT tmp = Xb[j] - block_mean;  block_m2 += tmp*tmp; }
+        }
+      else
+        {
+        for(uword j=0; j < len; ++j)
+          {
+          const eT val = Xb[j];
+          
+          if(arma_isfinite(val))  { const eT tmp = val - block_mean;  block_m2 += tmp*tmp; }
+          }
+        }
+      
+      merge(block_n, block_mean, block_m2, block_min, block_max);
+      }
+    
+    i += len;
+    }
+  }
+
+
+
+//
+
+
+
+template<typename T1>
+inline
+void
+op_summary::apply(summary_stats<typename T1::elem_type>& out, const Base<typename T1::elem_type, T1>& X, const uword norm_type, const uword dim)
+  {
+  arma_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  
+  arma_conform_check( (norm_type > 1), "summarise(): parameter 'norm_type' must be 0 or 1" );
+  arma_conform_check( (dim > 1),       "summarise(): parameter 'dim' must be 0 or 1"       );
+  
+  const quasi_unwrap<T1> U(X.get_ref());
+  
+  const Mat<eT>& M = U.M;
+  
+  out.reset( ((dim == 0) ? M.n_cols : M.n_rows), norm_type, dim );
+  
+  (dim == 0) ? op_summary::apply_dense_dim0(out, M) : op_summary::apply_dense_dim1(out, M);
+  }
+
+
+
+template<typename eT>
+inline
+void
+op_summary::apply(summary_stats<eT>& out, const subview<eT>& X, const uword norm_type, const uword dim)
+  {
+  arma_debug_sigprint();
+  
+  arma_conform_check( (norm_type > 1), "summarise(): parameter 'norm_type' must be 0 or 1" );
+  arma_conform_check( (dim > 1),       "summarise(): parameter 'dim' must be 0 or 1"       );
+  
+  // work directly on the parent matrix to avoid a copy
+  
+  out.reset( ((dim == 0) ? X.n_cols : X.n_rows), norm_type, dim );
+  
+  (dim == 0) ? op_summary::apply_dense_dim0(out, X) : op_summary::apply_dense_dim1(out, X);
+  }
+
+
+
+template<typename T1>
+inline
+void
+op_summary::apply(summary_stats<typename T1::elem_type>& out, const SpBase<typename T1::elem_type, T1>& X, const uword norm_type, const uword dim)
+  {
+  arma_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  
+  arma_conform_check( (norm_type > 1), "summarise(): parameter 'norm_type' must be 0 or 1" );
+  arma_conform_check( (dim > 1),       "summarise(): parameter 'dim' must be 0 or 1"       );
+  
+  const unwrap_spmat<T1> U(X.get_ref());
+  
+  const SpMat<eT>& M = U.M;
+  
+  out.reset( ((dim == 0) ? M.n_cols : M.n_rows), norm_type, dim );
+  
+  (dim == 0) ? op_summary::apply_sparse_dim0(out, M) : op_summary::apply_sparse_dim1(out, M);
+  }
+
+
+
+template<typename eT, typename MatT>
+inline
+void
+op_summary::apply_dense_dim0(summary_stats<eT>& out, const MatT& X)
+  {
+  arma_debug_sigprint();
+  
+  const uword X_n_rows = X.n_rows;
+  const uword X_n_cols = X.n_cols;
+  
+  if(X_n_cols == 0)  { return; }
+  
+  #if defined(ARMA_USE_OPENMP)
+    {
+    if( mp_gate<eT>::eval(X_n_rows * X_n_cols) )
+      {
+      const int n_threads = mp_thread_limit::get();
+      
+      if(X_n_cols >= uword(n_threads))
+        {
+        arma_debug_print("op_summary::apply_dense_dim0(): parallelised across columns");
+        
+        #pragma omp parallel for schedule(static) num_threads(n_threads)
+        for(uword col=0; col < X_n_cols; ++col)
+          {
+          op_summary_acc<eT> acc;
+          
+          acc.push_block(X.colptr(col), X_n_rows);
+          
+          op_summary::store(out, col, acc);
+          }
+        }
+      else
+        {
+        arma_debug_print("op_summary::apply_dense_dim0(): parallelised within columns");
+        
+        // split each column into segments aligned to block boundaries, then merge the partial results
+        
+        const uword n_blocks       = (X_n_rows + op_summary::block_size - 1) / op_summary::block_size;
+        const uword seg_n_blocks   = (n_blocks + uword(n_threads) - 1) / uword(n_threads);
+        const uword seg_len        = seg_n_blocks * op_summary::block_size;
+        const uword n_segs         = (X_n_rows + seg_len - 1) / seg_len;
+        
+        std::vector< op_summary_acc<eT> > seg_acc(n_segs);
+        
+        for(uword col=0; col < X_n_cols; ++col)
+          {
+          const eT* colmem = X.colptr(col);
+          
+          for(uword s=0; s < n_segs; ++s)  { seg_acc[s] = op_summary_acc<eT>(); }
+          
+          #pragma omp parallel for schedule(static) num_threads(n_threads)
+          for(uword s=0; s < n_segs; ++s)
+            {
+            const uword start = s * seg_len;
+            const uword len   = (std::min)(seg_len, X_n_rows - start);
+            
+            seg_acc[s].push_block(&(colmem[start]), len);
+            }
+          
+          op_summary_acc<eT> acc;
+          
+          for(uword s=0; s < n_segs; ++s)  { acc.merge(seg_acc[s]); }
+          
+          op_summary::store(out, col, acc);
+          }
+        }
+      
+      return;
+      }
+    }
+  #endif
+  
+  for(uword col=0; col < X_n_cols; ++col)
+    {
+    op_summary_acc<eT> acc;
+    
+    acc.push_block(X.colptr(col), X_n_rows);
+    
+    op_summary::store(out, col, acc);
+    }
+  }
+
+
+
+template<typename eT, typename MatT>
+inline
+void
+op_summary::apply_dense_dim1(summary_stats<eT>& out, const MatT& X)
+  {
+  arma_debug_sigprint();
+  
+  const uword X_n_rows = X.n_rows;
+  const uword X_n_cols = X.n_cols;
+  
+  if(X_n_rows == 0)  { return; }
+  
+  // each row block is swept through all columns in storage order;
+  // the accumulators for one block stay in cache
+  
+  const uword row_block_size = 256;
+  const uword n_row_blocks   = (X_n_rows + row_block_size - 1) / row_block_size;
+  
+  std::vector< op_summary_acc<eT> > acc(X_n_rows);
+  
+  const bool use_mp = (arma_config::openmp) && (n_row_blocks >= 2) && mp_gate<eT>::eval(X_n_rows * X_n_cols);
+  
+  if(use_mp)
+    {
+    #if defined(ARMA_USE_OPENMP)
+      {
+      const int n_threads = mp_thread_limit::get();
+      
+      #pragma omp parallel for schedule(static) num_threads(n_threads)
+      for(uword b=0; b < n_row_blocks; ++b)
+        {
+        const uword row_start = b * row_block_size;
+        const uword row_end   = (std::min)(row_start + row_block_size, X_n_rows);
+        
+        for(uword col=0; col < X_n_cols; ++col)
+          {
+          const eT* colmem = X.colptr(col);
+          
+          for(uword row=row_start; row < row_end; ++row)  { acc[row].push(colmem[row]); }
+          }
+        }
+      }
+    #endif
+    }
+  else
+    {
+    for(uword b=0; b < n_row_blocks; ++b)
+      {
+      const uword row_start = b * row_block_size;
+      const uword row_end   = (std::min)(row_start + row_block_size, X_n_rows);
+      
+      for(uword col=0; col < X_n_cols; ++col)
+        {
+        const eT* colmem = X.colptr(col);
+        
+        for(uword row=row_start; row < row_end; ++row)  { acc[row].push(colmem[row]); }
+        }
+      }
+    }
+  
+  for(uword row=0; row < X_n_rows; ++row)  { op_summary::store(out, row, acc[row]); }
+  }
+
+
+
+template<typename eT>
+inline
+void
+op_summary::apply_sparse_dim0(summary_stats<eT>& out, const SpMat<eT>& X)
+  {
+  arma_debug_sigprint();
+  
+  const uword X_n_rows = X.n_rows;
+  const uword X_n_cols = X.n_cols;
+  
+  const eT*    values   = X.values;
+  const uword* col_ptrs = X.col_ptrs;
+  
+  const bool use_mp = (arma_config::openmp) && (X_n_cols >= 2) && mp_gate<eT>::eval(X.n_nonzero);
+  
+  if(use_mp)
+    {
+    #if defined(ARMA_USE_OPENMP)
+      {
+      const int n_threads = mp_thread_limit::get();
+      
+      #pragma omp parallel for schedule(static) num_threads(n_threads)
+      for(uword col=0; col < X_n_cols; ++col)
+        {
+        const uword col_nnz = col_ptrs[col+1] - col_ptrs[col];
+        
+        op_summary_acc<eT> acc;
+        
+        acc.push_block(&(values[col_ptrs[col]]), col_nnz);
+        acc.merge( (X_n_rows - col_nnz), eT(0), eT(0), eT(0), eT(0) );
+        
+        op_summary::store(out, col, acc);
+        }
+      }
+    #endif
+    }
+  else
+    {
+    for(uword col=0; col < X_n_cols; ++col)
+      {
+      const uword col_nnz = col_ptrs[col+1] - col_ptrs[col];
+      
+      op_summary_acc<eT> acc;
+      
+      acc.push_block(&(values[col_ptrs[col]]), col_nnz);
+      acc.merge( (X_n_rows - col_nnz), eT(0), eT(0), eT(0), eT(0) );
+      
+      op_summary::store(out, col, acc);
+      }
+    }
+  }
+
+
+
+template<typename eT>
+inline
+void
+op_summary::apply_sparse_dim1(summary_stats<eT>& out, const SpMat<eT>& X)
+  {
+  arma_debug_sigprint();
+  
+  const uword X_n_rows = X.n_rows;
+  const uword X_n_cols = X.n_cols;
+  
+  if(X_n_rows == 0)  { return; }
+  
+  const eT*    values      = X.values;
+  const uword* row_indices = X.row_indices;
+  
+  std::vector< op_summary_acc<eT> > acc(X_n_rows);
+  
+  const bool use_mp = (arma_config::openmp) && (X_n_cols >= 2) && mp_gate<eT>::eval(X.n_nonzero);
+  
+  if(use_mp)
+    {
+    #if defined(ARMA_USE_OPENMP)
+      {
+      // each thread processes a contiguous range of columns into its own set of accumulators
+      
+      const uword* col_ptrs = X.col_ptrs;
+      
+      const uword n_threads = uword(mp_thread_limit::get());
+      const uword n_parts   = (std::min)(n_threads, X_n_cols);
+      
+      std::vector< std::vector< op_summary_acc<eT> > > part_acc(n_parts);
+      
+      #pragma omp parallel for schedule(static) num_threads(int(n_threads))
+      for(uword p=0; p < n_parts; ++p)
+        {
+        std::vector< op_summary_acc<eT> >& local_acc = part_acc[p];
+        
+        local_acc.resize(X_n_rows);
+        
+        const uword col_start = (p * X_n_cols) / n_parts;
+        const uword col_end   = ((p+1) * X_n_cols) / n_parts;
+        
+        for(uword i=col_ptrs[col_start]; i < col_ptrs[col_end]; ++i)  { local_acc[ row_indices[i] ].push(values[i]); }
+        }
+      
+      for(uword p=0; p < n_parts; ++p)
+      for(uword row=0; row < X_n_rows; ++row)
+        {
+        acc[row].merge(part_acc[p][row]);
+        }
+      }
+    #endif
+    }
+  else
+    {
+    const uword X_n_nonzero = X.n_nonzero;
+    
+    for(uword i=0; i < X_n_nonzero; ++i)  { acc[ row_indices[i] ].push(values[i]); }
+    }
+  
+  for(uword row=0; row < X_n_rows; ++row)
+    {
+    op_summary_acc<eT>& row_acc = acc[row];
+    
+    const uword row_nnz = row_acc.n + row_acc.n_nonfinite;
+    
+    row_acc.merge( (X_n_cols - row_nnz), eT(0), eT(0), eT(0), eT(0) );
+    
+    op_summary::store(out, row, row_acc);
+    }
+  }
+
+
+
+template<typename eT>
+inline
+void
+op_summary::store(summary_stats<eT>& out, const uword i, const op_summary_acc<eT>& acc)
+  {
+  const uword n = acc.n;
+  
+  const eT norm_val = (out.norm_type == 0) ? eT(n - 1) : eT(n);
+  
+  out.count[i]       = n;
+  out.n_nonfinite[i] = acc.n_nonfinite;
+  
+  if(n > 0)
+    {
+    out.mean[i] = acc.mean;
+    out.var[i]  = (n >= 2) ? (acc.m2 / norm_val) : eT(0);
+    out.min[i]  = acc.min_val;
+    out.max[i]  = acc.max_val;
+    }
+  else
+    {
+    out.mean[i] = Datum<eT>::nan;
+    out.var[i]  = Datum<eT>::nan;
+    out.min[i]  = Datum<eT>::nan;
+    out.max[i]  = Datum<eT>::nan;
+    }
+  }
+
+
+
+//! @}
@@ -479,4 +479,81 @@ operator*
 
 
 
+//! multiplication of a CSR sparse matrix and a dense object;
+//! each row of the CSR matrix yields one row of the output, so the transpose-free blocked kernel is used directly
+template<typename eT, typename T1>
+inline
+Mat<eT>
+operator*
+  (
+  const SpMatR<eT>&  x,
+  const Base<eT,T1>& y
+  )
+  {
+  arma_debug_sigprint();
+  
+  const quasi_unwrap<T1> U(y.get_ref());
+  
+  arma_conform_assert_mul_size(x.n_rows, x.n_cols, U.M.n_rows, U.M.n_cols, "matrix multiplication");
+  
+  Mat<eT> out;
+  
+  if(U.is_alias(out))
+    {
+    const Mat<eT> tmp(U.M);
+    
+    glue_times_sparse_dense::apply_trans_blocked(out, x.st(), tmp);
+    }
+  else
+    {
+    glue_times_sparse_dense::apply_trans_blocked(out, x.st(), U.M);
+    }
+  
+  return out;
+  }
+
+
+
+//! multiplication of a dense object and a CSR sparse matrix
+template<typename eT, typename T1>
+inline
+Mat<eT>
+operator*
+  (
+  const Base<eT,T1>& x,
+  const SpMatR<eT>&  y
+  )
+  {
+  arma_debug_sigprint();
+  
+  const quasi_unwrap<T1> U(x.get_ref());
+  const Mat<eT>& A     = U.M;
+  
+  arma_conform_assert_mul_size(A.n_rows, A.n_cols, y.n_rows, y.n_cols, "matrix multiplication");
+  
+  Mat<eT> out(A.n_rows, y.n_cols, fill::zeros);
+  
+  if( (out.n_elem == 0) || (y.n_nonzero == 0) )  { return out; }
+  
+  const uword A_n_rows = A.n_rows;
+  
+  for(uword row=0; row < y.n_rows; ++row)
+    {
+    const eT* A_col = A.colptr(row);
+    
+    for(uword k = y.row_ptrs[row]; k < y.row_ptrs[row+1]; ++k)
+      {
+      const eT val = y.values[k];
+      
+      eT* out_col = out.colptr(y.col_indices[k]);
+      
+      for(uword i=0; i < A_n_rows; ++i)  { out_col[i] += val * A_col[i]; }
+      }
+    }
+  
+  return out;
+  }
+
+
+
 //! @}
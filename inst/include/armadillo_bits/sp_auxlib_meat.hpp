@@ -79,6 +79,16 @@ sp_auxlib::eigs_sym(Col<eT>& eigval, Mat<eT>& eigvec, const SpBase<eT, T1>& X, c
     return false;
     }
   
+  if(opts.method == eigs_opts::LOBPCG)
+    {
+    if( (form_val == form_la) || (form_val == form_sa) )
+      {
+      return sp_auxlib::eigs_sym_lobpcg(eigval, eigvec, U.M, n_eigvals, form_val, opts);
+      }
+    
+    arma_warn(1, "eigs_sym(): LOBPCG supports only forms \"la\" and \"sa\"; using Krylov method");
+    }
+  
   // TODO: investigate optional redirection of "sm" to ARPACK as it's capable of shift-invert;
   // TODO: in shift-invert mode, "sm" maps to "lm" of the shift-inverted matrix (with sigma = 0)
   
@@ -171,6 +181,9 @@ sp_auxlib::eigs_sym_newarp(Col<eT>& eigval, Mat<eT>& eigvec, const SpMat<eT>& X,
     
     if(X.is_square() == false)  { return false; }
     
+    wall_clock timer_total;
+    timer_total.tic();
+    
     const newarp::SparseGenMatProd<eT> op(X);
     
     arma_conform_check( (n_eigvals >= op.n_rows), "eigs_sym(): n_eigvals must be less than the number of rows in the matrix" );
@@ -224,6 +237,8 @@ sp_auxlib::eigs_sym_newarp(Col<eT>& eigval, Mat<eT>& eigvec, const SpMat<eT>& X,
     bool status = true;
     
     uword nconv = 0;
+    uword niter = 0;
+    uword nmatop = 0;
     
     try
       {
@@ -234,6 +249,8 @@ sp_auxlib::eigs_sym_newarp(Col<eT>& eigval, Mat<eT>& eigvec, const SpMat<eT>& X,
         nconv  = eigs.compute(maxiter, tol);
         eigval = eigs.eigenvalues();
         eigvec = eigs.eigenvectors();
+        niter  = eigs.num_iterations();
+        nmatop = eigs.num_operations();
         }
       else
       if(form_val == form_sm)
@@ -243,6 +260,8 @@ sp_auxlib::eigs_sym_newarp(Col<eT>& eigval, Mat<eT>& eigvec, const SpMat<eT>& X,
         nconv  = eigs.compute(maxiter, tol);
         eigval = eigs.eigenvalues();
         eigvec = eigs.eigenvectors();
+        niter  = eigs.num_iterations();
+        nmatop = eigs.num_operations();
         }
       else
       if(form_val == form_la)
@@ -252,6 +271,8 @@ sp_auxlib::eigs_sym_newarp(Col<eT>& eigval, Mat<eT>& eigvec, const SpMat<eT>& X,
         nconv  = eigs.compute(maxiter, tol);
         eigval = eigs.eigenvalues();
         eigvec = eigs.eigenvectors();
+        niter  = eigs.num_iterations();
+        nmatop = eigs.num_operations();
         }
       else
       if(form_val == form_sa)
@@ -261,6 +282,8 @@ sp_auxlib::eigs_sym_newarp(Col<eT>& eigval, Mat<eT>& eigvec, const SpMat<eT>& X,
         nconv  = eigs.compute(maxiter, tol);
         eigval = eigs.eigenvalues();
         eigvec = eigs.eigenvectors();
+        niter  = eigs.num_iterations();
+        nmatop = eigs.num_operations();
         }
       }
     catch(const std::runtime_error&)
@@ -273,6 +296,17 @@ sp_auxlib::eigs_sym_newarp(Col<eT>& eigval, Mat<eT>& eigvec, const SpMat<eT>& X,
       if(nconv == 0)  { status = false; }
       }
     
+    if(opts.stats != nullptr)
+      {
+      eigs_stats& stats = *(opts.stats);
+      
+      stats.n_iter      = (unsigned int)(niter);
+      stats.n_matvec    = (unsigned int)(nmatop);
+      stats.time_matvec = op.time_matvec;
+      stats.time_total  = timer_total.toc();
+      stats.converged   = (status == true) && (nconv >= n_eigvals);
+      }
+    
     return status;
     }
   #else
@@ -394,6 +428,252 @@ sp_auxlib::eigs_sym_newarp(Col<eT>& eigval, Mat<eT>& eigvec, const SpMat<eT>& X,
 
 
 
+//! LOBPCG (locally optimal block preconditioned conjugate gradient), without preconditioning.
+//! The smallest eigenvalues of X (form "sa") or of -X (form "la") are found by iterating on a block of vectors;
+//! each iteration needs one product of X with a block of residual vectors, performed as a single sparse-dense product,
+//! while the orthogonalisation and the Rayleigh-Ritz step consist of dense matrix products and a small eigendecomposition.
+template<typename eT>
+inline
+bool
+sp_auxlib::eigs_sym_lobpcg(Col<eT>& eigval, Mat<eT>& eigvec, const SpMat<eT>& X, const uword n_eigvals, const form_type form_val, const eigs_opts& opts)
+  {
+  arma_debug_sigprint();
+  
+  arma_conform_check( (form_val != form_la) && (form_val != form_sa), "eigs_sym(): LOBPCG supports only forms \"la\" and \"sa\"" );
+  
+  if(X.is_square() == false)  { return false; }
+  
+  const uword n = X.n_rows;
+  const uword k = n_eigvals;
+  
+  arma_conform_check( (k >= n), "eigs_sym(): n_eigvals must be less than the number of rows in the matrix" );
+  
+  eigs_stats  local_stats;
+  eigs_stats& stats = (opts.stats != nullptr) ? (*(opts.stats)) : local_stats;
+  
+  stats = eigs_stats();
+  
+  wall_clock timer_total;
+  timer_total.tic();
+  
+  if( (n == 0) || (k == 0) )
+    {
+    eigval.reset();
+    eigvec.reset();
+    
+    stats.converged = true;
+    
+    return true;
+    }
+  
+  // the vectors beyond the first k are not required to converge, but they accelerate convergence of the wanted ones
+  uword m = (opts.block_size > 0) ? uword(opts.block_size) : uword(k + (std::max)(uword(4), uword(k/2)));
+  
+  if(m < k)  { m = k; }
+  
+  if( (3*m) >= n )
+    {
+    arma_debug_print("eigs_sym(): block is large relative to matrix; using dense decomposition");
+    
+    Col<eT> D_eigval;
+    Mat<eT> D_eigvec;
+    
+    const bool status = auxlib::eig_sym(D_eigval, D_eigvec, Mat<eT>(X));
+    
+    if(status == false)  { return false; }
+    
+    // eigenvalues from auxlib::eig_sym() are in ascending order, as required for the output
+    eigval = (form_val == form_sa) ? Col<eT>(D_eigval.head(k))      : Col<eT>(D_eigval.tail(k));
+    eigvec = (form_val == form_sa) ? Mat<eT>(D_eigvec.head_cols(k)) : Mat<eT>(D_eigvec.tail_cols(k));
+    
+    stats.converged  = true;
+    stats.time_total = timer_total.toc();
+    
+    return true;
+    }
+  
+  const eT sign = (form_val == form_la) ? eT(-1) : eT(+1);
+  
+  const spmv_plan<eT> plan(X);
+  
+  const auto apply_op = [&](Mat<eT>& out, const Mat<eT>& in)
+    {
+    wall_clock timer;
+    timer.tic();
+    
+    plan.apply(out, in);
+    
+    if(sign < eT(0))  { arrayops::inplace_mul(out.memptr(), sign, out.n_elem); }
+    
+    stats.time_matvec += timer.toc();
+    stats.n_matvec    += (unsigned int)(in.n_cols);
+    };
+  
+  const eT eps = std::numeric_limits<eT>::epsilon();
+  
+  // orthonormalise the columns of V via the eigendecomposition of V.t()*V, applying the same transformation to AV;
+  // directions with negligible norm are dropped; the second pass removes the error introduced by forming V.t()*V
+  const auto orthonormalise = [&](Mat<eT>& V, Mat<eT>& AV, const bool update_AV) -> bool
+    {
+    for(uword pass=0; pass < 2; ++pass)
+      {
+      if(V.n_cols == 0)  { break; }
+      
+      const Mat<eT> G = V.t() * V;
+      
+      Col<eT> d;
+      Mat<eT> E;
+      
+      if(auxlib::eig_sym(d, E, G) == false)  { return false; }
+      
+      const uvec keep = find( d > (d.max() * eT(1e4) * eps) );
+      
+      Mat<eT> T = E.cols(keep);
+      
+      T.each_row() /= trans(sqrt(d.elem(keep)));
+      
+      V = V * T;
+      
+      if(update_AV)  { AV = AV * T; }
+      }
+    
+    return true;
+    };
+  
+  const eT tol   = (std::max)(eT(opts.tol), eT(1024) * eps);
+  const eT limit = tol * spop_norm::mat_norm_1(X);
+  
+  Mat<eT> V(n, m, arma_nozeros_indicator());
+  Mat<eT> AV;
+  
+  // deterministic starting block, so that repeated calls give identical results
+  std::mt19937_64 engine(std::mt19937_64::default_seed);
+  
+  std::uniform_real_distribution<double> distr(-1.0, 1.0);
+  
+  eT* V_mem = V.memptr();
+  
+  for(uword i=0; i < V.n_elem; ++i)  { V_mem[i] = eT(distr(engine)); }
+  
+  if( (orthonormalise(V, AV, false) == false) || (V.n_cols < m) )  { return false; }
+  
+  apply_op(AV, V);
+  
+  Col<eT> theta;
+  Mat<eT> C;
+  
+  Mat<eT> H = V.t() * AV;
+  
+  H = eT(0.5) * (H + H.t());
+  
+  if(auxlib::eig_sym(theta, C, H) == false)  { return false; }
+  
+  V  = V  * C;
+  AV = AV * C;
+  
+  Mat<eT> P;
+  Mat<eT> AP;
+  
+  Mat<eT> W;
+  Mat<eT> AW;
+  
+  bool status    = true;
+  bool converged = false;
+  
+  uword iter = 0;
+  
+  while(iter < uword(opts.maxiter))
+    {
+    ++iter;
+    
+    const Mat<eT> R = AV - (V.each_row() % theta.t());
+    
+    const Row<eT> R_norms = sqrt(sum(square(R)));
+    
+    if(all(R_norms.head(k) <= limit))
+      {
+      // AV is updated by recurrence; confirm convergence with explicit products before accepting the result
+      Mat<eT> AVk;
+      
+      apply_op(AVk, V.head_cols(k));
+      
+      const Mat<eT> Rk = AVk - (V.head_cols(k).each_row() % theta.head(k).t());
+      
+      if(all(sqrt(sum(square(Rk))) <= limit))  { converged = true; break; }
+      
+      AV.head_cols(k) = AVk;
+      
+      continue;
+      }
+    
+    W = R.cols( find(R_norms > limit) );
+    
+    for(uword pass=0; pass < 2; ++pass)  { W -= V * (V.t() * W); }
+    
+    if(orthonormalise(W, AW, false) == false)  { status = false; break; }
+    
+    if(W.n_cols == 0)  { break; }
+    
+    apply_op(AW, W);
+    
+    if(P.n_cols > 0)
+      {
+      for(uword pass=0; pass < 2; ++pass)
+        {
+        const Mat<eT> VP = V.t() * P;  P -= V * VP;  AP -= AV * VP;
+        const Mat<eT> WP = W.t() * P;  P -= W * WP;  AP -= AW * WP;
+        }
+      
+      if(orthonormalise(P, AP, true) == false)  { status = false; break; }
+      }
+    
+    // V, W and P are orthonormal and mutually orthogonal, so the Rayleigh-Ritz step is a standard eigenproblem
+    const Mat<eT> S  = join_rows(V,  W,  P );
+    const Mat<eT> AS = join_rows(AV, AW, AP);
+    
+    H = S.t() * AS;
+    
+    H = eT(0.5) * (H + H.t());
+    
+    Col<eT> theta_all;
+    
+    if(auxlib::eig_sym(theta_all, C, H) == false)  { status = false; break; }
+    
+    theta = theta_all.head(m);
+    
+    const Mat<eT> C_V = C.head_cols(m);
+    const Mat<eT> C_R = C_V.tail_rows(C_V.n_rows - m);
+    
+    P  = S.tail_cols (S.n_cols  - m) * C_R;
+    AP = AS.tail_cols(AS.n_cols - m) * C_R;
+    
+    V  = S  * C_V;
+    AV = AS * C_V;
+    }
+  
+  stats.n_iter     = (unsigned int)(iter);
+  stats.converged  = converged;
+  stats.time_total = timer_total.toc();
+  
+  if( (status == false) || (converged == false) )  { return false; }
+  
+  if(form_val == form_sa)
+    {
+    eigval = theta.head(k);
+    eigvec = V.head_cols(k);
+    }
+  else
+    {
+    // the largest eigenvalues of X are the negated smallest eigenvalues of -X; reverse to obtain ascending order
+    eigval = flipud(eT(-1) * theta.head(k));
+    eigvec = fliplr(V.head_cols(k));
+    }
+  
+  return true;
+  }
+
+
+
 template<typename eT, bool use_sigma>
 inline
 bool
@@ -624,6 +904,9 @@ sp_auxlib::eigs_gen_newarp(Col< std::complex<T> >& eigval, Mat< std::complex<T>
     
     if(X.is_square() == false)  { return false; }
     
+    wall_clock timer_total;
+    timer_total.tic();
+    
     const newarp::SparseGenMatProd<T> op(X);
     
     arma_conform_check( (n_eigvals + 1 >= op.n_rows), "eigs_gen(): n_eigvals + 1 must be less than the number of rows in the matrix" );
@@ -677,6 +960,8 @@ sp_auxlib::eigs_gen_newarp(Col< std::complex<T> >& eigval, Mat< std::complex<T>
     bool status = true;
     
     uword nconv = 0;
+    uword niter = 0;
+    uword nmatop = 0;
     
     try
       {
@@ -687,6 +972,8 @@ sp_auxlib::eigs_gen_newarp(Col< std::complex<T> >& eigval, Mat< std::complex<T>
         nconv  = eigs.compute(maxiter, tol);
         eigval = eigs.eigenvalues();
         eigvec = eigs.eigenvectors();
+        niter  = eigs.num_iterations();
+        nmatop = eigs.num_operations();
         }
       else
       if(form_val == form_sm)
@@ -696,6 +983,8 @@ sp_auxlib::eigs_gen_newarp(Col< std::complex<T> >& eigval, Mat< std::complex<T>
         nconv  = eigs.compute(maxiter, tol);
         eigval = eigs.eigenvalues();
         eigvec = eigs.eigenvectors();
+        niter  = eigs.num_iterations();
+        nmatop = eigs.num_operations();
         }
       else
       if(form_val == form_lr)
@@ -705,6 +994,8 @@ sp_auxlib::eigs_gen_newarp(Col< std::complex<T> >& eigval, Mat< std::complex<T>
         nconv  = eigs.compute(maxiter, tol);
         eigval = eigs.eigenvalues();
         eigvec = eigs.eigenvectors();
+        niter  = eigs.num_iterations();
+        nmatop = eigs.num_operations();
         }
       else
       if(form_val == form_sr)
@@ -714,6 +1005,8 @@ sp_auxlib::eigs_gen_newarp(Col< std::complex<T> >& eigval, Mat< std::complex<T>
         nconv  = eigs.compute(maxiter, tol);
         eigval = eigs.eigenvalues();
         eigvec = eigs.eigenvectors();
+        niter  = eigs.num_iterations();
+        nmatop = eigs.num_operations();
         }
       else
       if(form_val == form_li)
@@ -723,6 +1016,8 @@ sp_auxlib::eigs_gen_newarp(Col< std::complex<T> >& eigval, Mat< std::complex<T>
         nconv  = eigs.compute(maxiter, tol);
         eigval = eigs.eigenvalues();
         eigvec = eigs.eigenvectors();
+        niter  = eigs.num_iterations();
+        nmatop = eigs.num_operations();
         }
       else
       if(form_val == form_si)
@@ -732,6 +1027,8 @@ sp_auxlib::eigs_gen_newarp(Col< std::complex<T> >& eigval, Mat< std::complex<T>
         nconv  = eigs.compute(maxiter, tol);
         eigval = eigs.eigenvalues();
         eigvec = eigs.eigenvectors();
+        niter  = eigs.num_iterations();
+        nmatop = eigs.num_operations();
         }
       }
     catch(const std::runtime_error&)
@@ -744,6 +1041,17 @@ sp_auxlib::eigs_gen_newarp(Col< std::complex<T> >& eigval, Mat< std::complex<T>
       if(nconv == 0)  { status = false; }
       }
     
+    if(opts.stats != nullptr)
+      {
+      eigs_stats& stats = *(opts.stats);
+      
+      stats.n_iter      = (unsigned int)(niter);
+      stats.n_matvec    = (unsigned int)(nmatop);
+      stats.time_matvec = op.time_matvec;
+      stats.time_total  = timer_total.toc();
+      stats.converged   = (status == true) && (nconv >= n_eigvals);
+      }
+    
     return status;
     }
   #else
@@ -0,0 +1,103 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2026 Dirk Eddelbuettel
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// https://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+
+//! \addtogroup sp_chol
+//! @{
+
+
+
+//! approximate minimum degree ordering, using a quotient graph with element absorption
+struct sp_amd
+  {
+  inline static void apply(podarray<uword>& perm, const uword n, const uword* col_ptrs, const uword* row_indices);
+  };
+
+
+
+//! sparse LDL^T (or LDL^H) factorisation of a symmetric (or Hermitian) matrix, using an up-looking algorithm;
+//! the symbolic analysis (ordering, elimination tree, column counts) is kept separate
+//! from the numeric factorisation, so that matrices with the same sparsity pattern can be refactorised cheaply
+template<typename eT>
+class sp_chol
+  {
+  public:
+  
+  typedef typename get_pod_type<eT>::result T;
+  
+  inline void analyse(const SpMat<eT>& A, const sp_chol_opts::ordering_type ordering);
+  
+  inline bool factorise(const SpMat<eT>& A, const bool ldlt);
+  
+  inline bool same_pattern(const SpMat<eT>& A) const;
+  
+  inline void solve(Mat<eT>& X, const Mat<eT>& B) const;
+  
+  inline void log_det(T& out_val, T& out_sign) const;
+  
+  inline T rcond_estimate() const;
+  
+  
+  private:
+  
+  uword n = 0;
+  
+  podarray<uword> pattern_col_ptrs;     // pattern of the analysed matrix
+  podarray<uword> pattern_row_indices;
+  
+  podarray<uword> perm;                 // k-th pivot is row/column perm[k] of A
+  podarray<uword> perm_inv;
+  podarray<uword> parent;               // elimination tree
+  podarray<uword> L_col_ptrs;
+  
+  podarray<uword> L_row_indices;        // strictly lower part of L, unit diagonal not stored
+  podarray<eT>    L_values;
+  podarray<T>     D;
+  };
+
+
+
+//! holds the symbolic analysis and numeric factorisation for spsolve_factoriser
+template<typename eT>
+class sp_chol_worker
+  {
+  public:
+  
+  typedef typename get_pod_type<eT>::result T;
+  
+  inline sp_chol_worker(const sp_chol_opts& in_opts);
+  
+  inline bool factorise(const SpMat<eT>& A);
+  inline bool refactorise(const SpMat<eT>& A);
+  
+  inline bool solve(Mat<eT>& X, const Mat<eT>& B) const;
+  
+  inline void log_det(T& out_val, T& out_sign) const;
+  
+  inline T rcond() const;
+  
+  
+  private:
+  
+  const sp_chol_opts opts;
+  
+  sp_chol<eT> chol;
+  };
+
+
+
+//! @}
@@ -0,0 +1,603 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2026 Dirk Eddelbuettel
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// https://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+
+//! \addtogroup sp_chol
+//! @{
+
+
+
+inline
+void
+sp_amd::apply(podarray<uword>& perm, const uword n, const uword* col_ptrs, const uword* row_indices)
+  {
+  arma_debug_sigprint();
+  
+  perm.set_size(n);
+  
+  if(n == 0)  { return; }
+  
+  // adjacency lists of the symmetrised pattern, without the diagonal
+  
+  std::vector< std::vector<uword> > adj(n);
+  
+  for(uword col=0; col < n; ++col)
+  for(uword k = col_ptrs[col]; k < col_ptrs[col+1]; ++k)
+    {
+    const uword row = row_indices[k];
+    
+    if(row != col)
+      {
+      adj[col].push_back(row);
+      adj[row].push_back(col);
+      }
+    }
+  
+  for(uword i=0; i < n; ++i)
+    {
+    std::vector<uword>& list = adj[i];
+    
+    std::sort(list.begin(), list.end());
+    
+    list.erase( std::unique(list.begin(), list.end()), list.end() );
+    }
+  
+  // element e is the pivot eliminated at some step; elem_vars[e] holds its variables,
+  // var_elems[i] holds the elements adjacent to variable i
+  
+  std::vector< std::vector<uword> > elem_vars(n);
+  std::vector< std::vector<uword> > var_elems(n);
+  
+  const uword is_variable = 0;
+  const uword is_element  = 1;
+  const uword is_absorbed = 2;
+  
+  podarray<uword> status(n);
+  podarray<uword> degree(n);
+  podarray<uword> mark(n);
+  podarray<uword> w_mark(n);
+  podarray<uword> w_val(n);
+  
+  status.fill(is_variable);
+  mark.zeros();
+  w_mark.zeros();
+  
+  // min-heap of (degree, variable); entries become stale when the degree of a variable changes
+  
+  typedef std::pair<uword,uword> heap_entry;
+  
+  const std::greater<heap_entry> heap_cmp;
+  
+  std::vector<heap_entry> heap;
+  
+  heap.reserve(2*n);
+  
+  for(uword i=0; i < n; ++i)
+    {
+    degree[i] = uword(adj[i].size());
+    
+    heap.push_back( heap_entry(degree[i], i) );
+    }
+  
+  std::make_heap(heap.begin(), heap.end(), heap_cmp);
+  
+  std::vector<uword> Lp;
+  
+  uword stamp = 0;
+  
+  for(uword k=0; k < n; ++k)
+    {
+    // select the variable with the smallest (approximate) degree, skipping stale heap entries
+    
+    uword p = 0;
+    
+    while(heap.empty() == false)
+      {
+      std::pop_heap(heap.begin(), heap.end(), heap_cmp);
+      
+      const heap_entry top = heap.back();
+      
+      heap.pop_back();
+      
+      if( (status[top.second] == is_variable) && (degree[top.second] == top.first) )  { p = top.second; break; }
+      }
+    
+    perm[k]   = p;
+    status[p] = is_element;
+    
+    ++stamp;
+    
+    // form the new element: Lp = (adj[p] union the variables of the elements adjacent to p) \ {p};
+    // the adjacent elements are absorbed into the new one
+    
+    Lp.clear();
+    
+    mark[p] = stamp;
+    
+    for(const uword i : adj[p])
+      {
+      if( (status[i] == is_variable) && (mark[i] != stamp) )  { mark[i] = stamp; Lp.push_back(i); }
+      }
+    
+    for(const uword e : var_elems[p])
+      {
+      if(status[e] != is_element)  { continue; }
+      
+      for(const uword i : elem_vars[e])
+        {
+        if( (status[i] == is_variable) && (mark[i] != stamp) )  { mark[i] = stamp; Lp.push_back(i); }
+        }
+      
+      status[e] = is_absorbed;
+      
+      std::vector<uword>().swap(elem_vars[e]);
+      }
+    
+    std::vector<uword>().swap(adj[p]);
+    std::vector<uword>().swap(var_elems[p]);
+    
+    elem_vars[p] = Lp;
+    
+    // for each element e adjacent to Lp, compute |Le \ Lp|
+    
+    for(const uword i : Lp)
+      {
+      for(const uword e : var_elems[i])
+        {
+        if(status[e] != is_element)  { continue; }
+        
+        if(w_mark[e] != stamp)
+          {
+          std::vector<uword>& list = elem_vars[e];
+          
+          uword n_keep = 0;
+          
+          for(const uword j : list)  { if(status[j] == is_variable)  { list[n_keep] = j; ++n_keep; } }
+          
+          list.resize(n_keep);
+          
+          w_mark[e] = stamp;
+          w_val[e]  = n_keep;
+          }
+        
+        w_val[e] -= 1;
+        }
+      }
+    
+    // update the variables in Lp
+    
+    const uword Lp_size = uword(Lp.size());
+    
+    for(const uword i : Lp)
+      {
+      std::vector<uword>& i_elems = var_elems[i];
+      
+      uword deg    = Lp_size - 1;
+      uword n_keep = 0;
+      
+      for(const uword e : i_elems)
+        {
+        if(status[e] == is_element)
+          {
+          i_elems[n_keep] = e;  ++n_keep;
+          
+          deg += w_val[e];
+          }
+        }
+      
+      i_elems.resize(n_keep);
+      i_elems.push_back(p);
+      
+      // variables in Lp are now reachable through element p
+      
+      std::vector<uword>& i_adj = adj[i];
+      
+      n_keep = 0;
+      
+      for(const uword j : i_adj)
+        {
+        if( (status[j] == is_variable) && (mark[j] != stamp) )  { i_adj[n_keep] = j;  ++n_keep; }
+        }
+      
+      i_adj.resize(n_keep);
+      
+      deg += n_keep;
+      
+      deg = (std::min)(deg, n - k - 1);
+      
+      degree[i] = deg;
+      
+      heap.push_back( heap_entry(deg, i) );
+      
+      std::push_heap(heap.begin(), heap.end(), heap_cmp);
+      }
+    }
+  }
+
+
+
+template<typename eT>
+inline
+void
+sp_chol<eT>::analyse(const SpMat<eT>& A, const sp_chol_opts::ordering_type ordering)
+  {
+  arma_debug_sigprint();
+  
+  A.sync();
+  
+  n = A.n_rows;
+  
+  pattern_col_ptrs.set_size(n+1);
+  pattern_row_indices.set_size(A.n_nonzero);
+  
+  arrayops::copy(pattern_col_ptrs.memptr(),    A.col_ptrs,    n+1        );
+  arrayops::copy(pattern_row_indices.memptr(), A.row_indices, A.n_nonzero);
+  
+  if(ordering == sp_chol_opts::AMD)
+    {
+    sp_amd::apply(perm, n, A.col_ptrs, A.row_indices);
+    }
+  else
+    {
+    perm.set_size(n);
+    
+    for(uword i=0; i < n; ++i)  { perm[i] = i; }
+    }
+  
+  perm_inv.set_size(n);
+  
+  for(uword k=0; k < n; ++k)  { perm_inv[perm[k]] = k; }
+  
+  // elimination tree and column counts of L for C = P*A*P^T, using the upper triangle of C
+  
+  parent.set_size(n);
+  
+  podarray<uword> flag(n);
+  podarray<uword> L_counts(n);
+  
+  for(uword k=0; k < n; ++k)
+    {
+    parent[k]   = n;
+    flag[k]     = k;
+    L_counts[k] = 0;
+    
+    const uword kk = perm[k];
+    
+    for(uword p = A.col_ptrs[kk]; p < A.col_ptrs[kk+1]; ++p)
+      {
+      uword i = perm_inv[A.row_indices[p]];
+      
+      if(i < k)
+        {
+        for(; flag[i] != k; i = parent[i])
+          {
+          if(parent[i] == n)  { parent[i] = k; }
+          
+          ++L_counts[i];
+          
+          flag[i] = k;
+          }
+        }
+      }
+    }
+  
+  L_col_ptrs.set_size(n+1);
+  
+  L_col_ptrs[0] = 0;
+  
+  for(uword k=0; k < n; ++k)  { L_col_ptrs[k+1] = L_col_ptrs[k] + L_counts[k]; }
+  
+  L_row_indices.set_size( L_col_ptrs[n] );
+  L_values.set_size( L_col_ptrs[n] );
+  D.set_size(n);
+  }
+
+
+
+template<typename eT>
+inline
+bool
+sp_chol<eT>::same_pattern(const SpMat<eT>& A) const
+  {
+  arma_debug_sigprint();
+  
+  A.sync();
+  
+  if( (A.n_rows != n) || (A.n_cols != n) || (A.n_nonzero != pattern_row_indices.n_elem) )  { return false; }
+  
+  const bool same_col_ptrs    = std::equal(A.col_ptrs,    A.col_ptrs    + (n+1),         pattern_col_ptrs.memptr()   );
+  const bool same_row_indices = std::equal(A.row_indices, A.row_indices + A.n_nonzero, pattern_row_indices.memptr());
+  
+  return (same_col_ptrs && same_row_indices);
+  }
+
+
+
+//! numeric factorisation using the result of analyse(); the sparsity pattern of A must be the analysed pattern
+template<typename eT>
+inline
+bool
+sp_chol<eT>::factorise(const SpMat<eT>& A, const bool ldlt)
+  {
+  arma_debug_sigprint();
+  
+  A.sync();
+  
+  podarray<eT>    Y(n);
+  podarray<uword> pattern(n);
+  podarray<uword> flag(n);
+  podarray<uword> L_counts(n);
+  
+  Y.zeros();
+  
+  uword* L_row_indices_mem = L_row_indices.memptr();
+  eT*    L_values_mem      = L_values.memptr();
+  
+  for(uword k=0; k < n; ++k)
+    {
+    // nonzero pattern of row k of L, via the elimination tree; the values of column k of the upper triangle of C go into Y
+    
+    uword top = n;
+    
+    flag[k]     = k;
+    L_counts[k] = 0;
+    
+    const uword kk = perm[k];
+    
+    for(uword p = A.col_ptrs[kk]; p < A.col_ptrs[kk+1]; ++p)
+      {
+      uword i = perm_inv[A.row_indices[p]];
+      
+      if(i <= k)
+        {
+        Y[i] += A.values[p];
+        
+        uword len = 0;
+        
+        for(; flag[i] != k; i = parent[i])
+          {
+          pattern[len] = i;  ++len;
+          
+          flag[i] = k;
+          }
+        
+        while(len > 0)  { --top;  --len;  pattern[top] = pattern[len]; }
+        }
+      }
+    
+    // sparse triangular solve for row k of L
+    
+    T d = access::tmp_real(Y[k]);
+    
+    Y[k] = eT(0);
+    
+    for(; top < n; ++top)
+      {
+      const uword i   = pattern[top];
+      const eT    y_i = Y[i];
+      
+      Y[i] = eT(0);
+      
+      const uword p_start = L_col_ptrs[i];
+      const uword p_end   = p_start + L_counts[i];
+      
+      for(uword p = p_start; p < p_end; ++p)  { Y[L_row_indices_mem[p]] -= L_values_mem[p] * y_i; }
+      
+      const eT l_ki = access::alt_conj(y_i) / D[i];
+      
+      d -= access::tmp_real(l_ki * y_i);
+      
+      L_row_indices_mem[p_end] = k;
+      L_values_mem[p_end]      = l_ki;
+      
+      ++L_counts[i];
+      }
+    
+    if( (d == T(0)) || arma_isnan(d) || ((ldlt == false) && (d < T(0))) )  { return false; }
+    
+    D[k] = d;
+    }
+  
+  return true;
+  }
+
+
+
+template<typename eT>
+inline
+void
+sp_chol<eT>::solve(Mat<eT>& X, const Mat<eT>& B) const
+  {
+  arma_debug_sigprint();
+  
+  X.set_size(n, B.n_cols);
+  
+  podarray<eT> y(n);
+  
+  const uword* L_row_indices_mem = L_row_indices.memptr();
+  const eT*    L_values_mem      = L_values.memptr();
+  
+  for(uword col=0; col < B.n_cols; ++col)
+    {
+    const eT* B_col = B.colptr(col);
+          eT* X_col = X.colptr(col);
+    
+    for(uword k=0; k < n; ++k)  { y[k] = B_col[perm[k]]; }
+    
+    // L y = b
+    
+    for(uword j=0; j < n; ++j)
+      {
+      const eT y_j = y[j];
+      
+      for(uword p = L_col_ptrs[j]; p < L_col_ptrs[j+1]; ++p)  { y[L_row_indices_mem[p]] -= L_values_mem[p] * y_j; }
+      }
+    
+    // D y = y
+    
+    for(uword j=0; j < n; ++j)  { y[j] /= D[j]; }
+    
+    // L^H y = y
+    
+    for(uword j=n; j-- > 0;)
+      {
+      eT acc = y[j];
+      
+      for(uword p = L_col_ptrs[j]; p < L_col_ptrs[j+1]; ++p)  { acc -= access::alt_conj(L_values_mem[p]) * y[L_row_indices_mem[p]]; }
+      
+      y[j] = acc;
+      }
+    
+    for(uword k=0; k < n; ++k)  { X_col[perm[k]] = y[k]; }
+    }
+  }
+
+
+
+template<typename eT>
+inline
+void
+sp_chol<eT>::log_det(T& out_val, T& out_sign) const
+  {
+  arma_debug_sigprint();
+  
+  T val  = T(0);
+  T sign = T(1);
+  
+  for(uword k=0; k < n; ++k)
+    {
+    const T d = D[k];
+    
+    val += std::log( (d < T(0)) ? -d : d );
+    
+    if(d < T(0))  { sign = -sign; }
+    }
+  
+  out_val  = val;
+  out_sign = sign;
+  }
+
+
+
+//! ratio of the smallest to the largest pivot magnitude; a rough indicator of conditioning
+template<typename eT>
+inline
+typename sp_chol<eT>::T
+sp_chol<eT>::rcond_estimate() const
+  {
+  arma_debug_sigprint();
+  
+  if(n == 0)  { return T(0); }
+  
+  T min_val = std::abs(D[0]);
+  T max_val = std::abs(D[0]);
+  
+  for(uword k=1; k < n; ++k)
+    {
+    const T val = std::abs(D[k]);
+    
+    min_val = (std::min)(min_val, val);
+    max_val = (std::max)(max_val, val);
+    }
+  
+  return (max_val > T(0)) ? (min_val / max_val) : T(0);
+  }
+
+
+
+//
+// sp_chol_worker
+
+
+template<typename eT>
+inline
+sp_chol_worker<eT>::sp_chol_worker(const sp_chol_opts& in_opts)
+  : opts(in_opts)
+  {
+  arma_debug_sigprint();
+  }
+
+
+
+template<typename eT>
+inline
+bool
+sp_chol_worker<eT>::factorise(const SpMat<eT>& A)
+  {
+  arma_debug_sigprint();
+  
+  chol.analyse(A, opts.ordering);
+  
+  return chol.factorise(A, opts.ldlt);
+  }
+
+
+
+//! reuse the symbolic analysis when the sparsity pattern is unchanged
+template<typename eT>
+inline
+bool
+sp_chol_worker<eT>::refactorise(const SpMat<eT>& A)
+  {
+  arma_debug_sigprint();
+  
+  if(chol.same_pattern(A) == false)  { chol.analyse(A, opts.ordering); }
+  
+  return chol.factorise(A, opts.ldlt);
+  }
+
+
+
+template<typename eT>
+inline
+bool
+sp_chol_worker<eT>::solve(Mat<eT>& X, const Mat<eT>& B) const
+  {
+  arma_debug_sigprint();
+  
+  chol.solve(X, B);
+  
+  return true;
+  }
+
+
+
+template<typename eT>
+inline
+void
+sp_chol_worker<eT>::log_det(T& out_val, T& out_sign) const
+  {
+  arma_debug_sigprint();
+  
+  chol.log_det(out_val, out_sign);
+  }
+
+
+
+template<typename eT>
+inline
+typename sp_chol_worker<eT>::T
+sp_chol_worker<eT>::rcond() const
+  {
+  arma_debug_sigprint();
+  
+  return chol.rcond_estimate();
+  }
+
+
+
+//! @}
@@ -0,0 +1,112 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2026 Dirk Eddelbuettel
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// https://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+
+//! \addtogroup sp_iterative
+//! @{
+
+
+
+//! preconditioners for the iterative sparse solvers
+template<typename eT>
+class sp_precond
+  {
+  public:
+  
+  typedef typename get_pod_type<eT>::result T;
+  
+  inline bool init(const SpMat<eT>& A, const iterative_opts::precond_type in_type);
+  
+  inline void apply(Col<eT>& out, const Col<eT>& in) const;
+  
+  
+  private:
+  
+  iterative_opts::precond_type type = iterative_opts::PRECOND_NONE;
+  
+  uword n = 0;
+  
+  podarray<eT> inv_diag;     // Jacobi
+  
+  podarray<uword> row_ptrs;  // ILU(0) and IC(0) factors, stored row-wise
+  podarray<uword> col_ids;
+  podarray<uword> diag_pos;
+  podarray<eT>    values;
+  
+  inline bool init_jacobi(const SpMat<eT>& A);
+  inline bool init_ilu0  (const SpMat<eT>& A);
+  inline bool init_ic0   (const SpMat<eT>& A);
+  
+  inline void apply_ilu0(eT* x) const;
+  inline void apply_ic0 (eT* x) const;
+  };
+
+
+
+struct sp_iterative
+  {
+  template<typename eT>
+  inline static bool cg(Col<eT>& x, uword& n_iter, typename get_pod_type<eT>::result& rel_res, const spmv_plan<eT>& A, const Col<eT>& b, const sp_precond<eT>& M, const typename get_pod_type<eT>::result tol, const uword max_iter);
+  
+  template<typename eT>
+  inline static bool bicgstab(Col<eT>& x, uword& n_iter, typename get_pod_type<eT>::result& rel_res, const spmv_plan<eT>& A, const Col<eT>& b, const sp_precond<eT>& M, const typename get_pod_type<eT>::result tol, const uword max_iter);
+  
+  template<typename eT>
+  inline static bool gmres(Col<eT>& x, uword& n_iter, typename get_pod_type<eT>::result& rel_res, const spmv_plan<eT>& A, const Col<eT>& b, const sp_precond<eT>& M, const typename get_pod_type<eT>::result tol, const uword max_iter, const uword restart);
+  
+  template<typename eT>
+  inline static bool solve(Mat<eT>& X, const spmv_plan<eT>& A, const Mat<eT>& B, const sp_precond<eT>& M, const iterative_opts& opts);
+  
+  template<typename T1, typename T2>
+  inline static bool apply(Mat<typename T1::elem_type>& out, const SpBase<typename T1::elem_type,T1>& A_expr, const Base<typename T1::elem_type,T2>& B_expr, const iterative_opts& opts);
+  
+  template<typename eT>
+  inline static typename arma_not_cx<eT>::result  cdot(const uword N, const eT* A, const eT* B);
+  
+  template<typename eT>
+  inline static typename arma_cx_only<eT>::result cdot(const uword N, const eT* A, const eT* B);
+  
+  template<typename eT>
+  inline static void givens(typename get_pod_type<eT>::result& c, eT& s, eT& r, const eT a, const eT b);
+  };
+
+
+
+//! holds the matrix and preconditioner for spsolve_factoriser
+template<typename eT>
+class sp_iterative_worker
+  {
+  public:
+  
+  inline sp_iterative_worker(const iterative_opts& in_opts);
+  
+  inline bool factorise(const SpMat<eT>& A);
+  
+  inline bool solve(Mat<eT>& X, const Mat<eT>& B) const;
+  
+  
+  private:
+  
+  const iterative_opts opts;
+  
+  spmv_plan<eT>  A;
+  sp_precond<eT> M;
+  };
+
+
+
+//! @}
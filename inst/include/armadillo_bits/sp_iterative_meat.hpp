@@ -0,0 +1,893 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2026 Dirk Eddelbuettel
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// https://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+
+//! \addtogroup sp_iterative
+//! @{
+
+
+
+//
+// sp_precond
+
+
+template<typename eT>
+inline
+bool
+sp_precond<eT>::init(const SpMat<eT>& A, const iterative_opts::precond_type in_type)
+  {
+  arma_debug_sigprint();
+  
+  type = in_type;
+  n    = A.n_rows;
+  
+  A.sync();
+  
+       if(type == iterative_opts::PRECOND_JACOBI)  { return init_jacobi(A); }
+  else if(type == iterative_opts::PRECOND_ILU0  )  { return init_ilu0(A);   }
+  else if(type == iterative_opts::PRECOND_IC0   )  { return init_ic0(A);    }
+  
+  return true;
+  }
+
+
+
+template<typename eT>
+inline
+bool
+sp_precond<eT>::init_jacobi(const SpMat<eT>& A)
+  {
+  arma_debug_sigprint();
+  
+  inv_diag.set_size(n);
+  
+  for(uword i=0; i < n; ++i)
+    {
+    const eT val = A.at(i,i);
+    
+    if(val == eT(0))  { return false; }
+    
+    inv_diag[i] = eT(1) / val;
+    }
+  
+  return true;
+  }
+
+
+
+//! ILU(0): incomplete LU factorisation restricted to the sparsity pattern of A;
+//! L (unit diagonal, not stored) and U share the row-wise storage of A
+template<typename eT>
+inline
+bool
+sp_precond<eT>::init_ilu0(const SpMat<eT>& A)
+  {
+  arma_debug_sigprint();
+  
+  // the columns of A.st() are the rows of A
+  
+  const SpMat<eT> At = A.st();
+  
+  row_ptrs.set_size(n+1);
+  col_ids.set_size(At.n_nonzero);
+  values.set_size(At.n_nonzero);
+  diag_pos.set_size(n);
+  
+  arrayops::copy(row_ptrs.memptr(), At.col_ptrs,    n+1          );
+  arrayops::copy(col_ids.memptr(),  At.row_indices, At.n_nonzero );
+  arrayops::copy(values.memptr(),   At.values,      At.n_nonzero );
+  
+  podarray<uword> pos(n);
+  
+  pos.fill(At.n_nonzero);
+  
+  uword* row_ptrs_mem = row_ptrs.memptr();
+  uword* col_ids_mem  = col_ids.memptr();
+  eT*    values_mem   = values.memptr();
+  
+  for(uword i=0; i < n; ++i)
+    {
+    const uword row_start = row_ptrs_mem[i];
+    const uword row_end   = row_ptrs_mem[i+1];
+    
+    for(uword p = row_start; p < row_end; ++p)  { pos[col_ids_mem[p]] = p; }
+    
+    uword p = row_start;
+    
+    for(; (p < row_end) && (col_ids_mem[p] < i); ++p)
+      {
+      const uword k = col_ids_mem[p];
+      
+      const eT l_ik = values_mem[p] / values_mem[diag_pos[k]];
+      
+      values_mem[p] = l_ik;
+      
+      for(uword q = diag_pos[k]+1; q < row_ptrs_mem[k+1]; ++q)
+        {
+        const uword target = pos[col_ids_mem[q]];
+        
+        if(target != At.n_nonzero)  { values_mem[target] -= l_ik * values_mem[q]; }
+        }
+      }
+    
+    for(uword q = row_start; q < row_end; ++q)  { pos[col_ids_mem[q]] = At.n_nonzero; }
+    
+    if( (p == row_end) || (col_ids_mem[p] != i) || (values_mem[p] == eT(0)) )  { return false; }
+    
+    diag_pos[i] = p;
+    }
+  
+  return true;
+  }
+
+
+
+//! IC(0): incomplete Cholesky factorisation A ~ L*L^H restricted to the lower triangle of A;
+//! A is assumed to be symmetric (or Hermitian), so row i of the lower triangle is taken from column i of A
+template<typename eT>
+inline
+bool
+sp_precond<eT>::init_ic0(const SpMat<eT>& A)
+  {
+  arma_debug_sigprint();
+  
+  row_ptrs.set_size(n+1);
+  diag_pos.set_size(n);
+  
+  row_ptrs[0] = 0;
+  
+  for(uword i=0; i < n; ++i)
+    {
+    uword count = 0;
+    
+    for(uword p = A.col_ptrs[i]; p < A.col_ptrs[i+1]; ++p)  { count += (A.row_indices[p] <= i) ? uword(1) : uword(0); }
+    
+    row_ptrs[i+1] = row_ptrs[i] + count;
+    }
+  
+  col_ids.set_size(row_ptrs[n]);
+  values.set_size(row_ptrs[n]);
+  
+  uword* col_ids_mem = col_ids.memptr();
+  eT*    values_mem  = values.memptr();
+  
+  for(uword i=0; i < n; ++i)
+    {
+    uword q = row_ptrs[i];
+    
+    for(uword p = A.col_ptrs[i]; (p < A.col_ptrs[i+1]) && (A.row_indices[p] <= i); ++p, ++q)
+      {
+      col_ids_mem[q] = A.row_indices[p];
+      values_mem[q]  = access::alt_conj(A.values[p]);
+      }
+    }
+  
+  for(uword i=0; i < n; ++i)
+    {
+    const uword row_start = row_ptrs[i];
+    const uword row_end   = row_ptrs[i+1];
+    
+    if( (row_start == row_end) || (col_ids_mem[row_end-1] != i) )  { return false; }
+    
+    for(uword p = row_start; p < row_end-1; ++p)
+      {
+      const uword k = col_ids_mem[p];
+      
+      // sum over j < k of L(i,j) * conj(L(k,j)), using the sorted rows i and k
+      
+      eT acc = eT(0);
+      
+      uword pi = row_start;
+      uword pk = row_ptrs[k];
+      
+      const uword pk_end = diag_pos[k];
+      
+      while( (pi < p) && (pk < pk_end) )
+        {
+        const uword ci = col_ids_mem[pi];
+        const uword ck = col_ids_mem[pk];
+        
+             if(ci < ck)  { ++pi; }
+        else if(ck < ci)  { ++pk; }
+        else
+          {
+          acc += values_mem[pi] * access::alt_conj(values_mem[pk]);
+          ++pi;
+          ++pk;
+          }
+        }
+      
+      values_mem[p] = (values_mem[p] - acc) / values_mem[diag_pos[k]];
+      }
+    
+    T d = access::tmp_real(values_mem[row_end-1]);
+    
+    for(uword p = row_start; p < row_end-1; ++p)  { d -= std::norm(values_mem[p]); }
+    
+    if( (d > T(0)) == false )  { return false; }
+    
+    diag_pos[i] = row_end-1;
+    
+    values_mem[row_end-1] = eT(std::sqrt(d));
+    }
+  
+  return true;
+  }
+
+
+
+template<typename eT>
+inline
+void
+sp_precond<eT>::apply_ilu0(eT* x) const
+  {
+  arma_debug_sigprint();
+  
+  const uword* row_ptrs_mem = row_ptrs.memptr();
+  const uword* col_ids_mem  = col_ids.memptr();
+  const eT*    values_mem   = values.memptr();
+  
+  // forward substitution with L (unit diagonal)
+  
+  for(uword i=0; i < n; ++i)
+    {
+    eT acc = x[i];
+    
+    for(uword p = row_ptrs_mem[i]; p < diag_pos[i]; ++p)  { acc -= values_mem[p] * x[col_ids_mem[p]]; }
+    
+    x[i] = acc;
+    }
+  
+  // backward substitution with U
+  
+  for(uword i=n; i-- > 0;)
+    {
+    eT acc = x[i];
+    
+    for(uword p = diag_pos[i]+1; p < row_ptrs_mem[i+1]; ++p)  { acc -= values_mem[p] * x[col_ids_mem[p]]; }
+    
+    x[i] = acc / values_mem[diag_pos[i]];
+    }
+  }
+
+
+
+template<typename eT>
+inline
+void
+sp_precond<eT>::apply_ic0(eT* x) const
+  {
+  arma_debug_sigprint();
+  
+  const uword* row_ptrs_mem = row_ptrs.memptr();
+  const uword* col_ids_mem  = col_ids.memptr();
+  const eT*    values_mem   = values.memptr();
+  
+  // forward substitution with L
+  
+  for(uword i=0; i < n; ++i)
+    {
+    eT acc = x[i];
+    
+    for(uword p = row_ptrs_mem[i]; p < diag_pos[i]; ++p)  { acc -= values_mem[p] * x[col_ids_mem[p]]; }
+    
+    x[i] = acc / values_mem[diag_pos[i]];
+    }
+  
+  // backward substitution with L^H, traversing L by rows
+  
+  for(uword i=n; i-- > 0;)
+    {
+    const eT x_i = x[i] / values_mem[diag_pos[i]];
+    
+    x[i] = x_i;
+    
+    for(uword p = row_ptrs_mem[i]; p < diag_pos[i]; ++p)  { x[col_ids_mem[p]] -= access::alt_conj(values_mem[p]) * x_i; }
+    }
+  }
+
+
+
+template<typename eT>
+inline
+void
+sp_precond<eT>::apply(Col<eT>& out, const Col<eT>& in) const
+  {
+  arma_debug_sigprint();
+  
+  if(&out != &in)  { out = in; }
+  
+  eT* out_mem = out.memptr();
+  
+  if(type == iterative_opts::PRECOND_JACOBI)
+    {
+    const eT* inv_diag_mem = inv_diag.memptr();
+    
+    for(uword i=0; i < n; ++i)  { out_mem[i] *= inv_diag_mem[i]; }
+    }
+  else if(type == iterative_opts::PRECOND_ILU0)  { apply_ilu0(out_mem); }
+  else if(type == iterative_opts::PRECOND_IC0 )  { apply_ic0 (out_mem); }
+  }
+
+
+
+//
+// sp_iterative
+
+
+//! preconditioned conjugate gradient, for symmetric (or Hermitian) positive definite A
+template<typename eT>
+inline
+bool
+sp_iterative::cg(Col<eT>& x, uword& n_iter, typename get_pod_type<eT>::result& rel_res, const spmv_plan<eT>& A, const Col<eT>& b, const sp_precond<eT>& M, const typename get_pod_type<eT>::result tol, const uword max_iter)
+  {
+  arma_debug_sigprint();
+  
+  typedef typename get_pod_type<eT>::result T;
+  
+  const uword N = b.n_elem;
+  
+  x.zeros(N);
+  
+  n_iter  = 0;
+  rel_res = T(0);
+  
+  const T b_norm = norm(b);
+  
+  if(b_norm == T(0))  { return true; }
+  
+  Col<eT> r = b;
+  Col<eT> z(N, arma_nozeros_indicator());
+  Col<eT> q(N, arma_nozeros_indicator());
+  
+  M.apply(z, r);
+  
+  Col<eT> p = z;
+  
+  eT rz = sp_iterative::cdot(N, r.memptr(), z.memptr());
+  
+  rel_res = T(1);
+  
+  while(n_iter < max_iter)
+    {
+    A.apply(q, p);
+    
+    const eT pq = sp_iterative::cdot(N, p.memptr(), q.memptr());
+    
+    if(pq == eT(0))  { break; }
+    
+    const eT alpha = rz / pq;
+    
+    x += alpha * p;
+    r -= alpha * q;
+    
+    ++n_iter;
+    
+    rel_res = norm(r) / b_norm;
+    
+    if(rel_res <= tol)
+      {
+      // confirm with the true residual; restart from it if the recurrence has drifted
+      
+      A.apply(r, x);
+      
+      r = b - r;
+      
+      rel_res = norm(r) / b_norm;
+      
+      if(rel_res <= tol)  { return true; }
+      
+      M.apply(z, r);
+      
+      rz = sp_iterative::cdot(N, r.memptr(), z.memptr());
+      
+      p = z;
+      
+      continue;
+      }
+    
+    M.apply(z, r);
+    
+    const eT rz_new = sp_iterative::cdot(N, r.memptr(), z.memptr());
+    
+    const eT beta = rz_new / rz;
+    
+    rz = rz_new;
+    
+    p = z + beta * p;
+    }
+  
+  return false;
+  }
+
+
+
+//! stabilised bi-conjugate gradient with right preconditioning, for general square A
+template<typename eT>
+inline
+bool
+sp_iterative::bicgstab(Col<eT>& x, uword& n_iter, typename get_pod_type<eT>::result& rel_res, const spmv_plan<eT>& A, const Col<eT>& b, const sp_precond<eT>& M, const typename get_pod_type<eT>::result tol, const uword max_iter)
+  {
+  arma_debug_sigprint();
+  
+  typedef typename get_pod_type<eT>::result T;
+  
+  const uword N = b.n_elem;
+  
+  x.zeros(N);
+  
+  n_iter  = 0;
+  rel_res = T(0);
+  
+  const T b_norm = norm(b);
+  
+  if(b_norm == T(0))  { return true; }
+  
+  Col<eT> r    = b;
+  Col<eT> rhat = b;
+  
+  Col<eT> p(N, fill::zeros);
+  Col<eT> v(N, fill::zeros);
+  
+  Col<eT> phat(N, arma_nozeros_indicator());
+  Col<eT> s   (N, arma_nozeros_indicator());
+  Col<eT> shat(N, arma_nozeros_indicator());
+  Col<eT> t   (N, arma_nozeros_indicator());
+  
+  eT rho   = eT(1);
+  eT alpha = eT(1);
+  eT omega = eT(1);
+  
+  rel_res = T(1);
+  
+  while(n_iter < max_iter)
+    {
+    const eT rho_new = sp_iterative::cdot(N, rhat.memptr(), r.memptr());
+    
+    if(rho_new == eT(0))  { break; }
+    
+    const eT beta = (rho_new / rho) * (alpha / omega);
+    
+    rho = rho_new;
+    
+    p = r + beta * (p - omega * v);
+    
+    M.apply(phat, p);
+    
+    A.apply(v, phat);
+    
+    const eT rhat_v = sp_iterative::cdot(N, rhat.memptr(), v.memptr());
+    
+    if(rhat_v == eT(0))  { break; }
+    
+    alpha = rho / rhat_v;
+    
+    s = r - alpha * v;
+    
+    ++n_iter;
+    
+    bool check = false;
+    
+    if( (norm(s) / b_norm) <= tol )
+      {
+      x += alpha * phat;
+      
+      check = true;
+      }
+    else
+      {
+      M.apply(shat, s);
+      
+      A.apply(t, shat);
+      
+      const T t_t = access::tmp_real( sp_iterative::cdot(N, t.memptr(), t.memptr()) );
+      
+      if(t_t == T(0))  { break; }
+      
+      omega = sp_iterative::cdot(N, t.memptr(), s.memptr()) / t_t;
+      
+      x += alpha * phat + omega * shat;
+      
+      r = s - omega * t;
+      
+      rel_res = norm(r) / b_norm;
+      
+      check = (rel_res <= tol);
+      
+      if( (check == false) && (omega == eT(0)) )  { break; }
+      }
+    
+    if(check)
+      {
+      // confirm with the true residual; restart from it if the recurrence has drifted
+      
+      A.apply(r, x);
+      
+      r = b - r;
+      
+      rel_res = norm(r) / b_norm;
+      
+      if(rel_res <= tol)  { return true; }
+      
+      rhat = r;
+      
+      rho   = eT(1);
+      alpha = eT(1);
+      omega = eT(1);
+      
+      p.zeros();
+      v.zeros();
+      }
+    }
+  
+  return false;
+  }
+
+
+
+template<typename eT>
+inline
+typename arma_not_cx<eT>::result
+sp_iterative::cdot(const uword N, const eT* A, const eT* B)
+  {
+  return op_dot::direct_dot(N, A, B);
+  }
+
+
+
+template<typename eT>
+inline
+typename arma_cx_only<eT>::result
+sp_iterative::cdot(const uword N, const eT* A, const eT* B)
+  {
+  return op_cdot::direct_cdot(N, A, B);
+  }
+
+
+
+//! Givens rotation [c s; -conj(s) c] with real c, such that applying it to [a; b] gives [r; 0]
+template<typename eT>
+inline
+void
+sp_iterative::givens(typename get_pod_type<eT>::result& c, eT& s, eT& r, const eT a, const eT b)
+  {
+  typedef typename get_pod_type<eT>::result T;
+  
+  const T abs_a = std::abs(a);
+  const T abs_b = std::abs(b);
+  
+  if(abs_b == T(0))
+    {
+    c = T(1);
+    s = eT(0);
+    r = a;
+    }
+  else
+  if(abs_a == T(0))
+    {
+    c = T(0);
+    s = access::alt_conj(b) / abs_b;
+    r = eT(abs_b);
+    }
+  else
+    {
+    const T  nrm  = std::hypot(abs_a, abs_b);
+    const eT sign = a / abs_a;
+    
+    c = abs_a / nrm;
+    s = sign * access::alt_conj(b) / nrm;
+    r = sign * nrm;
+    }
+  }
+
+
+
+//! restarted GMRES with right preconditioning, for general square A;
+//! Arnoldi uses modified Gram-Schmidt, and the least-squares problem is updated with Givens rotations
+template<typename eT>
+inline
+bool
+sp_iterative::gmres(Col<eT>& x, uword& n_iter, typename get_pod_type<eT>::result& rel_res, const spmv_plan<eT>& A, const Col<eT>& b, const sp_precond<eT>& M, const typename get_pod_type<eT>::result tol, const uword max_iter, const uword restart)
+  {
+  arma_debug_sigprint();
+  
+  typedef typename get_pod_type<eT>::result T;
+  
+  const uword N = b.n_elem;
+  const uword m = (std::max)(uword(1), (std::min)(restart, N));
+  
+  x.zeros(N);
+  
+  n_iter  = 0;
+  rel_res = T(0);
+  
+  const T b_norm = norm(b);
+  
+  if(b_norm == T(0))  { return true; }
+  
+  Mat<eT> V(N, m+1, arma_nozeros_indicator());
+  Mat<eT> H(m+1, m, arma_nozeros_indicator());
+  
+  Col<T>  cs(m, arma_nozeros_indicator());
+  Col<eT> sn(m, arma_nozeros_indicator());
+  Col<eT> g(m+1, arma_nozeros_indicator());
+  Col<eT> y(m, arma_nozeros_indicator());
+  
+  Col<eT> r(N, arma_nozeros_indicator());
+  Col<eT> w(N, arma_nozeros_indicator());
+  Col<eT> z(N, arma_nozeros_indicator());
+  
+  bool converged = false;
+  
+  while( (converged == false) && (n_iter < max_iter) )
+    {
+    A.apply(r, x);
+    
+    r = b - r;
+    
+    const T beta = norm(r);
+    
+    rel_res = beta / b_norm;
+    
+    if(rel_res <= tol)  { converged = true; break; }
+    
+    V.col(0) = r / beta;
+    
+    H.zeros();
+    g.zeros();
+    
+    g[0] = eT(beta);
+    
+    uword k = 0;
+    
+    for(uword j=0; j < m; ++j)
+      {
+      Col<eT> v_j(V.colptr(j), N, false, true);
+      
+      M.apply(z, v_j);
+      
+      A.apply(w, z);
+      
+      for(uword i=0; i <= j; ++i)
+        {
+        const eT h_ij = sp_iterative::cdot(N, V.colptr(i), w.memptr());
+        
+        H.at(i,j) = h_ij;
+        
+        const eT* v_i   = V.colptr(i);
+              eT* w_mem = w.memptr();
+        
+        for(uword l=0; l < N; ++l)  { w_mem[l] -= h_ij * v_i[l]; }
+        }
+      
+      const T h_next = norm(w);
+      
+      H.at(j+1,j) = eT(h_next);
+      
+      if(h_next > T(0))  { V.col(j+1) = w / h_next; }
+      
+      for(uword i=0; i < j; ++i)
+        {
+        const eT h_i  = H.at(i,  j);
+        const eT h_i1 = H.at(i+1,j);
+        
+        H.at(i,  j) =  cs[i] * h_i + sn[i] * h_i1;
+        H.at(i+1,j) = -access::alt_conj(sn[i]) * h_i + cs[i] * h_i1;
+        }
+      
+      eT r_jj;
+      
+      sp_iterative::givens(cs[j], sn[j], r_jj, H.at(j,j), H.at(j+1,j));
+      
+      H.at(j,  j) = r_jj;
+      H.at(j+1,j) = eT(0);
+      
+      g[j+1] = -access::alt_conj(sn[j]) * g[j];
+      g[j]   = cs[j] * g[j];
+      
+      ++n_iter;
+      
+      k = j+1;
+      
+      rel_res = std::abs(g[j+1]) / b_norm;
+      
+      if(rel_res <= tol)  { converged = true; }
+      
+      if( converged || (n_iter >= max_iter) || (h_next == T(0)) )  { break; }
+      }
+    
+    // solve the upper triangular system H(0:k-1,0:k-1) y = g(0:k-1)
+    
+    for(uword i=k; i-- > 0;)
+      {
+      eT acc = g[i];
+      
+      for(uword l=i+1; l < k; ++l)  { acc -= H.at(i,l) * y[l]; }
+      
+      y[i] = acc / H.at(i,i);
+      }
+    
+    w = V.cols(0,k-1) * y.head(k);
+    
+    M.apply(z, w);
+    
+    x += z;
+    }
+  
+  if(converged)
+    {
+    // guard against loss of accuracy in the implicit residual
+    
+    A.apply(r, x);
+    
+    rel_res = norm(b - r) / b_norm;
+    
+    converged = (rel_res <= T(10) * tol);
+    }
+  
+  return converged;
+  }
+
+
+
+template<typename eT>
+inline
+bool
+sp_iterative::solve(Mat<eT>& X, const spmv_plan<eT>& A, const Mat<eT>& B, const sp_precond<eT>& M, const iterative_opts& opts)
+  {
+  arma_debug_sigprint();
+  
+  typedef typename get_pod_type<eT>::result T;
+  
+  const uword N = A.n_rows;
+  
+  const T     tol      = (std::max)( T(opts.tol), T(4) * std::numeric_limits<T>::epsilon() );
+  const uword max_iter = (opts.max_iter > 0) ? uword(opts.max_iter) : (std::max)(uword(1000), N);
+  const uword restart  = (opts.restart  > 0) ? uword(opts.restart)  : uword(50);
+  
+  X.set_size(N, B.n_cols);
+  
+  uword max_n_iter  = 0;
+  T     max_rel_res = T(0);
+  bool  status      = true;
+  
+  Col<eT> x(N, arma_nozeros_indicator());
+  
+  for(uword col=0; col < B.n_cols; ++col)
+    {
+    const Col<eT> b(const_cast<eT*>(B.colptr(col)), N, false, true);
+    
+    uword n_iter  = 0;
+    T     rel_res = T(0);
+    
+    bool col_status = false;
+    
+         if(opts.solver == iterative_opts::CG      )  { col_status = sp_iterative::cg      (x, n_iter, rel_res, A, b, M, tol, max_iter);          }
+    else if(opts.solver == iterative_opts::BICGSTAB)  { col_status = sp_iterative::bicgstab(x, n_iter, rel_res, A, b, M, tol, max_iter);          }
+    else if(opts.solver == iterative_opts::GMRES   )  { col_status = sp_iterative::gmres   (x, n_iter, rel_res, A, b, M, tol, max_iter, restart); }
+    
+    arrayops::copy(X.colptr(col), x.memptr(), N);
+    
+    max_n_iter  = (std::max)(max_n_iter, n_iter);
+    max_rel_res = (arma_isnan(rel_res)) ? rel_res : (std::max)(max_rel_res, rel_res);
+    
+    status = status && col_status;
+    }
+  
+  if(opts.stats != nullptr)
+    {
+    (*opts.stats).n_iter    = (unsigned int)(max_n_iter);
+    (*opts.stats).residual  = double(max_rel_res);
+    (*opts.stats).converged = status;
+    }
+  
+  if(status == false)
+    {
+    arma_warn(2, "spsolve(): iterative solver did not converge; iterations: ", max_n_iter, "; relative residual: ", max_rel_res);
+    }
+  
+  return status;
+  }
+
+
+
+template<typename T1, typename T2>
+inline
+bool
+sp_iterative::apply(Mat<typename T1::elem_type>& out, const SpBase<typename T1::elem_type,T1>& A_expr, const Base<typename T1::elem_type,T2>& B_expr, const iterative_opts& opts)
+  {
+  arma_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  
+  const unwrap_spmat<T1> UA(A_expr.get_ref());
+  const SpMat<eT>& A   = UA.M;
+  
+  const quasi_unwrap<T2> UB(B_expr.get_ref());
+  const Mat<eT>& B     = UB.M;
+  
+  arma_conform_check( (A.is_square() == false), "spsolve(): matrix A must be square sized" );
+  
+  arma_conform_assert_mul_size(A.n_rows, A.n_cols, B.n_rows, B.n_cols, "spsolve()");
+  
+  sp_precond<eT> M;
+  
+  if(M.init(A, opts.precond) == false)
+    {
+    arma_warn(2, "spsolve(): preconditioner could not be constructed");
+    return false;
+    }
+  
+  const spmv_plan<eT> P(A, "csr");
+  
+  if(UB.is_alias(out))
+    {
+    Mat<eT> tmp;
+    
+    const bool status = sp_iterative::solve(tmp, P, B, M, opts);
+    
+    out.steal_mem(tmp);
+    
+    return status;
+    }
+  
+  return sp_iterative::solve(out, P, B, M, opts);
+  }
+
+
+
+//
+// sp_iterative_worker
+
+
+template<typename eT>
+inline
+sp_iterative_worker<eT>::sp_iterative_worker(const iterative_opts& in_opts)
+  : opts(in_opts)
+  {
+  arma_debug_sigprint();
+  }
+
+
+
+template<typename eT>
+inline
+bool
+sp_iterative_worker<eT>::factorise(const SpMat<eT>& in_A)
+  {
+  arma_debug_sigprint();
+  
+  A.inspect(in_A, "csr");
+  
+  return M.init(in_A, opts.precond);
+  }
+
+
+
+template<typename eT>
+inline
+bool
+sp_iterative_worker<eT>::solve(Mat<eT>& X, const Mat<eT>& B) const
+  {
+  arma_debug_sigprint();
+  
+  return sp_iterative::solve(X, A, B, M, opts);
+  }
+
+
+
+//! @}
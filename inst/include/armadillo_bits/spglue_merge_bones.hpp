@@ -34,6 +34,9 @@ struct spglue_merge
   
   template<typename eT>
   inline static void diagview_merge(SpMat<eT>& out, const SpMat<eT>& A, const SpMat<eT>& B);
+  
+  template<typename spglue_type, typename eT>
+  inline static void elem_merge_omp(SpMat<eT>& out, const SpMat<eT>& A, const SpMat<eT>& B);
   };
 
 
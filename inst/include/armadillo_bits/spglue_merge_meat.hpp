@@ -551,4 +551,120 @@ spglue_merge::diagview_merge(SpMat<eT>& out, const SpMat<eT>& A, const SpMat<eT>
 
 
 
+//! element-wise merge of two sparse matrices, parallelised over columns;
+//! the number of non-zeros in each output column is found first, so that all columns can then be written independently;
+//! spglue_type provides merge_both(), merge_A_only() and merge_B_only() to combine the elements;
+//! the output is identical to the serial merge
+template<typename spglue_type, typename eT>
+inline
+void
+spglue_merge::elem_merge_omp(SpMat<eT>& out, const SpMat<eT>& A, const SpMat<eT>& B)
+  {
+  arma_debug_sigprint();
+  
+  #if defined(ARMA_USE_OPENMP)
+    {
+    A.sync();
+    B.sync();
+    
+    const uword n_rows = A.n_rows;
+    const uword n_cols = A.n_cols;
+    
+    const uword* A_col_ptrs    = A.col_ptrs;
+    const uword* A_row_indices = A.row_indices;
+    const eT*    A_values      = A.values;
+    
+    const uword* B_col_ptrs    = B.col_ptrs;
+    const uword* B_row_indices = B.row_indices;
+    const eT*    B_values      = B.values;
+    
+    uword* out_row_indices = nullptr;
+    eT*    out_values      = nullptr;
+    
+    // returns the number of non-zeros in the output column; the elements are only stored when write is true
+    const auto merge_col = [&](const uword col, const bool write, const uword pos) -> uword
+      {
+      uword ia = A_col_ptrs[col];
+      uword ib = B_col_ptrs[col];
+      
+      const uword ia_end = A_col_ptrs[col+1];
+      const uword ib_end = B_col_ptrs[col+1];
+      
+      uword count = 0;
+      
+      while( (ia < ia_end) || (ib < ib_end) )
+        {
+        const uword row_a = (ia < ia_end) ? A_row_indices[ia] : n_rows;
+        const uword row_b = (ib < ib_end) ? B_row_indices[ib] : n_rows;
+        
+        uword row;
+        eT    val;
+        
+        if(row_a == row_b)
+          {
+          row = row_a;
+          val = spglue_type::merge_both(A_values[ia], B_values[ib]);
+          
+          ++ia;
+          ++ib;
+          }
+        else
+        if(row_a < row_b)
+          {
+          row = row_a;
+          val = spglue_type::merge_A_only(A_values[ia]);
+          
+          ++ia;
+          }
+        else
+          {
+          row = row_b;
+          val = spglue_type::merge_B_only(B_values[ib]);
+          
+          ++ib;
+          }
+        
+        if(val != eT(0))
+          {
+          if(write)  { out_row_indices[pos + count] = row; out_values[pos + count] = val; }
+          
+          ++count;
+          }
+        }
+      
+      return count;
+      };
+    
+    const int n_threads = mp_thread_limit::get();
+    
+    podarray<uword> col_counts(n_cols + 1);
+    
+    col_counts[0] = 0;
+    
+    #pragma omp parallel for schedule(dynamic, 64) num_threads(n_threads)
+    for(uword col=0; col < n_cols; ++col)  { col_counts[col+1] = merge_col(col, false, 0); }
+    
+    for(uword col=0; col < n_cols; ++col)  { col_counts[col+1] += col_counts[col]; }
+    
+    out.reserve(n_rows, n_cols, col_counts[n_cols]);
+    
+    arrayops::copy(access::rwp(out.col_ptrs), col_counts.memptr(), n_cols + 1);
+    
+    out_row_indices = access::rwp(out.row_indices);
+    out_values      = access::rwp(out.values);
+    
+    #pragma omp parallel for schedule(dynamic, 64) num_threads(n_threads)
+    for(uword col=0; col < n_cols; ++col)  { merge_col(col, true, col_counts[col]); }
+    }
+  #else
+    {
+    arma_ignore(out);
+    arma_ignore(A);
+    arma_ignore(B);
+    }
+  #endif
+  }
+
+
+
 //! @}
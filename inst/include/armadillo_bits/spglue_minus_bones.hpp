@@ -35,6 +35,10 @@ struct spglue_minus
   
   template<typename eT>
   inline static void apply_noalias(SpMat<eT>& out, const SpMat<eT>& A, const SpMat<eT>& B);
+  
+  template<typename eT> arma_inline static eT merge_both  (const eT a, const eT b) { return a - b; }
+  template<typename eT> arma_inline static eT merge_A_only(const eT a)             { return a; }
+  template<typename eT> arma_inline static eT merge_B_only(const eT b)             { return -b; }
   };
 
 
@@ -80,6 +80,20 @@ spglue_plus::apply_noalias(SpMat<eT>& out, const SpProxy<T1>& pa, const SpProxy<
   
   const uword max_n_nonzero = pa.get_n_nonzero() + pb.get_n_nonzero();
   
+  const bool direct_mem = (is_SpMat<typename SpProxy<T1>::stored_type>::value) && (is_SpMat<typename SpProxy<T2>::stored_type>::value);
+  
+  if( (direct_mem) && (arma_config::openmp) && (mp_thread_limit::in_parallel() == false) && (pa.get_n_cols() >= 2) && mp_gate<eT>::eval(max_n_nonzero) )
+    {
+    arma_debug_print("openmp implementation");
+    
+    const unwrap_spmat<typename SpProxy<T1>::stored_type> UA(pa.Q);
+    const unwrap_spmat<typename SpProxy<T2>::stored_type> UB(pb.Q);
+    
+    spglue_merge::elem_merge_omp<spglue_plus>(out, UA.M, UB.M);
+    
+    return;
+    }
+  
   // Resize memory to upper bound
   out.reserve(pa.get_n_rows(), pa.get_n_cols(), max_n_nonzero);
   
@@ -30,11 +30,28 @@ struct spglue_schur
   template<typename T1, typename T2>
   inline static void apply(SpMat_noalias<typename T1::elem_type>& out, const SpGlue<T1,T2,spglue_schur>& X);
   
+  template<typename T1, typename T2, typename T3>
+  inline static void apply(SpMat<typename T1::elem_type>& out, const SpGlue<SpGlue<T1,T2,spglue_times>,T3,spglue_schur>& X);
+  
+  template<typename T1, typename T2, typename T3>
+  inline static void apply(SpMat<typename T1::elem_type>& out, const SpGlue<T1,SpGlue<T2,T3,spglue_times>,spglue_schur>& X);
+  
+  template<typename T1, typename T2, typename T3, typename T4>
+  inline static void apply(SpMat<typename T1::elem_type>& out, const SpGlue<SpGlue<T1,T2,spglue_times>,SpGlue<T3,T4,spglue_times>,spglue_schur>& X);
+  
+  template<typename eT>
+  inline static void apply_masked(SpMat<eT>& out, const SpMat<eT>& A, const SpMat<eT>& B, const SpMat<eT>& M);
+  
   template<typename eT, typename T1, typename T2>
   inline static void apply_noalias(SpMat<eT>& out, const SpProxy<T1>& pa, const SpProxy<T2>& pb);
   
   template<typename eT>
   inline static void apply_noalias(SpMat<eT>& out, const SpMat<eT>& A, const SpMat<eT>& B);
+  
+  // multiplication by zero is kept so that inf and nan give nan
+  template<typename eT> arma_inline static eT merge_both  (const eT a, const eT b) { return a * b; }
+  template<typename eT> arma_inline static eT merge_A_only(const eT a)             { return a * eT(0); }
+  template<typename eT> arma_inline static eT merge_B_only(const eT b)             { return eT(0) * b; }
   };
 
 
@@ -66,6 +66,83 @@ spglue_schur::apply(SpMat_noalias<typename T1::elem_type>& out, const SpGlue<T1,
 
 
 
+//! (A*B) % M is evaluated as a masked product, without forming A*B
+template<typename T1, typename T2, typename T3>
+inline
+void
+spglue_schur::apply(SpMat<typename T1::elem_type>& out, const SpGlue<SpGlue<T1,T2,spglue_times>,T3,spglue_schur>& X)
+  {
+  arma_debug_sigprint();
+  
+  const unwrap_spmat<T1> UA(X.A.A);
+  const unwrap_spmat<T2> UB(X.A.B);
+  const unwrap_spmat<T3> UM(X.B);
+  
+  spglue_schur::apply_masked(out, UA.M, UB.M, UM.M);
+  }
+
+
+
+//! M % (A*B), as above
+template<typename T1, typename T2, typename T3>
+inline
+void
+spglue_schur::apply(SpMat<typename T1::elem_type>& out, const SpGlue<T1,SpGlue<T2,T3,spglue_times>,spglue_schur>& X)
+  {
+  arma_debug_sigprint();
+  
+  const unwrap_spmat<T1> UM(X.A);
+  const unwrap_spmat<T2> UA(X.B.A);
+  const unwrap_spmat<T3> UB(X.B.B);
+  
+  spglue_schur::apply_masked(out, UA.M, UB.M, UM.M);
+  }
+
+
+
+//! (A*B) % (C*D): C*D is evaluated and used as the mask
+template<typename T1, typename T2, typename T3, typename T4>
+inline
+void
+spglue_schur::apply(SpMat<typename T1::elem_type>& out, const SpGlue<SpGlue<T1,T2,spglue_times>,SpGlue<T3,T4,spglue_times>,spglue_schur>& X)
+  {
+  arma_debug_sigprint();
+  
+  const unwrap_spmat<T1> UA(X.A.A);
+  const unwrap_spmat<T2> UB(X.A.B);
+  
+  const unwrap_spmat< SpGlue<T3,T4,spglue_times> > UM(X.B);
+  
+  spglue_schur::apply_masked(out, UA.M, UB.M, UM.M);
+  }
+
+
+
+template<typename eT>
+inline
+void
+spglue_schur::apply_masked(SpMat<eT>& out, const SpMat<eT>& A, const SpMat<eT>& B, const SpMat<eT>& M)
+  {
+  arma_debug_sigprint();
+  
+  const bool is_alias = (&out == &A) || (&out == &B) || (&out == &M);
+  
+  if(is_alias == false)
+    {
+    spglue_times::apply_masked(out, A, B, M);
+    }
+  else
+    {
+    SpMat<eT> tmp;
+    
+    spglue_times::apply_masked(tmp, A, B, M);
+    
+    out.steal_mem(tmp);
+    }
+  }
+
+
+
 template<typename eT, typename T1, typename T2>
 inline
 void
@@ -83,6 +160,20 @@ spglue_schur::apply_noalias(SpMat<eT>& out, const SpProxy<T1>& pa, const SpProxy
   
   const uword max_n_nonzero = pa.get_n_nonzero() + pb.get_n_nonzero();
   
+  const bool direct_mem = (is_SpMat<typename SpProxy<T1>::stored_type>::value) && (is_SpMat<typename SpProxy<T2>::stored_type>::value);
+  
+  if( (direct_mem) && (arma_config::openmp) && (mp_thread_limit::in_parallel() == false) && (pa.get_n_cols() >= 2) && mp_gate<eT>::eval(max_n_nonzero) )
+    {
+    arma_debug_print("openmp implementation");
+    
+    const unwrap_spmat<typename SpProxy<T1>::stored_type> UA(pa.Q);
+    const unwrap_spmat<typename SpProxy<T2>::stored_type> UB(pb.Q);
+    
+    spglue_merge::elem_merge_omp<spglue_schur>(out, UA.M, UB.M);
+    
+    return;
+    }
+  
   // Resize memory to upper bound
   out.reserve(pa.get_n_rows(), pa.get_n_cols(), max_n_nonzero);
   
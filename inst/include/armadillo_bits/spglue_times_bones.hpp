@@ -45,6 +45,14 @@ struct spglue_times
   
   template<typename eT>
   inline static void apply_noalias(SpMat<eT>& c, const SpMat<eT>& x, const SpMat<eT>& y);
+  
+  template<typename eT>
+  inline static void apply_masked(SpMat<eT>& c, const SpMat<eT>& x, const SpMat<eT>& y, const SpMat<eT>& m);
+  
+  template<typename eT>
+  inline static void apply_gustavson(SpMat<eT>& c, const SpMat<eT>& x, const SpMat<eT>& y, const SpMat<eT>* m, const bool use_mp);
+  
+  inline static bool use_mp(const uword x_n_nonzero, const uword y_n_nonzero);
   };
 
 
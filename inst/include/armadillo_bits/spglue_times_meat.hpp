@@ -129,6 +129,13 @@ spglue_times::apply_noalias(SpMat<eT>& c, const SpMat<eT>& x, const SpMat<eT>& y
   
   arma_conform_assert_mul_size(x_n_rows, x_n_cols, y_n_rows, y_n_cols, "matrix multiplication");
   
+  if(spglue_times::use_mp(x.n_nonzero, y.n_nonzero))
+    {
+    spglue_times::apply_gustavson(c, x, y, static_cast<const SpMat<eT>*>(nullptr), true);
+    
+    return;
+    }
+  
   // First we must determine the structure of the new matrix (column pointers).
   // This follows the algorithm described in 'Sparse Matrix Multiplication
   // Package (SMMP)' (R.E. Bank and C.C. Douglas, 2001).  Their description of
@@ -321,6 +328,503 @@ spglue_times::apply_noalias(SpMat<eT>& c, const SpMat<eT>& x, const SpMat<eT>& y
 
 
 
+inline
+bool
+spglue_times::use_mp(const uword x_n_nonzero, const uword y_n_nonzero)
+  {
+  return (arma_config::openmp) && ((x_n_nonzero + y_n_nonzero) >= uword(16384)) && (mp_thread_limit::in_parallel() == false) && (mp_thread_limit::get() > 1);
+  }
+
+
+
+//! masked product: c = (x*y) % m, where only the elements of x*y at the nonzero locations of m are computed;
+//! useful for triangle counting, ie. accu((A*A) % A)
+template<typename eT>
+inline
+void
+spglue_times::apply_masked(SpMat<eT>& c, const SpMat<eT>& x, const SpMat<eT>& y, const SpMat<eT>& m)
+  {
+  arma_debug_sigprint();
+  
+  arma_conform_assert_mul_size(x.n_rows, x.n_cols, y.n_rows, y.n_cols, "matrix multiplication");
+  
+  arma_conform_assert_same_size(x.n_rows, y.n_cols, m.n_rows, m.n_cols, "element-wise multiplication");
+  
+  spglue_times::apply_gustavson(c, x, y, &m, spglue_times::use_mp(x.n_nonzero, y.n_nonzero));
+  }
+
+
+
+//! column-wise (Gustavson) product, optionally in parallel over blocks of output columns.
+//! The columns are split into blocks with roughly equal numbers of multiply-adds.
+//! Each thread uses a dense accumulator when the number of rows is modest, and a hash accumulator otherwise.
+//! A symbolic pass determines the column pointers, after which the numeric pass writes directly into the output;
+//! elements that evaluate to zero are removed afterwards.
+//! When m is given, only elements at the nonzero locations of m are computed, and the result is multiplied by m.
+template<typename eT>
+inline
+void
+spglue_times::apply_gustavson(SpMat<eT>& c, const SpMat<eT>& x, const SpMat<eT>& y, const SpMat<eT>* m, const bool use_mp)
+  {
+  arma_debug_sigprint();
+  
+  x.sync();
+  y.sync();
+  
+  if(m != nullptr)  { (*m).sync(); }
+  
+  const uword x_n_rows = x.n_rows;
+  const uword y_n_cols = y.n_cols;
+  
+  c.zeros(x_n_rows, y_n_cols);
+  
+  if( (x.n_nonzero == 0) || (y.n_nonzero == 0) )  { return; }
+  
+  if( (m != nullptr) && ((*m).n_nonzero == 0) )  { return; }
+  
+  const uword* x_col_ptrs    = x.col_ptrs;
+  const uword* x_row_indices = x.row_indices;
+  const eT*    x_values      = x.values;
+  
+  const uword* y_col_ptrs    = y.col_ptrs;
+  const uword* y_row_indices = y.row_indices;
+  const eT*    y_values      = y.values;
+  
+  const uword* m_col_ptrs    = (m != nullptr) ? (*m).col_ptrs    : nullptr;
+  const uword* m_row_indices = (m != nullptr) ? (*m).row_indices : nullptr;
+  const eT*    m_values      = (m != nullptr) ? (*m).values      : nullptr;
+  
+  // cumulative number of multiply-adds per output column
+  
+  podarray<uword> flops(y_n_cols + 1);
+  
+  flops[0] = 0;
+  
+  for(uword col=0; col < y_n_cols; ++col)
+    {
+    uword acc = 0;
+    
+    for(uword k = y_col_ptrs[col]; k < y_col_ptrs[col+1]; ++k)
+      {
+      const uword y_row = y_row_indices[k];
+      
+      acc += x_col_ptrs[y_row + 1] - x_col_ptrs[y_row];
+      }
+    
+    flops[col+1] = flops[col] + acc;
+    }
+  
+  const uword total_flops = flops[y_n_cols];
+  
+  if(total_flops == 0)  { return; }
+  
+  #if defined(ARMA_USE_OPENMP)
+    const int n_threads = (use_mp) ? mp_thread_limit::get() : int(1);
+  #else
+    const int n_threads = 1;
+    arma_ignore(use_mp);
+  #endif
+  
+  // partition the output columns into blocks with similar amounts of work
+  
+  const uword n_parts = (std::min)(y_n_cols, uword(8 * n_threads));
+  
+  podarray<uword> part_start(n_parts + 1);
+  
+  part_start[0]       = 0;
+  part_start[n_parts] = y_n_cols;
+  
+  for(uword part=1; part < n_parts; ++part)
+    {
+    const uword target = (total_flops / n_parts) * part;
+    
+    const uword col = uword(std::lower_bound(flops.memptr(), flops.memptr() + y_n_cols + 1, target) - flops.memptr());
+    
+    part_start[part] = (std::max)(part_start[part-1], (std::min)(col, y_n_cols));
+    }
+  
+  // dense accumulators need n_rows elements per thread
+  
+  const bool use_dense = ( (x_n_rows * uword(n_threads)) <= (uword(1) << 22) );
+  
+  const uword stamp_none = (std::numeric_limits<uword>::max)();
+  
+  podarray<uword> dense_stamp( (use_dense) ? (x_n_rows * uword(n_threads)) : uword(0) );
+  podarray<eT>    dense_sums ( (use_dense) ? (x_n_rows * uword(n_threads)) : uword(0) );
+  
+  if(use_dense)  { dense_stamp.fill(stamp_none); }
+  
+  const auto for_each_part = [&](const auto& worker)
+    {
+    #if defined(ARMA_USE_OPENMP)
+      {
+      if(n_threads > 1)
+        {
+        #pragma omp parallel for schedule(dynamic) num_threads(n_threads)
+        for(uword part=0; part < n_parts; ++part)
+          {
+          worker(part, uword(omp_get_thread_num()));
+          }
+        
+        return;
+        }
+      }
+    #endif
+    
+    for(uword part=0; part < n_parts; ++part)  { worker(part, uword(0)); }
+    };
+  
+  // hash table for columns with at most n_max distinct rows; the table is at most half full
+  
+  const auto hash_size = [&](const uword n_max) -> uword
+    {
+    uword n = 16;
+    
+    while(n < 2*n_max)  { n *= 2; }
+    
+    return n;
+    };
+  
+  const auto hash_find = [](const uword* keys, const uword mask, const uword key, const uword empty) -> uword
+    {
+    uword pos = (key * uword(2654435761U)) & mask;
+    
+    while( (keys[pos] != key) && (keys[pos] != empty) )  { pos = (pos + 1) & mask; }
+    
+    return pos;
+    };
+  
+  // symbolic pass: number of elements in each output column
+  
+  if(m == nullptr)
+    {
+    const auto symbolic_worker = [&](const uword part, const uword thread_id)
+      {
+      const uword col_start = part_start[part];
+      const uword col_end   = part_start[part+1];
+      
+      if(col_start == col_end)  { return; }
+      
+      if(use_dense)
+        {
+        uword* stamp = dense_stamp.memptr() + thread_id * x_n_rows;
+        
+        for(uword col = col_start; col < col_end; ++col)
+          {
+          uword count = 0;
+          
+          for(uword k = y_col_ptrs[col]; k < y_col_ptrs[col+1]; ++k)
+            {
+            const uword y_row = y_row_indices[k];
+            
+            for(uword l = x_col_ptrs[y_row]; l < x_col_ptrs[y_row + 1]; ++l)
+              {
+              const uword row = x_row_indices[l];
+              
+              if(stamp[row] != col)  { stamp[row] = col; ++count; }
+              }
+            }
+          
+          access::rw(c.col_ptrs[col + 1]) = count;
+          }
+        }
+      else
+        {
+        uword max_flops = 0;
+        
+        for(uword col = col_start; col < col_end; ++col)  { max_flops = (std::max)(max_flops, flops[col+1] - flops[col]); }
+        
+        podarray<uword> keys( hash_size((std::min)(max_flops, x_n_rows)) );
+        
+        for(uword col = col_start; col < col_end; ++col)
+          {
+          const uword col_flops = flops[col+1] - flops[col];
+          
+          if(col_flops == 0)  { access::rw(c.col_ptrs[col + 1]) = 0; continue; }
+          
+          const uword n_keys = hash_size((std::min)(col_flops, x_n_rows));
+          const uword mask   = n_keys - 1;
+          
+          arrayops::inplace_set(keys.memptr(), x_n_rows, n_keys);
+          
+          uword count = 0;
+          
+          for(uword k = y_col_ptrs[col]; k < y_col_ptrs[col+1]; ++k)
+            {
+            const uword y_row = y_row_indices[k];
+            
+            for(uword l = x_col_ptrs[y_row]; l < x_col_ptrs[y_row + 1]; ++l)
+              {
+              const uword row = x_row_indices[l];
+              const uword pos = hash_find(keys.memptr(), mask, row, x_n_rows);
+              
+              if(keys[pos] == x_n_rows)  { keys[pos] = row; ++count; }
+              }
+            }
+          
+          access::rw(c.col_ptrs[col + 1]) = count;
+          }
+        }
+      };
+    
+    for_each_part(symbolic_worker);
+    }
+  else
+    {
+    // the structure of the result is a subset of the structure of the mask
+    
+    for(uword col=0; col < y_n_cols; ++col)
+      {
+      const bool active = (flops[col+1] != flops[col]);
+      
+      access::rw(c.col_ptrs[col + 1]) = (active) ? (m_col_ptrs[col+1] - m_col_ptrs[col]) : uword(0);
+      }
+    }
+  
+  for(uword col=0; col < y_n_cols; ++col)  { access::rw(c.col_ptrs[col + 1]) += c.col_ptrs[col]; }
+  
+  const uword max_n_nonzero = c.col_ptrs[y_n_cols];
+  
+  c.mem_resize(max_n_nonzero);
+  
+  if(max_n_nonzero == 0)  { return; }
+  
+  if(use_dense)  { dense_stamp.fill(stamp_none); }
+  
+  // numeric pass: fill each column, recording the number of elements which are nonzero
+  
+  uword* out_row_indices = access::rwp(c.row_indices);
+  eT*    out_values      = access::rwp(c.values);
+  
+  podarray<uword> counts(y_n_cols);
+  
+  const auto numeric_worker = [&](const uword part, const uword thread_id)
+    {
+    const uword col_start = part_start[part];
+    const uword col_end   = part_start[part+1];
+    
+    if(col_start == col_end)  { return; }
+    
+    podarray<uword> keys;
+    podarray<eT>    vals;
+    
+    if(use_dense == false)
+      {
+      uword max_n = 0;
+      
+      for(uword col = col_start; col < col_end; ++col)  { max_n = (std::max)(max_n, c.col_ptrs[col+1] - c.col_ptrs[col]); }
+      
+      keys.set_size( hash_size(max_n) );
+      vals.set_size( hash_size(max_n) );
+      }
+    
+    uword* stamp = (use_dense) ? (dense_stamp.memptr() + thread_id * x_n_rows) : nullptr;
+    eT*    sums  = (use_dense) ? (dense_sums.memptr()  + thread_id * x_n_rows) : nullptr;
+    
+    for(uword col = col_start; col < col_end; ++col)
+      {
+      const uword out_start = c.col_ptrs[col];
+      const uword out_n     = c.col_ptrs[col+1] - out_start;
+      
+      counts[col] = 0;
+      
+      if(out_n == 0)  { continue; }
+      
+      uword* col_rows = &(out_row_indices[out_start]);
+      eT*    col_vals = &(out_values[out_start]);
+      
+      uword count = 0;
+      
+      if(use_dense)
+        {
+        if(m == nullptr)
+          {
+          for(uword k = y_col_ptrs[col]; k < y_col_ptrs[col+1]; ++k)
+            {
+            const uword y_row = y_row_indices[k];
+            const eT    y_val = y_values[k];
+            
+            for(uword l = x_col_ptrs[y_row]; l < x_col_ptrs[y_row + 1]; ++l)
+              {
+              const uword row = x_row_indices[l];
+              
+              if(stamp[row] != col)
+                {
+                stamp[row] = col;
+                sums[row]  = x_values[l] * y_val;
+                
+                col_rows[count] = row;  ++count;
+                }
+              else
+                {
+                sums[row] += x_values[l] * y_val;
+                }
+              }
+            }
+          
+          op_sort::direct_sort_ascending(col_rows, count);
+          
+          uword n_keep = 0;
+          
+          for(uword i=0; i < count; ++i)
+            {
+            const uword row = col_rows[i];
+            const eT    val = sums[row];
+            
+            if(val != eT(0))  { col_rows[n_keep] = row; col_vals[n_keep] = val; ++n_keep; }
+            }
+          
+          count = n_keep;
+          }
+        else
+          {
+          for(uword i = m_col_ptrs[col]; i < m_col_ptrs[col+1]; ++i)
+            {
+            const uword row = m_row_indices[i];
+            
+            stamp[row] = col;
+            sums[row]  = eT(0);
+            }
+          
+          for(uword k = y_col_ptrs[col]; k < y_col_ptrs[col+1]; ++k)
+            {
+            const uword y_row = y_row_indices[k];
+            const eT    y_val = y_values[k];
+            
+            for(uword l = x_col_ptrs[y_row]; l < x_col_ptrs[y_row + 1]; ++l)
+              {
+              const uword row = x_row_indices[l];
+              
+              if(stamp[row] == col)  { sums[row] += x_values[l] * y_val; }
+              }
+            }
+          
+          for(uword i = m_col_ptrs[col]; i < m_col_ptrs[col+1]; ++i)
+            {
+            const uword row = m_row_indices[i];
+            const eT    val = sums[row] * m_values[i];
+            
+            if(val != eT(0))  { col_rows[count] = row; col_vals[count] = val; ++count; }
+            }
+          }
+        }
+      else
+        {
+        const uword n_keys = hash_size(out_n);
+        const uword mask   = n_keys - 1;
+        
+        arrayops::inplace_set(keys.memptr(), x_n_rows, n_keys);
+        
+        if(m == nullptr)
+          {
+          for(uword k = y_col_ptrs[col]; k < y_col_ptrs[col+1]; ++k)
+            {
+            const uword y_row = y_row_indices[k];
+            const eT    y_val = y_values[k];
+            
+            for(uword l = x_col_ptrs[y_row]; l < x_col_ptrs[y_row + 1]; ++l)
+              {
+              const uword row = x_row_indices[l];
+              const uword pos = hash_find(keys.memptr(), mask, row, x_n_rows);
+              
+              if(keys[pos] == x_n_rows)
+                {
+                keys[pos] = row;
+                vals[pos] = x_values[l] * y_val;
+                
+                col_rows[count] = row;  ++count;
+                }
+              else
+                {
+                vals[pos] += x_values[l] * y_val;
+                }
+              }
+            }
+          
+          op_sort::direct_sort_ascending(col_rows, count);
+          
+          uword n_keep = 0;
+          
+          for(uword i=0; i < count; ++i)
+            {
+            const uword row = col_rows[i];
+            const eT    val = vals[ hash_find(keys.memptr(), mask, row, x_n_rows) ];
+            
+            if(val != eT(0))  { col_rows[n_keep] = row; col_vals[n_keep] = val; ++n_keep; }
+            }
+          
+          count = n_keep;
+          }
+        else
+          {
+          for(uword i = m_col_ptrs[col]; i < m_col_ptrs[col+1]; ++i)
+            {
+            const uword row = m_row_indices[i];
+            const uword pos = hash_find(keys.memptr(), mask, row, x_n_rows);
+            
+            keys[pos] = row;
+            vals[pos] = eT(0);
+            }
+          
+          for(uword k = y_col_ptrs[col]; k < y_col_ptrs[col+1]; ++k)
+            {
+            const uword y_row = y_row_indices[k];
+            const eT    y_val = y_values[k];
+            
+            for(uword l = x_col_ptrs[y_row]; l < x_col_ptrs[y_row + 1]; ++l)
+              {
+              const uword pos = hash_find(keys.memptr(), mask, x_row_indices[l], x_n_rows);
+              
+              if(keys[pos] != x_n_rows)  { vals[pos] += x_values[l] * y_val; }
+              }
+            }
+          
+          for(uword i = m_col_ptrs[col]; i < m_col_ptrs[col+1]; ++i)
+            {
+            const uword row = m_row_indices[i];
+            const eT    val = vals[ hash_find(keys.memptr(), mask, row, x_n_rows) ] * m_values[i];
+            
+            if(val != eT(0))  { col_rows[count] = row; col_vals[count] = val; ++count; }
+            }
+          }
+        }
+      
+      counts[col] = count;
+      }
+    };
+  
+  for_each_part(numeric_worker);
+  
+  // remove the gaps left by elements which evaluated to zero
+  
+  uword cur_pos = 0;
+  
+  for(uword col=0; col < y_n_cols; ++col)
+    {
+    const uword src   = c.col_ptrs[col];
+    const uword count = counts[col];
+    
+    access::rw(c.col_ptrs[col]) = cur_pos;
+    
+    if(src != cur_pos)
+      {
+      for(uword i=0; i < count; ++i)
+        {
+        out_row_indices[cur_pos + i] = out_row_indices[src + i];
+        out_values     [cur_pos + i] = out_values     [src + i];
+        }
+      }
+    
+    cur_pos += count;
+    }
+  
+  access::rw(c.col_ptrs[y_n_cols]) = cur_pos;
+  
+  if(cur_pos < max_n_nonzero)  { c.mem_resize(cur_pos); }
+  }
+
+
+
 //
 //
 //
@@ -0,0 +1,87 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2026 Dirk Eddelbuettel
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// https://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+
+//! \addtogroup spmv_plan
+//! @{
+
+
+
+//! inspector/executor for repeated sparse matrix-vector products:
+//! the matrix is analysed and repacked once, after which each product is a single pass over a row-oriented layout;
+//! rows are split into blocks with a similar number of nonzeros, which are processed in parallel when OpenMP is enabled.
+//! layouts:
+//! "csr"  compressed sparse row (default);
+//! "sell" SELL-C-sigma: rows are sorted by length within windows of sigma rows,
+//!        then stored in chunks of C rows interleaved column by column, so that C rows are processed in lockstep;
+//!        this benefits from hardware with fast vector gather instructions, but adds padding for rows of uneven length
+template<typename eT>
+class spmv_plan
+  {
+  public:
+  
+  static constexpr uword sell_C     = 8;    //!< number of rows per chunk in the SELL-C-sigma layout
+  static constexpr uword sell_sigma = 256;  //!< size of the window in which rows are sorted by length
+  
+  const uword n_rows    = 0;
+  const uword n_cols    = 0;
+  const uword n_nonzero = 0;
+  
+  inline ~spmv_plan();
+  inline  spmv_plan();
+  
+  template<typename T1> inline explicit spmv_plan(const SpBase<eT,T1>& expr, const char* layout = "csr");
+  
+  template<typename T1> inline void inspect(const SpBase<eT,T1>& expr, const char* layout = "csr");
+  
+  inline void reset();
+  
+  arma_warn_unused inline bool is_sell() const;
+  
+  inline void apply      (eT* y_mem, const eT* x_mem) const;  //!< y = A*x;      x and y must not overlap
+  inline void apply_trans(eT* y_mem, const eT* x_mem) const;  //!< y = A.st()*x; x and y must not overlap
+  
+  template<typename T1> inline void apply      (Mat<eT>& out, const Base<eT,T1>& X) const;
+  template<typename T1> inline void apply_trans(Mat<eT>& out, const Base<eT,T1>& X) const;
+  
+  
+  private:
+  
+  uword layout_id = 0;  // 0 = not initialised, 1 = CSR, 2 = SELL-C-sigma
+  
+  SpMat<eT>  A;    // column-major form, used by apply_trans()
+  SpMatR<eT> R;    // row-major form, used by apply() with the CSR layout
+  
+  podarray<uword> blocks;       // boundaries of row blocks (CSR) or chunk blocks (SELL) processed by one thread
+  
+  podarray<uword> sell_ptrs;    // start of each chunk within sell_values and sell_cols
+  podarray<uword> sell_min_len; // length of the shortest row in each chunk
+  podarray<uword> sell_len;     // length of each row, in permuted order
+  podarray<uword> sell_perm;    // original index of each row, in permuted order
+  podarray<uword> sell_cols;
+  podarray<eT>    sell_values;
+  
+  inline void init_blocks(const uword n_units, const uword* unit_ptrs);
+  inline void init_sell();
+  
+  inline void apply_csr (eT* y_mem, const eT* x_mem, const uword block) const;
+  inline void apply_sell(eT* y_mem, const eT* x_mem, const uword block) const;
+  };
+
+
+
+//! @}
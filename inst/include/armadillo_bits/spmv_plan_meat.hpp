@@ -0,0 +1,508 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2026 Dirk Eddelbuettel
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// https://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+
+//! \addtogroup spmv_plan
+//! @{
+
+
+
+template<typename eT>
+inline
+spmv_plan<eT>::~spmv_plan()
+  {
+  arma_debug_sigprint_this(this);
+  }
+
+
+
+template<typename eT>
+inline
+spmv_plan<eT>::spmv_plan()
+  {
+  arma_debug_sigprint_this(this);
+  }
+
+
+
+template<typename eT>
+template<typename T1>
+inline
+spmv_plan<eT>::spmv_plan(const SpBase<eT,T1>& expr, const char* layout)
+  {
+  arma_debug_sigprint_this(this);
+  
+  (*this).inspect(expr, layout);
+  }
+
+
+
+template<typename eT>
+template<typename T1>
+inline
+void
+spmv_plan<eT>::inspect(const SpBase<eT,T1>& expr, const char* layout)
+  {
+  arma_debug_sigprint();
+  
+  const char sig = (layout != nullptr) ? layout[0] : char(0);
+  
+  arma_conform_check( ((sig != 'c') && (sig != 's')), "spmv_plan::inspect(): unknown layout" );
+  
+  (*this).reset();
+  
+  A = expr.get_ref();
+  A.sync();
+  
+  R = A;
+  
+  access::rw(n_rows)    = A.n_rows;
+  access::rw(n_cols)    = A.n_cols;
+  access::rw(n_nonzero) = A.n_nonzero;
+  
+  const bool use_sell = (sig == 's');
+  
+  if(use_sell)
+    {
+    arma_debug_print("spmv_plan::inspect(): using SELL-C-sigma layout");
+    
+    init_sell();
+    
+    layout_id = 2;
+    
+    R.reset();
+    }
+  else
+    {
+    arma_debug_print("spmv_plan::inspect(): using CSR layout");
+    
+    layout_id = 1;
+    
+    init_blocks(n_rows, R.row_ptrs);
+    }
+  }
+
+
+
+template<typename eT>
+inline
+void
+spmv_plan<eT>::reset()
+  {
+  arma_debug_sigprint();
+  
+  layout_id = 0;
+  
+  access::rw(n_rows)    = 0;
+  access::rw(n_cols)    = 0;
+  access::rw(n_nonzero) = 0;
+  
+  A.reset();
+  R.reset();
+  
+  blocks.reset();
+  sell_ptrs.reset();
+  sell_min_len.reset();
+  sell_len.reset();
+  sell_perm.reset();
+  sell_cols.reset();
+  sell_values.reset();
+  }
+
+
+
+template<typename eT>
+inline
+bool
+spmv_plan<eT>::is_sell() const
+  {
+  return (layout_id == 2);
+  }
+
+
+
+//! split the rows (or chunks) into blocks with approximately equal cost, counting both nonzeros and rows;
+//! several blocks per thread allow dynamic scheduling to even out the remaining imbalance
+template<typename eT>
+inline
+void
+spmv_plan<eT>::init_blocks(const uword n_units, const uword* unit_ptrs)
+  {
+  arma_debug_sigprint();
+  
+  const uword n_threads = uword(mp_thread_limit::get());
+  
+  const uword n_blocks = (n_threads > 1) ? (std::max)(uword(1), (std::min)(n_units, uword(4) * n_threads)) : uword(1);
+  
+  blocks.set_size(n_blocks + 1);
+  
+  const double total_cost = double(unit_ptrs[n_units]) + double(n_units);
+  
+  uword unit = 0;
+  
+  blocks[0] = 0;
+  
+  for(uword b=1; b < n_blocks; ++b)
+    {
+    const double target = (total_cost * double(b)) / double(n_blocks);
+    
+    while( (unit < n_units) && ((double(unit_ptrs[unit]) + double(unit)) < target) )  { ++unit; }
+    
+    blocks[b] = unit;
+    }
+  
+  blocks[n_blocks] = n_units;
+  }
+
+
+
+//! repack the row-major form into SELL-C-sigma:
+//! within each window of sigma rows, rows are sorted by decreasing length;
+//! each chunk of C consecutive (sorted) rows is stored column by column and padded to the length of its longest row
+template<typename eT>
+inline
+void
+spmv_plan<eT>::init_sell()
+  {
+  arma_debug_sigprint();
+  
+  const uword C = sell_C;
+  
+  const uword n_chunks = (n_rows + C - 1) / C;
+  
+  sell_perm.set_size(n_chunks * C);
+  sell_len.zeros(n_chunks * C);
+  sell_min_len.set_size(n_chunks);
+  sell_ptrs.set_size(n_chunks + 1);
+  
+  const uword* R_row_ptrs = R.row_ptrs;
+  
+  for(uword i=0; i < n_rows; ++i)  { sell_perm[i] = i; }
+  
+  // padding rows are empty and placed last
+  for(uword i=n_rows; i < sell_perm.n_elem; ++i)  { sell_perm[i] = n_rows; }
+  
+  const auto row_len = [&](const uword row) -> uword { return (row < n_rows) ? (R_row_ptrs[row+1] - R_row_ptrs[row]) : uword(0); };
+  
+  for(uword start=0; start < n_rows; start += sell_sigma)
+    {
+    const uword end = (std::min)(start + sell_sigma, n_rows);
+    
+    std::stable_sort( &(sell_perm[start]), &(sell_perm[end]), [&](const uword a, const uword b) { return row_len(a) > row_len(b); } );
+    }
+  
+  sell_ptrs[0] = 0;
+  
+  for(uword c=0; c < n_chunks; ++c)
+    {
+    uword max_len = 0;
+    uword min_len = 0;
+    
+    for(uword lane=0; lane < C; ++lane)
+      {
+      const uword len = row_len(sell_perm[c*C + lane]);
+      
+      sell_len[c*C + lane] = len;
+      
+      max_len = (lane == 0) ? len : (std::max)(max_len, len);
+      min_len = (lane == 0) ? len : (std::min)(min_len, len);
+      }
+    
+    sell_min_len[c] = min_len;
+    
+    sell_ptrs[c+1] = sell_ptrs[c] + max_len * C;
+    }
+  
+  const uword n_padded = sell_ptrs[n_chunks];
+  
+  sell_cols.zeros(n_padded);
+  sell_values.zeros(n_padded);
+  
+  const uword* R_col_indices = R.col_indices;
+  const eT*    R_values      = R.values;
+  
+  for(uword c=0; c < n_chunks; ++c)
+    {
+    for(uword lane=0; lane < C; ++lane)
+      {
+      const uword row = sell_perm[c*C + lane];
+      
+      if(row >= n_rows)  { continue; }
+      
+      const uword len = sell_len[c*C + lane];
+      
+      uword pos = sell_ptrs[c] + lane;
+      
+      for(uword k = R_row_ptrs[row]; k < (R_row_ptrs[row] + len); ++k, pos += C)
+        {
+        sell_cols[pos]   = R_col_indices[k];
+        sell_values[pos] = R_values[k];
+        }
+      }
+    }
+  
+  // blocks are formed from chunks; the cost of each chunk is its padded size
+  podarray<uword> chunk_cost(n_chunks + 1);
+  
+  for(uword c=0; c <= n_chunks; ++c)  { chunk_cost[c] = sell_ptrs[c] / C; }
+  
+  init_blocks(n_chunks, chunk_cost.memptr());
+  }
+
+
+
+template<typename eT>
+inline
+void
+spmv_plan<eT>::apply_csr(eT* y_mem, const eT* x_mem, const uword block) const
+  {
+  const uword* R_row_ptrs    = R.row_ptrs;
+  const uword* R_col_indices = R.col_indices;
+  const eT*    R_values      = R.values;
+  
+  const uword row_end = blocks[block+1];
+  
+  for(uword row = blocks[block]; row < row_end; ++row)
+    {
+    const uword k_end = R_row_ptrs[row+1];
+    
+    eT acc1 = eT(0);
+    eT acc2 = eT(0);
+    
+    uword k = R_row_ptrs[row];
+    
+    for(; (k+1) < k_end; k += 2)
+      {
+      acc1 += R_values[k  ] * x_mem[ R_col_indices[k  ] ];
+      acc2 += R_values[k+1] * x_mem[ R_col_indices[k+1] ];
+      }
+    
+    if(k < k_end)  { acc1 += R_values[k] * x_mem[ R_col_indices[k] ]; }
+    
+    y_mem[row] = acc1 + acc2;
+    }
+  }
+
+
+
+//! all C rows of a chunk are processed in lockstep up to the length of the shortest row,
+//! which is a fixed-width loop without branches that the compiler can vectorise;
+//! the remaining elements are processed with a per-row length check, so padding is never read
+template<typename eT>
+inline
+void
+spmv_plan<eT>::apply_sell(eT* y_mem, const eT* x_mem, const uword block) const
+  {
+  const uword C = sell_C;
+  
+  const uword chunk_end = blocks[block+1];
+  
+  for(uword c = blocks[block]; c < chunk_end; ++c)
+    {
+    const uword* cols = sell_cols.memptr()   + sell_ptrs[c];
+    const eT*    vals = sell_values.memptr() + sell_ptrs[c];
+    const uword* lens = sell_len.memptr()    + c*C;
+    
+    const uword max_len = (sell_ptrs[c+1] - sell_ptrs[c]) / C;
+    const uword min_len = sell_min_len[c];
+    
+    eT acc[sell_C];
+    
+    for(uword lane=0; lane < C; ++lane)  { acc[lane] = eT(0); }
+    
+    uword j = 0;
+    
+    for(; j < min_len; ++j, cols += C, vals += C)
+      {
+      for(uword lane=0; lane < C; ++lane)  { acc[lane] += vals[lane] * x_mem[ cols[lane] ]; }
+      }
+    
+    for(; j < max_len; ++j, cols += C, vals += C)
+      {
+      for(uword lane=0; lane < C; ++lane)
+        {
+        if(j < lens[lane])  { acc[lane] += vals[lane] * x_mem[ cols[lane] ]; }
+        }
+      }
+    
+    const uword* perm = sell_perm.memptr() + c*C;
+    
+    for(uword lane=0; lane < C; ++lane)
+      {
+      const uword row = perm[lane];
+      
+      if(row < n_rows)  { y_mem[row] = acc[lane]; }
+      }
+    }
+  }
+
+
+
+template<typename eT>
+inline
+void
+spmv_plan<eT>::apply(eT* y_mem, const eT* x_mem) const
+  {
+  arma_debug_sigprint();
+  
+  arma_conform_check( (layout_id == 0), "spmv_plan::apply(): plan not initialised" );
+  
+  if(n_nonzero == 0)  { arrayops::fill_zeros(y_mem, n_rows); return; }
+  
+  const uword n_blocks = blocks.n_elem - 1;
+  
+  if( (arma_config::openmp) && (mp_thread_limit::in_parallel() == false) && (n_blocks >= 2) && mp_gate<eT>::eval(n_nonzero) )
+    {
+    #if defined(ARMA_USE_OPENMP)
+      {
+      arma_debug_print("openmp implementation");
+      
+      const int n_threads = mp_thread_limit::get();
+      
+      if(layout_id == 2)
+        {
+        #pragma omp parallel for schedule(dynamic) num_threads(n_threads)
+        for(uword block=0; block < n_blocks; ++block)  { apply_sell(y_mem, x_mem, block); }
+        }
+      else
+        {
+        #pragma omp parallel for schedule(dynamic) num_threads(n_threads)
+        for(uword block=0; block < n_blocks; ++block)  { apply_csr(y_mem, x_mem, block); }
+        }
+      }
+    #endif
+    }
+  else
+    {
+    if(layout_id == 2)
+      {
+      for(uword block=0; block < n_blocks; ++block)  { apply_sell(y_mem, x_mem, block); }
+      }
+    else
+      {
+      for(uword block=0; block < n_blocks; ++block)  { apply_csr(y_mem, x_mem, block); }
+      }
+    }
+  }
+
+
+
+//! each column of A yields one element of the output, so the columns can be processed independently
+template<typename eT>
+inline
+void
+spmv_plan<eT>::apply_trans(eT* y_mem, const eT* x_mem) const
+  {
+  arma_debug_sigprint();
+  
+  arma_conform_check( (layout_id == 0), "spmv_plan::apply_trans(): plan not initialised" );
+  
+  const uword* A_col_ptrs    = A.col_ptrs;
+  const uword* A_row_indices = A.row_indices;
+  const eT*    A_values      = A.values;
+  
+  const auto worker = [&](const uword col)
+    {
+    eT acc = eT(0);
+    
+    for(uword k = A_col_ptrs[col]; k < A_col_ptrs[col+1]; ++k)  { acc += A_values[k] * x_mem[ A_row_indices[k] ]; }
+    
+    y_mem[col] = acc;
+    };
+  
+  if( (arma_config::openmp) && (mp_thread_limit::in_parallel() == false) && (n_cols >= 2) && mp_gate<eT>::eval(n_nonzero) )
+    {
+    #if defined(ARMA_USE_OPENMP)
+      {
+      arma_debug_print("openmp implementation");
+      
+      const int n_threads = mp_thread_limit::get();
+      
+      #pragma omp parallel for schedule(static) num_threads(n_threads)
+      for(uword col=0; col < n_cols; ++col)  { worker(col); }
+      }
+    #endif
+    }
+  else
+    {
+    for(uword col=0; col < n_cols; ++col)  { worker(col); }
+    }
+  }
+
+
+
+template<typename eT>
+template<typename T1>
+inline
+void
+spmv_plan<eT>::apply(Mat<eT>& out, const Base<eT,T1>& X) const
+  {
+  arma_debug_sigprint();
+  
+  const quasi_unwrap<T1> U(X.get_ref());
+  const Mat<eT>& B     = U.M;
+  
+  arma_conform_assert_mul_size(n_rows, n_cols, B.n_rows, B.n_cols, "spmv_plan::apply()");
+  
+  Mat<eT>  tmp;
+  Mat<eT>& dest = (U.is_alias(out)) ? tmp : out;
+  
+  if( (layout_id == 1) && (B.n_cols > 1) )
+    {
+    arma_debug_print("spmv_plan::apply(): sparse times dense block");
+    
+    // R.st() is the column-major form of A.st(); each row of A is traversed once for all columns of B
+    glue_times_sparse_dense::apply_trans_blocked(dest, R.st(), B);
+    }
+  else
+    {
+    dest.set_size(n_rows, B.n_cols);
+    
+    for(uword col=0; col < B.n_cols; ++col)  { (*this).apply(dest.colptr(col), B.colptr(col)); }
+    }
+  
+  if(U.is_alias(out))  { out.steal_mem(tmp); }
+  }
+
+
+
+template<typename eT>
+template<typename T1>
+inline
+void
+spmv_plan<eT>::apply_trans(Mat<eT>& out, const Base<eT,T1>& X) const
+  {
+  arma_debug_sigprint();
+  
+  const quasi_unwrap<T1> U(X.get_ref());
+  const Mat<eT>& B     = U.M;
+  
+  arma_conform_assert_mul_size(n_cols, n_rows, B.n_rows, B.n_cols, "spmv_plan::apply_trans()");
+  
+  Mat<eT>  tmp;
+  Mat<eT>& dest = (U.is_alias(out)) ? tmp : out;
+  
+  dest.set_size(n_cols, B.n_cols);
+  
+  for(uword col=0; col < B.n_cols; ++col)  { (*this).apply_trans(dest.colptr(col), B.colptr(col)); }
+  
+  if(U.is_alias(out))  { out.steal_mem(tmp); }
+  }
+
+
+
+//! @}
@@ -28,8 +28,15 @@ spop_norm::mat_norm_1(const SpMat<eT>& X)
   {
   arma_debug_sigprint();
   
-  // TODO: this can be sped up with a dedicated implementation
-  return as_scalar( max( sum(abs(X), 0), 1) );
+  typedef typename get_pod_type<eT>::result T;
+  
+  X.sync();
+  
+  podarray<T> col_sums(X.n_cols);
+  
+  op_sp_sum::reduce_cols(col_sums.memptr(), X.n_cols, X.col_ptrs, X.values, [](const eT* coldata, const uword N) { T acc = T(0); for(uword i=0; i < N; ++i)  { acc += std::abs(coldata[i]); } return acc; });
+  
+  return (X.n_cols > 0) ? op_max::direct_max(col_sums.memptr(), X.n_cols) : T(0);
   }
 
 
@@ -123,8 +130,15 @@ spop_norm::mat_norm_inf(const SpMat<eT>& X)
   {
   arma_debug_sigprint();
   
-  // TODO: this can be sped up with a dedicated implementation
-  return as_scalar( max( sum(abs(X), 1), 0) );
+  typedef typename get_pod_type<eT>::result T;
+  
+  X.sync();
+  
+  podarray<T> row_sums(X.n_rows);
+  
+  op_sp_sum::reduce_rows(row_sums.memptr(), X.n_rows, X.n_cols, X.col_ptrs, X.row_indices, X.values, [](const eT val, const uword) { return T(std::abs(val)); });
+  
+  return (X.n_rows > 0) ? op_max::direct_max(row_sums.memptr(), X.n_rows) : T(0);
   }
 
 
@@ -34,6 +34,14 @@ class spsolve_factoriser
   
   inline void cleanup();
   
+  template<typename T1> inline bool factorise_iterative(const SpBase<typename T1::elem_type,T1>& A_expr, const iterative_opts& opts);
+  
+  template<typename T1> inline bool solve_iterative(Mat<typename T1::elem_type>& X, const Base<typename T1::elem_type,T1>& B_expr);
+  
+  template<typename T1> inline bool factorise_chol(const SpBase<typename T1::elem_type,T1>& A_expr, const sp_chol_opts& opts);
+  
+  template<typename T1> inline bool solve_chol(Mat<typename T1::elem_type>& X, const Base<typename T1::elem_type,T1>& B_expr);
+  
   
   public:
   
@@ -48,6 +56,10 @@ class spsolve_factoriser
   
   template<typename T1> inline bool solve(Mat<typename T1::elem_type>& X, const Base<typename T1::elem_type,T1>& B_expr, const typename arma_blas_real_or_cx_only<typename T1::elem_type>::result* junk = nullptr);
   
+  template<typename T1> inline bool refactorise(const SpBase<typename T1::elem_type,T1>& A_expr, const typename arma_blas_real_or_cx_only<typename T1::elem_type>::result* junk = nullptr);
+  
+  inline bool log_det(double& out_val, double& out_sign) const;
+  
   inline      spsolve_factoriser(const spsolve_factoriser&) = delete;
   inline void operator=         (const spsolve_factoriser&) = delete;
   };
@@ -55,6 +55,15 @@ spsolve_factoriser::cleanup()
     }
   #endif
   
+       if(elem_type_indicator == 11)  { delete_worker< sp_iterative_worker<    float> >(); }
+  else if(elem_type_indicator == 12)  { delete_worker< sp_iterative_worker<   double> >(); }
+  else if(elem_type_indicator == 13)  { delete_worker< sp_iterative_worker< cx_float> >(); }
+  else if(elem_type_indicator == 14)  { delete_worker< sp_iterative_worker<cx_double> >(); }
+  else if(elem_type_indicator == 21)  { delete_worker< sp_chol_worker<    float> >(); }
+  else if(elem_type_indicator == 22)  { delete_worker< sp_chol_worker<   double> >(); }
+  else if(elem_type_indicator == 23)  { delete_worker< sp_chol_worker< cx_float> >(); }
+  else if(elem_type_indicator == 24)  { delete_worker< sp_chol_worker<cx_double> >(); }
+  
   worker_ptr          = nullptr;
   elem_type_indicator = 0;
   n_rows              = 0;
@@ -116,6 +125,16 @@ spsolve_factoriser::factorise
   arma_debug_sigprint();
   arma_ignore(junk);
   
+  if(settings.id == 2)
+    {
+    return (*this).factorise_iterative(A_expr.get_ref(), static_cast<const iterative_opts&>(settings));
+    }
+  
+  if(settings.id == 3)
+    {
+    return (*this).factorise_chol(A_expr.get_ref(), static_cast<const sp_chol_opts&>(settings));
+    }
+  
   #if defined(ARMA_USE_SUPERLU)
     {
     typedef typename T1::elem_type            eT;
@@ -216,6 +235,16 @@ spsolve_factoriser::solve
   arma_debug_sigprint();
   arma_ignore(junk);
   
+  if(elem_type_indicator > 20)
+    {
+    return (*this).solve_chol(X, B_expr.get_ref());
+    }
+  
+  if(elem_type_indicator > 10)
+    {
+    return (*this).solve_iterative(X, B_expr.get_ref());
+    }
+  
   #if defined(ARMA_USE_SUPERLU)
     {
     typedef typename T1::elem_type eT;
@@ -286,4 +315,367 @@ spsolve_factoriser::solve
 
 
 
+template<typename T1>
+inline
+bool
+spsolve_factoriser::factorise_iterative(const SpBase<typename T1::elem_type,T1>& A_expr, const iterative_opts& opts)
+  {
+  arma_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  
+  typedef sp_iterative_worker<eT> worker_type;
+  
+  cleanup();
+  
+  const unwrap_spmat<T1> U(A_expr.get_ref());
+  const SpMat<eT>& A =   U.M;
+  
+  if(A.is_square() == false)
+    {
+    arma_warn(1, "spsolve_factoriser::factorise(): solving under-determined / over-determined systems is currently not supported");
+    return false;
+    }
+  
+  n_rows = A.n_rows;
+  
+  worker_ptr = new(std::nothrow) worker_type(opts);
+  
+  if(worker_ptr == nullptr)
+    {
+    arma_warn(3, "spsolve_factoriser::factorise(): could not construct worker object");
+    return false;
+    }
+  
+       if(    is_float<eT>::value)  { elem_type_indicator = 11; }
+  else if(   is_double<eT>::value)  { elem_type_indicator = 12; }
+  else if( is_cx_float<eT>::value)  { elem_type_indicator = 13; }
+  else if(is_cx_double<eT>::value)  { elem_type_indicator = 14; }
+  
+  worker_type* local_worker_ptr = reinterpret_cast<worker_type*>(worker_ptr);
+  worker_type& local_worker_ref = (*local_worker_ptr);
+  
+  // rcond is not estimated by the iterative solvers
+  
+  const bool status = local_worker_ref.factorise(A);
+  
+  if(status == false)
+    {
+    arma_warn(3, "spsolve_factoriser::factorise(): preconditioner could not be constructed");
+    delete_worker<worker_type>();
+    elem_type_indicator = 0;
+    return false;
+    }
+  
+  return true;
+  }
+
+
+
+template<typename T1>
+inline
+bool
+spsolve_factoriser::solve_iterative(Mat<typename T1::elem_type>& X, const Base<typename T1::elem_type,T1>& B_expr)
+  {
+  arma_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  
+  typedef sp_iterative_worker<eT> worker_type;
+  
+  bool type_mismatch = false;
+  
+       if(    (is_float<eT>::value) && (elem_type_indicator != 11) )  { type_mismatch = true; }
+  else if(   (is_double<eT>::value) && (elem_type_indicator != 12) )  { type_mismatch = true; }
+  else if( (is_cx_float<eT>::value) && (elem_type_indicator != 13) )  { type_mismatch = true; }
+  else if((is_cx_double<eT>::value) && (elem_type_indicator != 14) )  { type_mismatch = true; }
+  
+  if(type_mismatch)
+    {
+    arma_warn(1, "spsolve_factoriser::solve(): matrix type mismatch");
+    X.soft_reset();
+    return false;
+    }
+  
+  const quasi_unwrap<T1> U(B_expr.get_ref());
+  const Mat<eT>& B     = U.M;
+  
+  if(n_rows != B.n_rows)
+    {
+    arma_warn(1, "spsolve_factoriser::solve(): matrix size mismatch");
+    X.soft_reset();
+    return false;
+    }
+  
+  const bool is_alias = U.is_alias(X);
+  
+  Mat<eT>  tmp;
+  Mat<eT>& out = is_alias ? tmp : X;
+  
+  const worker_type* local_worker_ptr = reinterpret_cast<const worker_type*>(worker_ptr);
+  
+  const bool status = (*local_worker_ptr).solve(out,B);
+  
+  if(is_alias)  { X.steal_mem(tmp); }
+  
+  if(status == false)
+    {
+    arma_warn(3, "spsolve_factoriser::solve(): solution not found");
+    X.soft_reset();
+    return false;
+    }
+  
+  return true;
+  }
+
+
+
+template<typename T1>
+inline
+bool
+spsolve_factoriser::factorise_chol(const SpBase<typename T1::elem_type,T1>& A_expr, const sp_chol_opts& opts)
+  {
+  arma_debug_sigprint();
+  
+  typedef typename T1::elem_type            eT;
+  typedef typename get_pod_type<eT>::result  T;
+  
+  typedef sp_chol_worker<eT> worker_type;
+  
+  cleanup();
+  
+  const unwrap_spmat<T1> U(A_expr.get_ref());
+  const SpMat<eT>& A =   U.M;
+  
+  if(A.is_square() == false)
+    {
+    arma_warn(1, "spsolve_factoriser::factorise(): sparse Cholesky factorisation requires a square matrix");
+    return false;
+    }
+  
+  n_rows = A.n_rows;
+  
+  worker_ptr = new(std::nothrow) worker_type(opts);
+  
+  if(worker_ptr == nullptr)
+    {
+    arma_warn(3, "spsolve_factoriser::factorise(): could not construct worker object");
+    return false;
+    }
+  
+       if(    is_float<eT>::value)  { elem_type_indicator = 21; }
+  else if(   is_double<eT>::value)  { elem_type_indicator = 22; }
+  else if( is_cx_float<eT>::value)  { elem_type_indicator = 23; }
+  else if(is_cx_double<eT>::value)  { elem_type_indicator = 24; }
+  
+  worker_type* local_worker_ptr = reinterpret_cast<worker_type*>(worker_ptr);
+  worker_type& local_worker_ref = (*local_worker_ptr);
+  
+  const bool status = local_worker_ref.factorise(A);
+  
+  const T local_rcond_value = (status) ? local_worker_ref.rcond() : T(0);
+  
+  rcond_value = double(local_rcond_value);
+  
+  if(status == false)
+    {
+    arma_warn(3, "spsolve_factoriser::factorise(): factorisation failed; matrix is not symmetric positive definite");
+    delete_worker<worker_type>();
+    elem_type_indicator = 0;
+    return false;
+    }
+  
+  return true;
+  }
+
+
+
+template<typename T1>
+inline
+bool
+spsolve_factoriser::solve_chol(Mat<typename T1::elem_type>& X, const Base<typename T1::elem_type,T1>& B_expr)
+  {
+  arma_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  
+  typedef sp_chol_worker<eT> worker_type;
+  
+  bool type_mismatch = false;
+  
+       if(    (is_float<eT>::value) && (elem_type_indicator != 21) )  { type_mismatch = true; }
+  else if(   (is_double<eT>::value) && (elem_type_indicator != 22) )  { type_mismatch = true; }
+  else if( (is_cx_float<eT>::value) && (elem_type_indicator != 23) )  { type_mismatch = true; }
+  else if((is_cx_double<eT>::value) && (elem_type_indicator != 24) )  { type_mismatch = true; }
+  
+  if(type_mismatch)
+    {
+    arma_warn(1, "spsolve_factoriser::solve(): matrix type mismatch");
+    X.soft_reset();
+    return false;
+    }
+  
+  const quasi_unwrap<T1> U(B_expr.get_ref());
+  const Mat<eT>& B     = U.M;
+  
+  if(n_rows != B.n_rows)
+    {
+    arma_warn(1, "spsolve_factoriser::solve(): matrix size mismatch");
+    X.soft_reset();
+    return false;
+    }
+  
+  const bool is_alias = U.is_alias(X);
+  
+  Mat<eT>  tmp;
+  Mat<eT>& out = is_alias ? tmp : X;
+  
+  const worker_type* local_worker_ptr = reinterpret_cast<const worker_type*>(worker_ptr);
+  
+  const bool status = (*local_worker_ptr).solve(out,B);
+  
+  if(is_alias)  { X.steal_mem(tmp); }
+  
+  if(status == false)
+    {
+    arma_warn(3, "spsolve_factoriser::solve(): solution not found");
+    X.soft_reset();
+    return false;
+    }
+  
+  return true;
+  }
+
+
+
+//! numeric refactorisation of a matrix with (usually) the same sparsity pattern as the previously factorised matrix;
+//! the symbolic analysis of the sparse Cholesky factorisation is reused when the pattern is unchanged
+template<typename T1>
+inline
+bool
+spsolve_factoriser::refactorise
+  (
+  const SpBase<typename T1::elem_type,T1>& A_expr,
+  const typename arma_blas_real_or_cx_only<typename T1::elem_type>::result* junk
+  )
+  {
+  arma_debug_sigprint();
+  arma_ignore(junk);
+  
+  typedef typename T1::elem_type eT;
+  
+  if(worker_ptr == nullptr)
+    {
+    arma_warn(2, "spsolve_factoriser::refactorise(): no factorisation available");
+    return false;
+    }
+  
+  const unwrap_spmat<T1> U(A_expr.get_ref());
+  const SpMat<eT>& A =   U.M;
+  
+  if( (A.n_rows != n_rows) || (A.n_cols != n_rows) )
+    {
+    arma_warn(1, "spsolve_factoriser::refactorise(): matrix size mismatch");
+    return false;
+    }
+  
+  bool type_mismatch = false;
+  
+  bool status = false;
+  
+  if( (elem_type_indicator > 20) && (elem_type_indicator <= 24) )
+    {
+    typedef sp_chol_worker<eT> worker_type;
+    
+         if(    (is_float<eT>::value) && (elem_type_indicator != 21) )  { type_mismatch = true; }
+    else if(   (is_double<eT>::value) && (elem_type_indicator != 22) )  { type_mismatch = true; }
+    else if( (is_cx_float<eT>::value) && (elem_type_indicator != 23) )  { type_mismatch = true; }
+    else if((is_cx_double<eT>::value) && (elem_type_indicator != 24) )  { type_mismatch = true; }
+    
+    if(type_mismatch == false)
+      {
+      worker_type& local_worker_ref = *(reinterpret_cast<worker_type*>(worker_ptr));
+      
+      status = local_worker_ref.refactorise(A);
+      
+      rcond_value = (status) ? double(local_worker_ref.rcond()) : double(0);
+      
+      if(status == false)
+        {
+        arma_warn(3, "spsolve_factoriser::refactorise(): factorisation failed; matrix is not symmetric positive definite");
+        cleanup();
+        }
+      }
+    }
+  else
+  if( (elem_type_indicator > 10) && (elem_type_indicator <= 14) )
+    {
+    typedef sp_iterative_worker<eT> worker_type;
+    
+         if(    (is_float<eT>::value) && (elem_type_indicator != 11) )  { type_mismatch = true; }
+    else if(   (is_double<eT>::value) && (elem_type_indicator != 12) )  { type_mismatch = true; }
+    else if( (is_cx_float<eT>::value) && (elem_type_indicator != 13) )  { type_mismatch = true; }
+    else if((is_cx_double<eT>::value) && (elem_type_indicator != 14) )  { type_mismatch = true; }
+    
+    if(type_mismatch == false)
+      {
+      worker_type& local_worker_ref = *(reinterpret_cast<worker_type*>(worker_ptr));
+      
+      status = local_worker_ref.factorise(A);
+      
+      if(status == false)
+        {
+        arma_warn(3, "spsolve_factoriser::refactorise(): preconditioner could not be constructed");
+        cleanup();
+        }
+      }
+    }
+  else
+    {
+    arma_warn(1, "spsolve_factoriser::refactorise(): only supported for sparse Cholesky and iterative solvers; use factorise() instead");
+    return false;
+    }
+  
+  if(type_mismatch)
+    {
+    arma_warn(1, "spsolve_factoriser::refactorise(): matrix type mismatch");
+    return false;
+    }
+  
+  return status;
+  }
+
+
+
+//! log-determinant of the factorised matrix; only available after a sparse Cholesky factorisation (sp_chol_opts)
+inline
+bool
+spsolve_factoriser::log_det(double& out_val, double& out_sign) const
+  {
+  arma_debug_sigprint();
+  
+  float  val_f  = float(0);
+  float  sign_f = float(1);
+  double val_d  = double(0);
+  double sign_d = double(1);
+  
+       if(elem_type_indicator == 21)  { reinterpret_cast< const sp_chol_worker<    float>* >(worker_ptr)->log_det(val_f, sign_f); out_val = double(val_f); out_sign = double(sign_f); }
+  else if(elem_type_indicator == 22)  { reinterpret_cast< const sp_chol_worker<   double>* >(worker_ptr)->log_det(val_d, sign_d); out_val = val_d;         out_sign = sign_d;         }
+  else if(elem_type_indicator == 23)  { reinterpret_cast< const sp_chol_worker< cx_float>* >(worker_ptr)->log_det(val_f, sign_f); out_val = double(val_f); out_sign = double(sign_f); }
+  else if(elem_type_indicator == 24)  { reinterpret_cast< const sp_chol_worker<cx_double>* >(worker_ptr)->log_det(val_d, sign_d); out_val = val_d;         out_sign = sign_d;         }
+  else
+    {
+    arma_warn(1, "spsolve_factoriser::log_det(): only available after sparse Cholesky factorisation");
+    
+    out_val  = Datum<double>::nan;
+    out_sign = double(0);
+    
+    return false;
+    }
+  
+  return true;
+  }
+
+
+
 //! @}
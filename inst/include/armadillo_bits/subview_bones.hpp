@@ -198,6 +198,12 @@ class subview : public Base< eT, subview<eT> >
   inline void each_row(const std::function< void(      Row<eT>&) >& F);
   inline void each_row(const std::function< void(const Row<eT>&) >& F) const;
   
+  inline void each_col(const std::function< void(      Col<eT>&) >& F, const bool use_mp);
+  inline void each_col(const std::function< void(const Col<eT>&) >& F, const bool use_mp) const;
+  
+  inline void each_row(const std::function< void(      Row<eT>&) >& F, const bool use_mp);
+  inline void each_row(const std::function< void(const Row<eT>&) >& F, const bool use_mp) const;
+  
   inline       diagview<eT> diag(const sword in_id = 0);
   inline const diagview<eT> diag(const sword in_id = 0) const;
   
@@ -113,7 +113,12 @@ subview_cube_each1<eT>::operator= (const Base<eT,T1>& in)
   
   const eT* A_mem = A.memptr();
   
-  for(uword i=0; i < p_n_slices; ++i)  { arrayops::copy( p.slice_memptr(i), A_mem, p_n_elem_slice ); }
+  const auto worker = [&](const uword slice, const uword start, const uword end)
+    {
+    arrayops::copy( &(p.slice_memptr(slice)[start]), &(A_mem[start]), end - start );
+    };
+  
+  subview_each_mp::for_each_tile(p_n_elem_slice, p_n_slices, worker);
   }
 
 
@@ -140,7 +145,12 @@ subview_cube_each1<eT>::operator+= (const Base<eT,T1>& in)
   
   const eT* A_mem = A.memptr();
   
-  for(uword i=0; i < p_n_slices; ++i)  { arrayops::inplace_plus( p.slice_memptr(i), A_mem, p_n_elem_slice ); }
+  const auto worker = [&](const uword slice, const uword start, const uword end)
+    {
+    arrayops::inplace_plus( &(p.slice_memptr(slice)[start]), &(A_mem[start]), end - start );
+    };
+  
+  subview_each_mp::for_each_tile(p_n_elem_slice, p_n_slices, worker);
   }
 
 
@@ -167,7 +177,12 @@ subview_cube_each1<eT>::operator-= (const Base<eT,T1>& in)
   
   const eT* A_mem = A.memptr();
   
-  for(uword i=0; i < p_n_slices; ++i)  { arrayops::inplace_minus( p.slice_memptr(i), A_mem, p_n_elem_slice ); }
+  const auto worker = [&](const uword slice, const uword start, const uword end)
+    {
+    arrayops::inplace_minus( &(p.slice_memptr(slice)[start]), &(A_mem[start]), end - start );
+    };
+  
+  subview_each_mp::for_each_tile(p_n_elem_slice, p_n_slices, worker);
   }
 
 
@@ -194,7 +209,12 @@ subview_cube_each1<eT>::operator%= (const Base<eT,T1>& in)
   
   const eT* A_mem = A.memptr();
   
-  for(uword i=0; i < p_n_slices; ++i)  { arrayops::inplace_mul( p.slice_memptr(i), A_mem, p_n_elem_slice ); }
+  const auto worker = [&](const uword slice, const uword start, const uword end)
+    {
+    arrayops::inplace_mul( &(p.slice_memptr(slice)[start]), &(A_mem[start]), end - start );
+    };
+  
+  subview_each_mp::for_each_tile(p_n_elem_slice, p_n_slices, worker);
   }
 
 
@@ -221,7 +241,12 @@ subview_cube_each1<eT>::operator/= (const Base<eT,T1>& in)
   
   const eT* A_mem = A.memptr();
   
-  for(uword i=0; i < p_n_slices; ++i)  { arrayops::inplace_div( p.slice_memptr(i), A_mem, p_n_elem_slice ); }
+  const auto worker = [&](const uword slice, const uword start, const uword end)
+    {
+    arrayops::inplace_div( &(p.slice_memptr(slice)[start]), &(A_mem[start]), end - start );
+    };
+  
+  subview_each_mp::for_each_tile(p_n_elem_slice, p_n_slices, worker);
   }
 
 
@@ -306,14 +331,20 @@ subview_cube_each2<eT,TB>::operator= (const Base<eT,T1>& in)
   
   for(uword i=0; i < N; ++i)
     {
-    const uword slice = indices_mem[i];
-    
-    arma_conform_check_bounds( (slice >= p_n_slices), "each_slice(): index out of bounds" );
-    
-    if(p_n_elem_slice == 0)  { continue; }
-    
-    arrayops::copy(p.slice_memptr(slice), A_mem, p_n_elem_slice);
+    arma_conform_check_bounds( (indices_mem[i] >= p_n_slices), "each_slice(): index out of bounds" );
     }
+  
+  // each thread processes a separate block of elements within the slices, which is safe for repeated indices
+  
+  const auto worker = [&](const uword start, const uword end)
+    {
+    for(uword i=0; i < N; ++i)
+      {
+      arrayops::copy( &(p.slice_memptr(indices_mem[i])[start]), &(A_mem[start]), end - start );
+      }
+    };
+  
+  subview_each_mp::for_each_block(p_n_elem_slice, p_n_elem_slice * N, worker);
   }
 
 
@@ -347,14 +378,20 @@ subview_cube_each2<eT,TB>::operator+= (const Base<eT,T1>& in)
   
   for(uword i=0; i < N; ++i)
     {
-    const uword slice = indices_mem[i];
-    
-    arma_conform_check_bounds( (slice >= p_n_slices), "each_slice(): index out of bounds" );
-    
-    if(p_n_elem_slice == 0)  { continue; }
-    
-    arrayops::inplace_plus(p.slice_memptr(slice), A_mem, p_n_elem_slice);
+    arma_conform_check_bounds( (indices_mem[i] >= p_n_slices), "each_slice(): index out of bounds" );
     }
+  
+  // each thread processes a separate block of elements within the slices, which is safe for repeated indices
+  
+  const auto worker = [&](const uword start, const uword end)
+    {
+    for(uword i=0; i < N; ++i)
+      {
+      arrayops::inplace_plus( &(p.slice_memptr(indices_mem[i])[start]), &(A_mem[start]), end - start );
+      }
+    };
+  
+  subview_each_mp::for_each_block(p_n_elem_slice, p_n_elem_slice * N, worker);
   }
 
 
@@ -388,14 +425,20 @@ subview_cube_each2<eT,TB>::operator-= (const Base<eT,T1>& in)
   
   for(uword i=0; i < N; ++i)
     {
-    const uword slice = indices_mem[i];
-    
-    arma_conform_check_bounds( (slice >= p_n_slices), "each_slice(): index out of bounds" );
-    
-    if(p_n_elem_slice == 0)  { continue; }
-    
-    arrayops::inplace_minus(p.slice_memptr(slice), A_mem, p_n_elem_slice);
+    arma_conform_check_bounds( (indices_mem[i] >= p_n_slices), "each_slice(): index out of bounds" );
     }
+  
+  // each thread processes a separate block of elements within the slices, which is safe for repeated indices
+  
+  const auto worker = [&](const uword start, const uword end)
+    {
+    for(uword i=0; i < N; ++i)
+      {
+      arrayops::inplace_minus( &(p.slice_memptr(indices_mem[i])[start]), &(A_mem[start]), end - start );
+      }
+    };
+  
+  subview_each_mp::for_each_block(p_n_elem_slice, p_n_elem_slice * N, worker);
   }
 
 
@@ -429,14 +472,20 @@ subview_cube_each2<eT,TB>::operator%= (const Base<eT,T1>& in)
   
   for(uword i=0; i < N; ++i)
     {
-    const uword slice = indices_mem[i];
-    
-    arma_conform_check_bounds( (slice >= p_n_slices), "each_slice(): index out of bounds" );
-    
-    if(p_n_elem_slice == 0)  { continue; }
-    
-    arrayops::inplace_mul(p.slice_memptr(slice), A_mem, p_n_elem_slice);
+    arma_conform_check_bounds( (indices_mem[i] >= p_n_slices), "each_slice(): index out of bounds" );
     }
+  
+  // each thread processes a separate block of elements within the slices, which is safe for repeated indices
+  
+  const auto worker = [&](const uword start, const uword end)
+    {
+    for(uword i=0; i < N; ++i)
+      {
+      arrayops::inplace_mul( &(p.slice_memptr(indices_mem[i])[start]), &(A_mem[start]), end - start );
+      }
+    };
+  
+  subview_each_mp::for_each_block(p_n_elem_slice, p_n_elem_slice * N, worker);
   }
 
 
@@ -470,14 +519,20 @@ subview_cube_each2<eT,TB>::operator/= (const Base<eT,T1>& in)
   
   for(uword i=0; i < N; ++i)
     {
-    const uword slice = indices_mem[i];
-    
-    arma_conform_check_bounds( (slice >= p_n_slices), "each_slice(): index out of bounds" );
-    
-    if(p_n_elem_slice == 0)  { continue; }
-    
-    arrayops::inplace_div(p.slice_memptr(slice), A_mem, p_n_elem_slice);
+    arma_conform_check_bounds( (indices_mem[i] >= p_n_slices), "each_slice(): index out of bounds" );
     }
+  
+  // each thread processes a separate block of elements within the slices, which is safe for repeated indices
+  
+  const auto worker = [&](const uword start, const uword end)
+    {
+    for(uword i=0; i < N; ++i)
+      {
+      arrayops::inplace_div( &(p.slice_memptr(indices_mem[i])[start]), &(A_mem[start]), end - start );
+      }
+    };
+  
+  subview_each_mp::for_each_block(p_n_elem_slice, p_n_elem_slice * N, worker);
   }
 
 
@@ -512,16 +567,17 @@ subview_cube_each1_aux::operator_plus
   
   X.check_size(A);
   
-  if( (p_n_rows != 0) && (p_n_cols != 0) )
+  const eT* A_mem = A.memptr();
+  
+  const auto worker = [&](const uword slice, const uword start, const uword end)
     {
-    for(uword i=0; i < p_n_slices; ++i)
-      {
-            Mat<eT> out_slice(              out.slice_memptr(i),  p_n_rows, p_n_cols, false, true);
-      const Mat<eT>   p_slice(const_cast<eT*>(p.slice_memptr(i)), p_n_rows, p_n_cols, false, true);
-      
-      out_slice = p_slice + A;
-      }
-    }
+    const eT*   p_mem =   p.slice_memptr(slice);
+          eT* out_mem = out.slice_memptr(slice);
+    
+    for(uword k=start; k < end; ++k)  { out_mem[k] = p_mem[k] + A_mem[k]; }
+    };
+  
+  subview_each_mp::for_each_tile(p.n_elem_slice, p_n_slices, worker);
   
   return out;
   }
@@ -552,16 +608,17 @@ subview_cube_each1_aux::operator_minus
   
   X.check_size(A);
   
-  if( (p_n_rows != 0) && (p_n_cols != 0) )
+  const eT* A_mem = A.memptr();
+  
+  const auto worker = [&](const uword slice, const uword start, const uword end)
     {
-    for(uword i=0; i < p_n_slices; ++i)
-      {
-            Mat<eT> out_slice(              out.slice_memptr(i),  p_n_rows, p_n_cols, false, true);
-      const Mat<eT>   p_slice(const_cast<eT*>(p.slice_memptr(i)), p_n_rows, p_n_cols, false, true);
-      
-      out_slice = p_slice - A;
-      }
-    }
+    const eT*   p_mem =   p.slice_memptr(slice);
+          eT* out_mem = out.slice_memptr(slice);
+    
+    for(uword k=start; k < end; ++k)  { out_mem[k] = p_mem[k] - A_mem[k]; }
+    };
+  
+  subview_each_mp::for_each_tile(p.n_elem_slice, p_n_slices, worker);
   
   return out;
   }
@@ -592,16 +649,17 @@ subview_cube_each1_aux::operator_minus
   
   Y.check_size(A);
   
-  if( (p_n_rows != 0) && (p_n_cols != 0) )
+  const eT* A_mem = A.memptr();
+  
+  const auto worker = [&](const uword slice, const uword start, const uword end)
     {
-    for(uword i=0; i < p_n_slices; ++i)
-      {
-            Mat<eT> out_slice(              out.slice_memptr(i),  p_n_rows, p_n_cols, false, true);
-      const Mat<eT>   p_slice(const_cast<eT*>(p.slice_memptr(i)), p_n_rows, p_n_cols, false, true);
-      
-      out_slice = A - p_slice;
-      }
-    }
+    const eT*   p_mem =   p.slice_memptr(slice);
+          eT* out_mem = out.slice_memptr(slice);
+    
+    for(uword k=start; k < end; ++k)  { out_mem[k] = A_mem[k] - p_mem[k]; }
+    };
+  
+  subview_each_mp::for_each_tile(p.n_elem_slice, p_n_slices, worker);
   
   return out;
   }
@@ -632,16 +690,17 @@ subview_cube_each1_aux::operator_schur
   
   X.check_size(A);
   
-  if( (p_n_rows != 0) && (p_n_cols != 0) )
+  const eT* A_mem = A.memptr();
+  
+  const auto worker = [&](const uword slice, const uword start, const uword end)
     {
-    for(uword i=0; i < p_n_slices; ++i)
-      {
-            Mat<eT> out_slice(              out.slice_memptr(i),  p_n_rows, p_n_cols, false, true);
-      const Mat<eT>   p_slice(const_cast<eT*>(p.slice_memptr(i)), p_n_rows, p_n_cols, false, true);
-      
-      out_slice = p_slice % A;
-      }
-    }
+    const eT*   p_mem =   p.slice_memptr(slice);
+          eT* out_mem = out.slice_memptr(slice);
+    
+    for(uword k=start; k < end; ++k)  { out_mem[k] = p_mem[k] * A_mem[k]; }
+    };
+  
+  subview_each_mp::for_each_tile(p.n_elem_slice, p_n_slices, worker);
   
   return out;
   }
@@ -672,16 +731,17 @@ subview_cube_each1_aux::operator_div
   
   X.check_size(A);
   
-  if( (p_n_rows != 0) && (p_n_cols != 0) )
+  const eT* A_mem = A.memptr();
+  
+  const auto worker = [&](const uword slice, const uword start, const uword end)
     {
-    for(uword i=0; i < p_n_slices; ++i)
-      {
-            Mat<eT> out_slice(              out.slice_memptr(i),  p_n_rows, p_n_cols, false, true);
-      const Mat<eT>   p_slice(const_cast<eT*>(p.slice_memptr(i)), p_n_rows, p_n_cols, false, true);
-      
-      out_slice = p_slice / A;
-      }
-    }
+    const eT*   p_mem =   p.slice_memptr(slice);
+          eT* out_mem = out.slice_memptr(slice);
+    
+    for(uword k=start; k < end; ++k)  { out_mem[k] = p_mem[k] / A_mem[k]; }
+    };
+  
+  subview_each_mp::for_each_tile(p.n_elem_slice, p_n_slices, worker);
   
   return out;
   }
@@ -712,16 +772,17 @@ subview_cube_each1_aux::operator_div
   
   Y.check_size(A);
   
-  if( (p_n_rows != 0) && (p_n_cols != 0) )
+  const eT* A_mem = A.memptr();
+  
+  const auto worker = [&](const uword slice, const uword start, const uword end)
     {
-    for(uword i=0; i < p_n_slices; ++i)
-      {
-            Mat<eT> out_slice(              out.slice_memptr(i),  p_n_rows, p_n_cols, false, true);
-      const Mat<eT>   p_slice(const_cast<eT*>(p.slice_memptr(i)), p_n_rows, p_n_cols, false, true);
-      
-      out_slice = A / p_slice;
-      }
-    }
+    const eT*   p_mem =   p.slice_memptr(slice);
+          eT* out_mem = out.slice_memptr(slice);
+    
+    for(uword k=start; k < end; ++k)  { out_mem[k] = A_mem[k] / p_mem[k]; }
+    };
+  
+  subview_each_mp::for_each_tile(p.n_elem_slice, p_n_slices, worker);
   
   return out;
   }
@@ -853,15 +914,21 @@ subview_cube_each2_aux::operator_plus
   
   for(uword i=0; i < N; ++i)
     {
-    const uword slice = indices_mem[i];
-    
-    arma_conform_check_bounds( (slice >= p_n_slices), "each_slice(): index out of bounds" );
-    
-    if(p_n_elem_slice == 0)  { continue; }
-    
-    arrayops::inplace_plus(out.slice_memptr(slice), A_mem, p_n_elem_slice);
+    arma_conform_check_bounds( (indices_mem[i] >= p_n_slices), "each_slice(): index out of bounds" );
     }
   
+  // each thread processes a separate block of elements within the slices, which is safe for repeated indices
+  
+  const auto worker = [&](const uword start, const uword end)
+    {
+    for(uword i=0; i < N; ++i)
+      {
+      arrayops::inplace_plus( &(out.slice_memptr(indices_mem[i])[start]), &(A_mem[start]), end - start );
+      }
+    };
+  
+  subview_each_mp::for_each_block(p_n_elem_slice, p_n_elem_slice * N, worker);
+  
   return out;
   }
 
@@ -900,15 +967,21 @@ subview_cube_each2_aux::operator_minus
   
   for(uword i=0; i < N; ++i)
     {
-    const uword slice = indices_mem[i];
-    
-    arma_conform_check_bounds( (slice >= p_n_slices), "each_slice(): index out of bounds" );
-    
-    if(p_n_elem_slice == 0)  { continue; }
-    
-    arrayops::inplace_minus(out.slice_memptr(slice), A_mem, p_n_elem_slice);
+    arma_conform_check_bounds( (indices_mem[i] >= p_n_slices), "each_slice(): index out of bounds" );
     }
   
+  // each thread processes a separate block of elements within the slices, which is safe for repeated indices
+  
+  const auto worker = [&](const uword start, const uword end)
+    {
+    for(uword i=0; i < N; ++i)
+      {
+      arrayops::inplace_minus( &(out.slice_memptr(indices_mem[i])[start]), &(A_mem[start]), end - start );
+      }
+    };
+  
+  subview_each_mp::for_each_block(p_n_elem_slice, p_n_elem_slice * N, worker);
+  
   return out;
   }
 
@@ -927,8 +1000,6 @@ subview_cube_each2_aux::operator_minus
   
   const Cube<eT>& p = Y.P;
   
-  const uword p_n_rows   = p.n_rows;
-  const uword p_n_cols   = p.n_cols;
   const uword p_n_slices = p.n_slices;
   
   Cube<eT> out = p;
@@ -946,18 +1017,24 @@ subview_cube_each2_aux::operator_minus
   
   for(uword i=0; i < N; ++i)
     {
-    const uword slice = indices_mem[i];
-    
-    arma_conform_check_bounds( (slice >= p_n_slices), "each_slice(): index out of bounds" );
-    
-    if( (p_n_rows == 0) || (p_n_cols == 0) )  { continue; }
-    
-          Mat<eT> out_slice(              out.slice_memptr(slice),  p_n_rows, p_n_cols, false, true);
-    const Mat<eT>   p_slice(const_cast<eT*>(p.slice_memptr(slice)), p_n_rows, p_n_cols, false, true);
-    
-    out_slice = A - p_slice;
+    arma_conform_check_bounds( (indices_mem[i] >= p_n_slices), "each_slice(): index out of bounds" );
     }
   
+  const eT* A_mem = A.memptr();
+  
+  const auto worker = [&](const uword start, const uword end)
+    {
+    for(uword i=0; i < N; ++i)
+      {
+      const eT*   p_mem =   p.slice_memptr(indices_mem[i]);
+            eT* out_mem = out.slice_memptr(indices_mem[i]);
+      
+      for(uword k=start; k < end; ++k)  { out_mem[k] = A_mem[k] - p_mem[k]; }
+      }
+    };
+  
+  subview_each_mp::for_each_block(p.n_elem_slice, p.n_elem_slice * N, worker);
+  
   return out;
   }
 
@@ -996,15 +1073,21 @@ subview_cube_each2_aux::operator_schur
   
   for(uword i=0; i < N; ++i)
     {
-    const uword slice = indices_mem[i];
-    
-    arma_conform_check_bounds( (slice >= p_n_slices), "each_slice(): index out of bounds" );
-    
-    if(p_n_elem_slice == 0)  { continue; }
-    
-    arrayops::inplace_mul(out.slice_memptr(slice), A_mem, p_n_elem_slice);
+    arma_conform_check_bounds( (indices_mem[i] >= p_n_slices), "each_slice(): index out of bounds" );
     }
   
+  // each thread processes a separate block of elements within the slices, which is safe for repeated indices
+  
+  const auto worker = [&](const uword start, const uword end)
+    {
+    for(uword i=0; i < N; ++i)
+      {
+      arrayops::inplace_mul( &(out.slice_memptr(indices_mem[i])[start]), &(A_mem[start]), end - start );
+      }
+    };
+  
+  subview_each_mp::for_each_block(p_n_elem_slice, p_n_elem_slice * N, worker);
+  
   return out;
   }
 
@@ -1043,15 +1126,21 @@ subview_cube_each2_aux::operator_div
   
   for(uword i=0; i < N; ++i)
     {
-    const uword slice = indices_mem[i];
-    
-    arma_conform_check_bounds( (slice >= p_n_slices), "each_slice(): index out of bounds" );
-    
-    if(p_n_elem_slice == 0)  { continue; }
-    
-    arrayops::inplace_div(out.slice_memptr(slice), A_mem, p_n_elem_slice);
+    arma_conform_check_bounds( (indices_mem[i] >= p_n_slices), "each_slice(): index out of bounds" );
     }
   
+  // each thread processes a separate block of elements within the slices, which is safe for repeated indices
+  
+  const auto worker = [&](const uword start, const uword end)
+    {
+    for(uword i=0; i < N; ++i)
+      {
+      arrayops::inplace_div( &(out.slice_memptr(indices_mem[i])[start]), &(A_mem[start]), end - start );
+      }
+    };
+  
+  subview_each_mp::for_each_block(p_n_elem_slice, p_n_elem_slice * N, worker);
+  
   return out;
   }
 
@@ -1070,8 +1159,6 @@ subview_cube_each2_aux::operator_div
   
   const Cube<eT>& p = Y.P;
   
-  const uword p_n_rows   = p.n_rows;
-  const uword p_n_cols   = p.n_cols;
   const uword p_n_slices = p.n_slices;
   
   Cube<eT> out = p;
@@ -1089,18 +1176,24 @@ subview_cube_each2_aux::operator_div
   
   for(uword i=0; i < N; ++i)
     {
-    const uword slice = indices_mem[i];
-    
-    arma_conform_check_bounds( (slice >= p_n_slices), "each_slice(): index out of bounds" );
-    
-    if( (p_n_rows == 0) || (p_n_cols == 0) )  { continue; }
-    
-          Mat<eT> out_slice(              out.slice_memptr(slice),  p_n_rows, p_n_cols, false, true);
-    const Mat<eT>   p_slice(const_cast<eT*>(p.slice_memptr(slice)), p_n_rows, p_n_cols, false, true);
-    
-    out_slice = A / p_slice;
+    arma_conform_check_bounds( (indices_mem[i] >= p_n_slices), "each_slice(): index out of bounds" );
     }
   
+  const eT* A_mem = A.memptr();
+  
+  const auto worker = [&](const uword start, const uword end)
+    {
+    for(uword i=0; i < N; ++i)
+      {
+      const eT*   p_mem =   p.slice_memptr(indices_mem[i]);
+            eT* out_mem = out.slice_memptr(indices_mem[i]);
+      
+      for(uword k=start; k < end; ++k)  { out_mem[k] = A_mem[k] / p_mem[k]; }
+      }
+    };
+  
+  subview_each_mp::for_each_block(p.n_elem_slice, p.n_elem_slice * N, worker);
+  
   return out;
   }
 
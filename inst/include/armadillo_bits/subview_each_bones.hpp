@@ -21,6 +21,36 @@
 
 
 
+//! work partitioning for each_col(), each_row() and each_slice() operations;
+//! the element-wise operations are cheap, so threads are only used for large objects
+struct subview_each_mp
+  {
+  static constexpr uword min_n_elem = 16384;
+  
+  inline static bool use_mp(const uword n_elem);
+  
+  // F(col, row_start, row_end) is called for disjoint tiles covering an n_rows x n_cols area;
+  // columns are split into blocks of rows when there are fewer columns than threads
+  template<typename functor>
+  inline static void for_each_tile(const uword n_rows, const uword n_cols, const functor& F);
+  
+  // F(start, end) is called for disjoint blocks covering [0, N); n_work is the total number of elements touched
+  template<typename functor>
+  inline static void for_each_block(const uword N, const uword n_work, const functor& F);
+  
+  inline static void keep_first_exception(std::exception_ptr& caught);
+  
+  // parallel forms of the lambda variants of .each_col() and .each_row(); X is a Mat or subview;
+  // if F throws, the remaining calls still take place and the first exception is rethrown afterwards
+  template<typename T1, typename functor>
+  inline static void each_col_lambda(const T1& X, const functor& F);
+  
+  template<typename T1, typename functor>
+  inline static void each_row_lambda(const T1& X, const functor& F, const bool write_back);
+  };
+
+
+
 template<typename parent, unsigned int mode>
 class subview_each_common
   {
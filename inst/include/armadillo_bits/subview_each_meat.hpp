@@ -20,6 +20,251 @@
 //! @{
 
 
+
+//
+//
+// subview_each_mp
+
+inline
+bool
+subview_each_mp::use_mp(const uword n_elem)
+  {
+  return (arma_config::openmp) && (n_elem >= subview_each_mp::min_n_elem) && (mp_thread_limit::in_parallel() == false) && (mp_thread_limit::get() > 1);
+  }
+
+
+
+template<typename functor>
+inline
+void
+subview_each_mp::for_each_tile(const uword n_rows, const uword n_cols, const functor& F)
+  {
+  arma_debug_sigprint();
+  
+  if( (n_rows == 0) || (n_cols == 0) )  { return; }
+  
+  if(subview_each_mp::use_mp(n_rows * n_cols) == false)
+    {
+    for(uword col=0; col < n_cols; ++col)  { F(col, uword(0), n_rows); }
+    
+    return;
+    }
+  
+  #if defined(ARMA_USE_OPENMP)
+    {
+    const int n_threads = mp_thread_limit::get();
+    
+    const uword n_blocks_wanted = (n_cols >= uword(n_threads)) ? uword(1) : ((uword(n_threads) + n_cols - 1) / n_cols);
+    const uword n_blocks_max    = (std::max)(uword(1), n_rows / uword(1024));
+    
+    const uword n_blocks   = (std::min)(n_blocks_wanted, n_blocks_max);
+    const uword block_size = (n_rows + n_blocks - 1) / n_blocks;
+    const uword n_tiles    = n_cols * n_blocks;
+    
+    #pragma omp parallel for schedule(static) num_threads(n_threads)
+    for(uword tile=0; tile < n_tiles; ++tile)
+      {
+      const uword col       = tile / n_blocks;
+      const uword row_start = (tile % n_blocks) * block_size;
+      const uword row_end   = (std::min)(row_start + block_size, n_rows);
+      
+      if(row_start < row_end)  { F(col, row_start, row_end); }
+      }
+    }
+  #endif
+  }
+
+
+
+template<typename functor>
+inline
+void
+subview_each_mp::for_each_block(const uword N, const uword n_work, const functor& F)
+  {
+  arma_debug_sigprint();
+  
+  if(N == 0)  { return; }
+  
+  if(subview_each_mp::use_mp(n_work) == false)  { F(uword(0), N); return; }
+  
+  #if defined(ARMA_USE_OPENMP)
+    {
+    const int n_threads = mp_thread_limit::get();
+    
+    const uword n_blocks   = (std::min)(N, uword(4*n_threads));
+    const uword block_size = (N + n_blocks - 1) / n_blocks;
+    
+    #pragma omp parallel for schedule(static) num_threads(n_threads)
+    for(uword block=0; block < n_blocks; ++block)
+      {
+      const uword start = block * block_size;
+      const uword end   = (std::min)(start + block_size, N);
+      
+      if(start < end)  { F(start, end); }
+      }
+    }
+  #endif
+  }
+
+
+
+//! called from a catch block inside a parallel region; exceptions must not escape the region,
+//! so the first one is stored and rethrown by the caller once all threads have finished
+inline
+void
+subview_each_mp::keep_first_exception(std::exception_ptr& caught)
+  {
+  #if defined(ARMA_USE_OPENMP)
+    {
+    #pragma omp critical (arma_subview_each_mp_exception)
+      {
+      if(!caught)  { caught = std::current_exception(); }
+      }
+    }
+  #else
+    {
+    if(!caught)  { caught = std::current_exception(); }
+    }
+  #endif
+  }
+
+
+
+template<typename T1, typename functor>
+inline
+void
+subview_each_mp::each_col_lambda(const T1& X, const functor& F)
+  {
+  arma_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  
+  const uword local_n_rows = X.n_rows;
+  const uword local_n_cols = X.n_cols;
+  
+  #if defined(ARMA_USE_OPENMP)
+    {
+    const int n_threads = mp_thread_limit::get();
+    
+    std::exception_ptr caught;
+    
+    #pragma omp parallel for schedule(static) num_threads(n_threads)
+    for(uword ii=0; ii < local_n_cols; ++ii)
+      {
+      try
+        {
+        Col<eT> tmp(const_cast<eT*>(X.colptr(ii)), local_n_rows, false, true);
+        F(tmp);
+        }
+      catch(...)
+        {
+        subview_each_mp::keep_first_exception(caught);
+        }
+      }
+    
+    if(caught)  { std::rethrow_exception(caught); }
+    }
+  #else
+    {
+    for(uword ii=0; ii < local_n_cols; ++ii)
+      {
+      Col<eT> tmp(const_cast<eT*>(X.colptr(ii)), local_n_rows, false, true);
+      F(tmp);
+      }
+    }
+  #endif
+  }
+
+
+
+//! each thread gathers a block of rows into its own buffer (allocated before the parallel region),
+//! calls F() on each buffered row, and optionally scatters the rows back;
+//! gather and scatter walk each column over the block, so memory accesses stay mostly contiguous
+template<typename T1, typename functor>
+inline
+void
+subview_each_mp::each_row_lambda(const T1& X, const functor& F, const bool write_back)
+  {
+  arma_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  
+  const uword local_n_rows = X.n_rows;
+  const uword local_n_cols = X.n_cols;
+  
+  if( (local_n_rows == 0) || (local_n_cols == 0) )  { return; }
+  
+  const uword block_size = 8;
+  const uword n_blocks   = (local_n_rows + block_size - 1) / block_size;
+  
+  #if defined(ARMA_USE_OPENMP)
+    const int n_threads = mp_thread_limit::get();
+  #else
+    const int n_threads = 1;
+  #endif
+  
+  Mat<eT> buf(local_n_cols, block_size * uword(n_threads), arma_nozeros_indicator());
+  
+  const auto worker = [&](const uword thread_id, const uword block)
+    {
+    const uword row_start = block * block_size;
+    const uword row_end   = (std::min)(row_start + block_size, local_n_rows);
+    const uword len       = row_end - row_start;
+    
+    eT* buf_mem = buf.colptr(thread_id * block_size);
+    
+    for(uword col_id=0; col_id < local_n_cols; ++col_id)
+      {
+      const eT* col_mem = &(X.colptr(col_id)[row_start]);
+      
+      for(uword k=0; k < len; ++k)  { buf_mem[col_id + k*local_n_cols] = col_mem[k]; }
+      }
+    
+    for(uword k=0; k < len; ++k)
+      {
+      Row<eT> tmp(&buf_mem[k*local_n_cols], local_n_cols, false, true);
+      F(tmp);
+      }
+    
+    if(write_back)
+      {
+      for(uword col_id=0; col_id < local_n_cols; ++col_id)
+        {
+        eT* col_mem = const_cast<eT*>(&(X.colptr(col_id)[row_start]));
+        
+        for(uword k=0; k < len; ++k)  { col_mem[k] = buf_mem[col_id + k*local_n_cols]; }
+        }
+      }
+    };
+  
+  #if defined(ARMA_USE_OPENMP)
+    {
+    std::exception_ptr caught;
+    
+    #pragma omp parallel for schedule(static) num_threads(n_threads)
+    for(uword block=0; block < n_blocks; ++block)
+      {
+      try
+        {
+        worker(uword(omp_get_thread_num()), block);
+        }
+      catch(...)
+        {
+        subview_each_mp::keep_first_exception(caught);
+        }
+      }
+    
+    if(caught)  { std::rethrow_exception(caught); }
+    }
+  #else
+    {
+    for(uword block=0; block < n_blocks; ++block)  { worker(uword(0), block); }
+    }
+  #endif
+  }
+
+
+
 //
 //
 // subview_each_common
@@ -161,17 +406,21 @@ subview_each1<parent,mode>::operator= (const Base<eT,T1>& in)
   
   if(mode == 0) // each column
     {
-    for(uword i=0; i < p_n_cols; ++i)
+    const auto worker = [&](const uword col, const uword row_start, const uword row_end)
       {
-      arrayops::copy( p.colptr(i), A_mem, p_n_rows );
-      }
+      arrayops::copy( &(p.colptr(col)[row_start]), &(A_mem[row_start]), row_end - row_start );
+      };
+    
+    subview_each_mp::for_each_tile(p_n_rows, p_n_cols, worker);
     }
   else // each row
     {
-    for(uword i=0; i < p_n_cols; ++i)
+    const auto worker = [&](const uword col, const uword row_start, const uword row_end)
       {
-      arrayops::inplace_set( p.colptr(i), A_mem[i], p_n_rows);
-      }
+      arrayops::inplace_set( &(p.colptr(col)[row_start]), A_mem[col], row_end - row_start );
+      };
+    
+    subview_each_mp::for_each_tile(p_n_rows, p_n_cols, worker);
     }
   }
 
@@ -200,17 +449,21 @@ subview_each1<parent,mode>::operator+= (const Base<eT,T1>& in)
   
   if(mode == 0) // each column
     {
-    for(uword i=0; i < p_n_cols; ++i)
+    const auto worker = [&](const uword col, const uword row_start, const uword row_end)
       {
-      arrayops::inplace_plus( p.colptr(i), A_mem, p_n_rows );
-      }
+      arrayops::inplace_plus( &(p.colptr(col)[row_start]), &(A_mem[row_start]), row_end - row_start );
+      };
+    
+    subview_each_mp::for_each_tile(p_n_rows, p_n_cols, worker);
     }
   else // each row
     {
-    for(uword i=0; i < p_n_cols; ++i)
+    const auto worker = [&](const uword col, const uword row_start, const uword row_end)
       {
-      arrayops::inplace_plus( p.colptr(i), A_mem[i], p_n_rows);
-      }
+      arrayops::inplace_plus( &(p.colptr(col)[row_start]), A_mem[col], row_end - row_start );
+      };
+    
+    subview_each_mp::for_each_tile(p_n_rows, p_n_cols, worker);
     }
   }
 
@@ -239,17 +492,21 @@ subview_each1<parent,mode>::operator-= (const Base<eT,T1>& in)
   
   if(mode == 0) // each column
     {
-    for(uword i=0; i < p_n_cols; ++i)
+    const auto worker = [&](const uword col, const uword row_start, const uword row_end)
       {
-      arrayops::inplace_minus( p.colptr(i), A_mem, p_n_rows );
-      }
+      arrayops::inplace_minus( &(p.colptr(col)[row_start]), &(A_mem[row_start]), row_end - row_start );
+      };
+    
+    subview_each_mp::for_each_tile(p_n_rows, p_n_cols, worker);
     }
   else // each row
     {
-    for(uword i=0; i < p_n_cols; ++i)
+    const auto worker = [&](const uword col, const uword row_start, const uword row_end)
       {
-      arrayops::inplace_minus( p.colptr(i), A_mem[i], p_n_rows);
-      }
+      arrayops::inplace_minus( &(p.colptr(col)[row_start]), A_mem[col], row_end - row_start );
+      };
+    
+    subview_each_mp::for_each_tile(p_n_rows, p_n_cols, worker);
     }
   }
 
@@ -278,17 +535,21 @@ subview_each1<parent,mode>::operator%= (const Base<eT,T1>& in)
   
   if(mode == 0) // each column
     {
-    for(uword i=0; i < p_n_cols; ++i)
+    const auto worker = [&](const uword col, const uword row_start, const uword row_end)
       {
-      arrayops::inplace_mul( p.colptr(i), A_mem, p_n_rows );
-      }
+      arrayops::inplace_mul( &(p.colptr(col)[row_start]), &(A_mem[row_start]), row_end - row_start );
+      };
+    
+    subview_each_mp::for_each_tile(p_n_rows, p_n_cols, worker);
     }
   else // each row
     {
-    for(uword i=0; i < p_n_cols; ++i)
+    const auto worker = [&](const uword col, const uword row_start, const uword row_end)
       {
-      arrayops::inplace_mul( p.colptr(i), A_mem[i], p_n_rows);
-      }
+      arrayops::inplace_mul( &(p.colptr(col)[row_start]), A_mem[col], row_end - row_start );
+      };
+    
+    subview_each_mp::for_each_tile(p_n_rows, p_n_cols, worker);
     }
   }
 
@@ -317,17 +578,21 @@ subview_each1<parent,mode>::operator/= (const Base<eT,T1>& in)
   
   if(mode == 0) // each column
     {
-    for(uword i=0; i < p_n_cols; ++i)
+    const auto worker = [&](const uword col, const uword row_start, const uword row_end)
       {
-      arrayops::inplace_div( p.colptr(i), A_mem, p_n_rows );
-      }
+      arrayops::inplace_div( &(p.colptr(col)[row_start]), &(A_mem[row_start]), row_end - row_start );
+      };
+    
+    subview_each_mp::for_each_tile(p_n_rows, p_n_cols, worker);
     }
   else // each row
     {
-    for(uword i=0; i < p_n_cols; ++i)
+    const auto worker = [&](const uword col, const uword row_start, const uword row_end)
       {
-      arrayops::inplace_div( p.colptr(i), A_mem[i], p_n_rows);
-      }
+      arrayops::inplace_div( &(p.colptr(col)[row_start]), A_mem[col], row_end - row_start );
+      };
+    
+    subview_each_mp::for_each_tile(p_n_rows, p_n_cols, worker);
     }
   }
 
@@ -406,28 +671,42 @@ subview_each2<parent,mode,TB>::operator= (const Base<eT,T1>& in)
     {
     for(uword i=0; i < N; ++i)
       {
-      const uword col = indices_mem[i];
-      
-      arma_conform_check_bounds( (col >= p_n_cols), "each_col(): index out of bounds" );
-      
-      if(p_n_rows == 0)  { continue; }
-      
-      arrayops::copy( p.colptr(col), A_mem, p_n_rows );
+      arma_conform_check_bounds( (indices_mem[i] >= p_n_cols), "each_col(): index out of bounds" );
       }
+    
+    // each thread processes a separate block of rows, which is safe for repeated indices
+    
+    const auto worker = [&](const uword row_start, const uword row_end)
+      {
+      for(uword i=0; i < N; ++i)
+        {
+        arrayops::copy( &(p.colptr(indices_mem[i])[row_start]), &(A_mem[row_start]), row_end - row_start );
+        }
+      };
+    
+    subview_each_mp::for_each_block(p_n_rows, p_n_rows * N, worker);
     }
   else // each row
     {
     for(uword i=0; i < N; ++i)
       {
-      const uword row = indices_mem[i];
-      
-      arma_conform_check_bounds( (row >= p_n_rows), "each_row(): index out of bounds" );
-      
-      for(uword col=0; col < p_n_cols; ++col)
+      arma_conform_check_bounds( (indices_mem[i] >= p_n_rows), "each_row(): index out of bounds" );
+      }
+    
+    // traverse columns in storage order, rather than one row at a time
+    
+    const auto worker = [&](const uword col_start, const uword col_end)
+      {
+      for(uword col=col_start; col < col_end; ++col)
         {
-        p.at(row,col) = A_mem[col];
+              eT* col_mem = p.colptr(col);
+        const eT  A_val   = A_mem[col];
+        
+        for(uword i=0; i < N; ++i)  { col_mem[indices_mem[i]] = A_val; }
         }
-      }
+      };
+    
+    subview_each_mp::for_each_block(p_n_cols, p_n_cols * N, worker);
     }
   }
 
@@ -452,6 +731,7 @@ subview_each2<parent,mode,TB>::operator+= (const Base<eT,T1>& in)
   
   check_indices(U.M);
   
+  const eT*   A_mem    = A.memptr();
   const uword p_n_rows = p.n_rows;
   const uword p_n_cols = p.n_cols;
   
@@ -460,29 +740,44 @@ subview_each2<parent,mode,TB>::operator+= (const Base<eT,T1>& in)
   
   if(mode == 0) // each column
     {
-    const eT* A_mem = A.memptr();
-    
     for(uword i=0; i < N; ++i)
       {
-      const uword col = indices_mem[i];
-      
-      arma_conform_check_bounds( (col >= p_n_cols), "each_col(): index out of bounds" );
-      
-      if(p_n_rows == 0)  { continue; }
-      
-      arrayops::inplace_plus( p.colptr(col), A_mem, p_n_rows );
+      arma_conform_check_bounds( (indices_mem[i] >= p_n_cols), "each_col(): index out of bounds" );
       }
+    
+    // each thread processes a separate block of rows, which is safe for repeated indices
+    
+    const auto worker = [&](const uword row_start, const uword row_end)
+      {
+      for(uword i=0; i < N; ++i)
+        {
+        arrayops::inplace_plus( &(p.colptr(indices_mem[i])[row_start]), &(A_mem[row_start]), row_end - row_start );
+        }
+      };
+    
+    subview_each_mp::for_each_block(p_n_rows, p_n_rows * N, worker);
     }
   else // each row
     {
     for(uword i=0; i < N; ++i)
       {
-      const uword row = indices_mem[i];
-      
-      arma_conform_check_bounds( (row >= p_n_rows), "each_row(): index out of bounds" );
-      
-      p.row(row) += A;
+      arma_conform_check_bounds( (indices_mem[i] >= p_n_rows), "each_row(): index out of bounds" );
       }
+    
+    // traverse columns in storage order, rather than one row at a time
+    
+    const auto worker = [&](const uword col_start, const uword col_end)
+      {
+      for(uword col=col_start; col < col_end; ++col)
+        {
+              eT* col_mem = p.colptr(col);
+        const eT  A_val   = A_mem[col];
+        
+        for(uword i=0; i < N; ++i)  { col_mem[indices_mem[i]] += A_val; }
+        }
+      };
+    
+    subview_each_mp::for_each_block(p_n_cols, p_n_cols * N, worker);
     }
   }
 
@@ -507,6 +802,7 @@ subview_each2<parent,mode,TB>::operator-= (const Base<eT,T1>& in)
   
   check_indices(U.M);
   
+  const eT*   A_mem    = A.memptr();
   const uword p_n_rows = p.n_rows;
   const uword p_n_cols = p.n_cols;
   
@@ -515,29 +811,44 @@ subview_each2<parent,mode,TB>::operator-= (const Base<eT,T1>& in)
   
   if(mode == 0) // each column
     {
-    const eT* A_mem = A.memptr();
-    
     for(uword i=0; i < N; ++i)
       {
-      const uword col = indices_mem[i];
-      
-      arma_conform_check_bounds( (col >= p_n_cols), "each_col(): index out of bounds" );
-      
-      if(p_n_rows == 0)  { continue; }
-      
-      arrayops::inplace_minus( p.colptr(col), A_mem, p_n_rows );
+      arma_conform_check_bounds( (indices_mem[i] >= p_n_cols), "each_col(): index out of bounds" );
       }
+    
+    // each thread processes a separate block of rows, which is safe for repeated indices
+    
+    const auto worker = [&](const uword row_start, const uword row_end)
+      {
+      for(uword i=0; i < N; ++i)
+        {
+        arrayops::inplace_minus( &(p.colptr(indices_mem[i])[row_start]), &(A_mem[row_start]), row_end - row_start );
+        }
+      };
+    
+    subview_each_mp::for_each_block(p_n_rows, p_n_rows * N, worker);
     }
   else // each row
     {
     for(uword i=0; i < N; ++i)
       {
-      const uword row = indices_mem[i];
-      
-      arma_conform_check_bounds( (row >= p_n_rows), "each_row(): index out of bounds" );
-      
-      p.row(row) -= A;
+      arma_conform_check_bounds( (indices_mem[i] >= p_n_rows), "each_row(): index out of bounds" );
       }
+    
+    // traverse columns in storage order, rather than one row at a time
+    
+    const auto worker = [&](const uword col_start, const uword col_end)
+      {
+      for(uword col=col_start; col < col_end; ++col)
+        {
+              eT* col_mem = p.colptr(col);
+        const eT  A_val   = A_mem[col];
+        
+        for(uword i=0; i < N; ++i)  { col_mem[indices_mem[i]] -= A_val; }
+        }
+      };
+    
+    subview_each_mp::for_each_block(p_n_cols, p_n_cols * N, worker);
     }
   }
 
@@ -562,6 +873,7 @@ subview_each2<parent,mode,TB>::operator%= (const Base<eT,T1>& in)
   
   check_indices(U.M);
   
+  const eT*   A_mem    = A.memptr();
   const uword p_n_rows = p.n_rows;
   const uword p_n_cols = p.n_cols;
   
@@ -570,29 +882,44 @@ subview_each2<parent,mode,TB>::operator%= (const Base<eT,T1>& in)
   
   if(mode == 0) // each column
     {
-    const eT* A_mem = A.memptr();
-    
     for(uword i=0; i < N; ++i)
       {
-      const uword col = indices_mem[i];
-      
-      arma_conform_check_bounds( (col >= p_n_cols), "each_col(): index out of bounds" );
-      
-      if(p_n_rows == 0)  { continue; }
-      
-      arrayops::inplace_mul( p.colptr(col), A_mem, p_n_rows );
+      arma_conform_check_bounds( (indices_mem[i] >= p_n_cols), "each_col(): index out of bounds" );
       }
+    
+    // each thread processes a separate block of rows, which is safe for repeated indices
+    
+    const auto worker = [&](const uword row_start, const uword row_end)
+      {
+      for(uword i=0; i < N; ++i)
+        {
+        arrayops::inplace_mul( &(p.colptr(indices_mem[i])[row_start]), &(A_mem[row_start]), row_end - row_start );
+        }
+      };
+    
+    subview_each_mp::for_each_block(p_n_rows, p_n_rows * N, worker);
     }
   else // each row
     {
     for(uword i=0; i < N; ++i)
       {
-      const uword row = indices_mem[i];
-      
-      arma_conform_check_bounds( (row >= p_n_rows), "each_row(): index out of bounds" );
-      
-      p.row(row) %= A;
+      arma_conform_check_bounds( (indices_mem[i] >= p_n_rows), "each_row(): index out of bounds" );
       }
+    
+    // traverse columns in storage order, rather than one row at a time
+    
+    const auto worker = [&](const uword col_start, const uword col_end)
+      {
+      for(uword col=col_start; col < col_end; ++col)
+        {
+              eT* col_mem = p.colptr(col);
+        const eT  A_val   = A_mem[col];
+        
+        for(uword i=0; i < N; ++i)  { col_mem[indices_mem[i]] *= A_val; }
+        }
+      };
+    
+    subview_each_mp::for_each_block(p_n_cols, p_n_cols * N, worker);
     }
   }
 
@@ -617,6 +944,7 @@ subview_each2<parent,mode,TB>::operator/= (const Base<eT,T1>& in)
   
   check_indices(U.M);
   
+  const eT*   A_mem    = A.memptr();
   const uword p_n_rows = p.n_rows;
   const uword p_n_cols = p.n_cols;
   
@@ -625,29 +953,44 @@ subview_each2<parent,mode,TB>::operator/= (const Base<eT,T1>& in)
   
   if(mode == 0) // each column
     {
-    const eT* A_mem = A.memptr();
-    
     for(uword i=0; i < N; ++i)
       {
-      const uword col = indices_mem[i];
-      
-      arma_conform_check_bounds( (col >= p_n_cols), "each_col(): index out of bounds" );
-      
-      if(p_n_rows == 0)  { continue; }
-      
-      arrayops::inplace_div( p.colptr(col), A_mem, p_n_rows );
+      arma_conform_check_bounds( (indices_mem[i] >= p_n_cols), "each_col(): index out of bounds" );
       }
+    
+    // each thread processes a separate block of rows, which is safe for repeated indices
+    
+    const auto worker = [&](const uword row_start, const uword row_end)
+      {
+      for(uword i=0; i < N; ++i)
+        {
+        arrayops::inplace_div( &(p.colptr(indices_mem[i])[row_start]), &(A_mem[row_start]), row_end - row_start );
+        }
+      };
+    
+    subview_each_mp::for_each_block(p_n_rows, p_n_rows * N, worker);
     }
   else // each row
     {
     for(uword i=0; i < N; ++i)
       {
-      const uword row = indices_mem[i];
-      
-      arma_conform_check_bounds( (row >= p_n_rows), "each_row(): index out of bounds" );
-      
-      p.row(row) /= A;
+      arma_conform_check_bounds( (indices_mem[i] >= p_n_rows), "each_row(): index out of bounds" );
       }
+    
+    // traverse columns in storage order, rather than one row at a time
+    
+    const auto worker = [&](const uword col_start, const uword col_end)
+      {
+      for(uword col=col_start; col < col_end; ++col)
+        {
+              eT* col_mem = p.colptr(col);
+        const eT  A_val   = A_mem[col];
+        
+        for(uword i=0; i < N; ++i)  { col_mem[indices_mem[i]] /= A_val; }
+        }
+      };
+    
+    subview_each_mp::for_each_block(p_n_cols, p_n_cols * N, worker);
     }
   }
 
@@ -690,32 +1033,36 @@ subview_each1_aux::operator_plus
     {
     if(mode == 0) // each column
       {
-      for(uword i=0; i < p_n_cols; ++i)
+      const auto worker = [&](const uword col, const uword row_start, const uword row_end)
         {
-        const eT*   p_mem =   p.colptr(i);
-              eT* out_mem = out.colptr(i);
+        const eT*   p_mem =   p.colptr(col);
+              eT* out_mem = out.colptr(col);
         
-        for(uword row=0; row < p_n_rows; ++row)
+        for(uword row=row_start; row < row_end; ++row)
           {
           out_mem[row] = p_mem[row] + A_mem[row];
           }
-        }
+        };
+      
+      subview_each_mp::for_each_tile(p_n_rows, p_n_cols, worker);
       }
     
     if(mode == 1) // each row
       {
-      for(uword i=0; i < p_n_cols; ++i)
+      const auto worker = [&](const uword col, const uword row_start, const uword row_end)
         {
-        const eT*   p_mem =   p.colptr(i);
-              eT* out_mem = out.colptr(i);
+        const eT*   p_mem =   p.colptr(col);
+              eT* out_mem = out.colptr(col);
         
-        const eT A_val = A_mem[i];
+        const eT A_val = A_mem[col];
         
-        for(uword row=0; row < p_n_rows; ++row)
+        for(uword row=row_start; row < row_end; ++row)
           {
           out_mem[row] = p_mem[row] + A_val;
           }
-        }
+        };
+      
+      subview_each_mp::for_each_tile(p_n_rows, p_n_cols, worker);
       }
     }
   
@@ -755,32 +1102,36 @@ subview_each1_aux::operator_minus
     {
     if(mode == 0) // each column
       {
-      for(uword i=0; i < p_n_cols; ++i)
+      const auto worker = [&](const uword col, const uword row_start, const uword row_end)
         {
-        const eT*   p_mem =   p.colptr(i);
-              eT* out_mem = out.colptr(i);
+        const eT*   p_mem =   p.colptr(col);
+              eT* out_mem = out.colptr(col);
         
-        for(uword row=0; row < p_n_rows; ++row)
+        for(uword row=row_start; row < row_end; ++row)
           {
           out_mem[row] = p_mem[row] - A_mem[row];
           }
-        }
+        };
+      
+      subview_each_mp::for_each_tile(p_n_rows, p_n_cols, worker);
       }
     
     if(mode == 1) // each row
       {
-      for(uword i=0; i < p_n_cols; ++i)
+      const auto worker = [&](const uword col, const uword row_start, const uword row_end)
         {
-        const eT*   p_mem =   p.colptr(i);
-              eT* out_mem = out.colptr(i);
+        const eT*   p_mem =   p.colptr(col);
+              eT* out_mem = out.colptr(col);
         
-        const eT A_val = A_mem[i];
+        const eT A_val = A_mem[col];
         
-        for(uword row=0; row < p_n_rows; ++row)
+        for(uword row=row_start; row < row_end; ++row)
           {
           out_mem[row] = p_mem[row] - A_val;
           }
-        }
+        };
+      
+      subview_each_mp::for_each_tile(p_n_rows, p_n_cols, worker);
       }
     }
   
@@ -820,32 +1171,36 @@ subview_each1_aux::operator_minus
     {
     if(mode == 0) // each column
       {
-      for(uword i=0; i < p_n_cols; ++i)
+      const auto worker = [&](const uword col, const uword row_start, const uword row_end)
         {
-        const eT*   p_mem =   p.colptr(i);
-              eT* out_mem = out.colptr(i);
+        const eT*   p_mem =   p.colptr(col);
+              eT* out_mem = out.colptr(col);
         
-        for(uword row=0; row < p_n_rows; ++row)
+        for(uword row=row_start; row < row_end; ++row)
           {
           out_mem[row] = A_mem[row] - p_mem[row];
           }
-        }
+        };
+      
+      subview_each_mp::for_each_tile(p_n_rows, p_n_cols, worker);
       }
     
     if(mode == 1) // each row
       {
-      for(uword i=0; i < p_n_cols; ++i)
+      const auto worker = [&](const uword col, const uword row_start, const uword row_end)
         {
-        const eT*   p_mem =   p.colptr(i);
-              eT* out_mem = out.colptr(i);
+        const eT*   p_mem =   p.colptr(col);
+              eT* out_mem = out.colptr(col);
         
-        const eT A_val = A_mem[i];
+        const eT A_val = A_mem[col];
         
-        for(uword row=0; row < p_n_rows; ++row)
+        for(uword row=row_start; row < row_end; ++row)
           {
           out_mem[row] = A_val - p_mem[row];
           }
-        }
+        };
+      
+      subview_each_mp::for_each_tile(p_n_rows, p_n_cols, worker);
       }
     }
   
@@ -885,32 +1240,36 @@ subview_each1_aux::operator_schur
     {
     if(mode == 0) // each column
       {
-      for(uword i=0; i < p_n_cols; ++i)
+      const auto worker = [&](const uword col, const uword row_start, const uword row_end)
         {
-        const eT*   p_mem =   p.colptr(i);
-              eT* out_mem = out.colptr(i);
+        const eT*   p_mem =   p.colptr(col);
+              eT* out_mem = out.colptr(col);
         
-        for(uword row=0; row < p_n_rows; ++row)
+        for(uword row=row_start; row < row_end; ++row)
           {
           out_mem[row] = p_mem[row] * A_mem[row];
           }
-        }
+        };
+      
+      subview_each_mp::for_each_tile(p_n_rows, p_n_cols, worker);
       }
     
     if(mode == 1) // each row
       {
-      for(uword i=0; i < p_n_cols; ++i)
+      const auto worker = [&](const uword col, const uword row_start, const uword row_end)
         {
-        const eT*   p_mem =   p.colptr(i);
-              eT* out_mem = out.colptr(i);
+        const eT*   p_mem =   p.colptr(col);
+              eT* out_mem = out.colptr(col);
         
-        const eT A_val = A_mem[i];
+        const eT A_val = A_mem[col];
         
-        for(uword row=0; row < p_n_rows; ++row)
+        for(uword row=row_start; row < row_end; ++row)
           {
           out_mem[row] = p_mem[row] * A_val;
           }
-        }
+        };
+      
+      subview_each_mp::for_each_tile(p_n_rows, p_n_cols, worker);
       }
     }
   
@@ -950,32 +1309,36 @@ subview_each1_aux::operator_div
     {
     if(mode == 0) // each column
       {
-      for(uword i=0; i < p_n_cols; ++i)
+      const auto worker = [&](const uword col, const uword row_start, const uword row_end)
         {
-        const eT*   p_mem =   p.colptr(i);
-              eT* out_mem = out.colptr(i);
+        const eT*   p_mem =   p.colptr(col);
+              eT* out_mem = out.colptr(col);
         
-        for(uword row=0; row < p_n_rows; ++row)
+        for(uword row=row_start; row < row_end; ++row)
           {
           out_mem[row] = p_mem[row] / A_mem[row];
           }
-        }
+        };
+      
+      subview_each_mp::for_each_tile(p_n_rows, p_n_cols, worker);
       }
     
     if(mode == 1) // each row
       {
-      for(uword i=0; i < p_n_cols; ++i)
+      const auto worker = [&](const uword col, const uword row_start, const uword row_end)
         {
-        const eT*   p_mem =   p.colptr(i);
-              eT* out_mem = out.colptr(i);
+        const eT*   p_mem =   p.colptr(col);
+              eT* out_mem = out.colptr(col);
         
-        const eT A_val = A_mem[i];
+        const eT A_val = A_mem[col];
         
-        for(uword row=0; row < p_n_rows; ++row)
+        for(uword row=row_start; row < row_end; ++row)
           {
           out_mem[row] = p_mem[row] / A_val;
           }
-        }
+        };
+      
+      subview_each_mp::for_each_tile(p_n_rows, p_n_cols, worker);
       }
     }
   
@@ -1015,32 +1378,36 @@ subview_each1_aux::operator_div
     {
     if(mode == 0) // each column
       {
-      for(uword i=0; i < p_n_cols; ++i)
+      const auto worker = [&](const uword col, const uword row_start, const uword row_end)
         {
-        const eT*   p_mem =   p.colptr(i);
-              eT* out_mem = out.colptr(i);
+        const eT*   p_mem =   p.colptr(col);
+              eT* out_mem = out.colptr(col);
         
-        for(uword row=0; row < p_n_rows; ++row)
+        for(uword row=row_start; row < row_end; ++row)
           {
           out_mem[row] = A_mem[row] / p_mem[row];
           }
-        }
+        };
+      
+      subview_each_mp::for_each_tile(p_n_rows, p_n_cols, worker);
       }
     
     if(mode == 1) // each row
       {
-      for(uword i=0; i < p_n_cols; ++i)
+      const auto worker = [&](const uword col, const uword row_start, const uword row_end)
         {
-        const eT*   p_mem =   p.colptr(i);
-              eT* out_mem = out.colptr(i);
+        const eT*   p_mem =   p.colptr(col);
+              eT* out_mem = out.colptr(col);
         
-        const eT A_val = A_mem[i];
+        const eT A_val = A_mem[col];
         
-        for(uword row=0; row < p_n_rows; ++row)
+        for(uword row=row_start; row < row_end; ++row)
           {
           out_mem[row] = A_val / p_mem[row];
           }
-        }
+        };
+      
+      subview_each_mp::for_each_tile(p_n_rows, p_n_cols, worker);
       }
     }
   
@@ -1070,9 +1437,6 @@ subview_each2_aux::operator_plus
   
   const parent& p = X.P;
   
-  const uword p_n_rows = p.n_rows;
-  const uword p_n_cols = p.n_cols;
-  
   Mat<eT> out = p;
   
   const quasi_unwrap<T2> tmp(Y.get_ref());
@@ -1083,36 +1447,8 @@ subview_each2_aux::operator_plus
   X.check_size(A);
   X.check_indices(U.M);
   
-  const uword* indices_mem = U.M.memptr();
-  const uword  N           = U.M.n_elem;
-  
-  if(mode == 0)  // process columns
-    {
-    const eT* A_mem = A.memptr();
-    
-    for(uword i=0; i < N; ++i)
-      {
-      const uword col = indices_mem[i];
-      
-      arma_conform_check_bounds( (col >= p_n_cols), "each_col(): index out of bounds" );
-      
-      if(p_n_rows == 0)  { continue; }
-      
-      arrayops::inplace_plus( out.colptr(col), A_mem, p_n_rows );
-      }
-    }
-  
-  if(mode == 1)  // process rows
-    {
-    for(uword i=0; i < N; ++i)
-      {
-      const uword row = indices_mem[i];
-      
-      arma_conform_check_bounds( (row >= p_n_rows), "each_row(): index out of bounds" );
-      
-      out.row(row) += A;
-      }
-    }
+  if(mode == 0)  { out.each_col(U.M) += A; }
+  if(mode == 1)  { out.each_row(U.M) += A; }
   
   return out;
   }
@@ -1134,9 +1470,6 @@ subview_each2_aux::operator_minus
   
   const parent& p = X.P;
   
-  const uword p_n_rows = p.n_rows;
-  const uword p_n_cols = p.n_cols;
-  
   Mat<eT> out = p;
   
   const quasi_unwrap<T2> tmp(Y.get_ref());
@@ -1147,36 +1480,8 @@ subview_each2_aux::operator_minus
   X.check_size(A);
   X.check_indices(U.M);
   
-  const uword* indices_mem = U.M.memptr();
-  const uword  N           = U.M.n_elem;
-  
-  if(mode == 0)  // process columns
-    {
-    const eT* A_mem = A.memptr();
-    
-    for(uword i=0; i < N; ++i)
-      {
-      const uword col = indices_mem[i];
-      
-      arma_conform_check_bounds( (col >= p_n_cols), "each_col(): index out of bounds" );
-      
-      if(p_n_rows == 0)  { continue; }
-      
-      arrayops::inplace_minus( out.colptr(col), A_mem, p_n_rows );
-      }
-    }
-  
-  if(mode == 1)  // process rows
-    {
-    for(uword i=0; i < N; ++i)
-      {
-      const uword row = indices_mem[i];
-      
-      arma_conform_check_bounds( (row >= p_n_rows), "each_row(): index out of bounds" );
-      
-      out.row(row) -= A;
-      }
-    }
+  if(mode == 0)  { out.each_col(U.M) -= A; }
+  if(mode == 1)  { out.each_row(U.M) -= A; }
   
   return out;
   }
@@ -1214,38 +1519,60 @@ subview_each2_aux::operator_minus
   const uword* indices_mem = U.M.memptr();
   const uword  N           = U.M.n_elem;
   
+  const eT* A_mem = A.memptr();
+  
   if(mode == 0)  // process columns
     {
-    const eT* A_mem = A.memptr();
-    
     for(uword i=0; i < N; ++i)
       {
-      const uword col = indices_mem[i];
-      
-      arma_conform_check_bounds( (col >= p_n_cols), "each_col(): index out of bounds" );
-      
-      if(p_n_rows == 0)  { continue; }
-      
-      const eT*   p_mem =   p.colptr(col);
-            eT* out_mem = out.colptr(col);
-      
-      for(uword row=0; row < p_n_rows; ++row)
+      arma_conform_check_bounds( (indices_mem[i] >= p_n_cols), "each_col(): index out of bounds" );
+      }
+    
+    const auto worker = [&](const uword row_start, const uword row_end)
+      {
+      for(uword i=0; i < N; ++i)
         {
-        out_mem[row] = A_mem[row] - p_mem[row];
+        const uword col = indices_mem[i];
+        
+        const eT*   p_mem =   p.colptr(col);
+              eT* out_mem = out.colptr(col);
+        
+        for(uword row=row_start; row < row_end; ++row)
+          {
+          out_mem[row] = A_mem[row] - p_mem[row];
+          }
         }
-      }
+      };
+    
+    subview_each_mp::for_each_block(p_n_rows, p_n_rows * N, worker);
     }
   
   if(mode == 1)  // process rows
     {
     for(uword i=0; i < N; ++i)
       {
-      const uword row = indices_mem[i];
-      
-      arma_conform_check_bounds( (row >= p_n_rows), "each_row(): index out of bounds" );
-      
-      out.row(row) = A - p.row(row);
+      arma_conform_check_bounds( (indices_mem[i] >= p_n_rows), "each_row(): index out of bounds" );
       }
+    
+    const auto worker = [&](const uword col_start, const uword col_end)
+      {
+      for(uword col=col_start; col < col_end; ++col)
+        {
+        const eT*   p_mem =   p.colptr(col);
+              eT* out_mem = out.colptr(col);
+        
+        const eT A_val = A_mem[col];
+        
+        for(uword i=0; i < N; ++i)
+          {
+          const uword row = indices_mem[i];
+          
+          out_mem[row] = A_val - p_mem[row];
+          }
+        }
+      };
+    
+    subview_each_mp::for_each_block(p_n_cols, p_n_cols * N, worker);
     }
   
   return out;
@@ -1268,9 +1595,6 @@ subview_each2_aux::operator_schur
   
   const parent& p = X.P;
   
-  const uword p_n_rows = p.n_rows;
-  const uword p_n_cols = p.n_cols;
-  
   Mat<eT> out = p;
   
   const quasi_unwrap<T2> tmp(Y.get_ref());
@@ -1281,36 +1605,8 @@ subview_each2_aux::operator_schur
   X.check_size(A);
   X.check_indices(U.M);
   
-  const uword* indices_mem = U.M.memptr();
-  const uword  N           = U.M.n_elem;
-  
-  if(mode == 0)  // process columns
-    {
-    const eT* A_mem = A.memptr();
-    
-    for(uword i=0; i < N; ++i)
-      {
-      const uword col = indices_mem[i];
-      
-      arma_conform_check_bounds( (col >= p_n_cols), "each_col(): index out of bounds" );
-      
-      if(p_n_rows == 0)  { continue; }
-      
-      arrayops::inplace_mul( out.colptr(col), A_mem, p_n_rows );
-      }
-    }
-  
-  if(mode == 1)  // process rows
-    {
-    for(uword i=0; i < N; ++i)
-      {
-      const uword row = indices_mem[i];
-      
-      arma_conform_check_bounds( (row >= p_n_rows), "each_row(): index out of bounds" );
-      
-      out.row(row) %= A;
-      }
-    }
+  if(mode == 0)  { out.each_col(U.M) %= A; }
+  if(mode == 1)  { out.each_row(U.M) %= A; }
   
   return out;
   }
@@ -1332,9 +1628,6 @@ subview_each2_aux::operator_div
   
   const parent& p = X.P;
   
-  const uword p_n_rows = p.n_rows;
-  const uword p_n_cols = p.n_cols;
-  
   Mat<eT> out = p;
   
   const quasi_unwrap<T2> tmp(Y.get_ref());
@@ -1345,36 +1638,8 @@ subview_each2_aux::operator_div
   X.check_size(A);
   X.check_indices(U.M);
   
-  const uword* indices_mem = U.M.memptr();
-  const uword  N           = U.M.n_elem;
-  
-  if(mode == 0)  // process columns
-    {
-    const eT* A_mem = A.memptr();
-    
-    for(uword i=0; i < N; ++i)
-      {
-      const uword col = indices_mem[i];
-      
-      arma_conform_check_bounds( (col >= p_n_cols), "each_col(): index out of bounds" );
-      
-      if(p_n_rows == 0)  { continue; }
-      
-      arrayops::inplace_div( out.colptr(col), A_mem, p_n_rows );
-      }
-    }
-  
-  if(mode == 1)  // process rows
-    {
-    for(uword i=0; i < N; ++i)
-      {
-      const uword row = indices_mem[i];
-      
-      arma_conform_check_bounds( (row >= p_n_rows), "each_row(): index out of bounds" );
-      
-      out.row(row) /= A;
-      }
-    }
+  if(mode == 0)  { out.each_col(U.M) /= A; }
+  if(mode == 1)  { out.each_row(U.M) /= A; }
   
   return out;
   }
@@ -1412,38 +1677,60 @@ subview_each2_aux::operator_div
   const uword* indices_mem = U.M.memptr();
   const uword  N           = U.M.n_elem;
   
+  const eT* A_mem = A.memptr();
+  
   if(mode == 0)  // process columns
     {
-    const eT* A_mem = A.memptr();
-    
     for(uword i=0; i < N; ++i)
       {
-      const uword col = indices_mem[i];
-      
-      arma_conform_check_bounds( (col >= p_n_cols), "each_col(): index out of bounds" );
-      
-      if(p_n_rows == 0)  { continue; }
-      
-      const eT*   p_mem =   p.colptr(col);
-            eT* out_mem = out.colptr(col);
-      
-      for(uword row=0; row < p_n_rows; ++row)
+      arma_conform_check_bounds( (indices_mem[i] >= p_n_cols), "each_col(): index out of bounds" );
+      }
+    
+    const auto worker = [&](const uword row_start, const uword row_end)
+      {
+      for(uword i=0; i < N; ++i)
         {
-        out_mem[row] = A_mem[row] / p_mem[row];
+        const uword col = indices_mem[i];
+        
+        const eT*   p_mem =   p.colptr(col);
+              eT* out_mem = out.colptr(col);
+        
+        for(uword row=row_start; row < row_end; ++row)
+          {
+          out_mem[row] = A_mem[row] / p_mem[row];
+          }
         }
-      }
+      };
+    
+    subview_each_mp::for_each_block(p_n_rows, p_n_rows * N, worker);
     }
   
   if(mode == 1)  // process rows
     {
     for(uword i=0; i < N; ++i)
       {
-      const uword row = indices_mem[i];
-      
-      arma_conform_check_bounds( (row >= p_n_rows), "each_row(): index out of bounds" );
-      
-      out.row(row) = A / p.row(row);
+      arma_conform_check_bounds( (indices_mem[i] >= p_n_rows), "each_row(): index out of bounds" );
       }
+    
+    const auto worker = [&](const uword col_start, const uword col_end)
+      {
+      for(uword col=col_start; col < col_end; ++col)
+        {
+        const eT*   p_mem =   p.colptr(col);
+              eT* out_mem = out.colptr(col);
+        
+        const eT A_val = A_mem[col];
+        
+        for(uword i=0; i < N; ++i)
+          {
+          const uword row = indices_mem[i];
+          
+          out_mem[row] = A_val / p_mem[row];
+          }
+        }
+      };
+    
+    subview_each_mp::for_each_block(p_n_cols, p_n_cols * N, worker);
     }
   
   return out;
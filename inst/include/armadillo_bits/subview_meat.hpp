@@ -2465,7 +2465,7 @@ subview<eT>::each_col(const std::function< void(const Col<eT>&) >& F) const
   
   for(uword ii=0; ii < local_n_cols; ++ii)
     {
-    const Col<eT> tmp(colptr(ii), local_n_rows, false, true);
+    const Col<eT> tmp(const_cast<eT*>(colptr(ii)), local_n_rows, false, true);
     F(tmp);
     }
   }
@@ -2573,6 +2573,82 @@ subview<eT>::each_row(const std::function< void(const Row<eT>&) >& F) const
 
 
 
+//! apply a lambda function to each column in parallel (when use_mp is true and OpenMP is enabled);
+//! F must be safe to call concurrently from several threads
+template<typename eT>
+inline
+void
+subview<eT>::each_col(const std::function< void(Col<eT>&) >& F, const bool use_mp)
+  {
+  arma_debug_sigprint();
+  
+  if((use_mp == false) || (arma_config::openmp == false) || (mp_thread_limit::in_parallel()))
+    {
+    (*this).each_col(F);
+    return;
+    }
+  
+  subview_each_mp::each_col_lambda(*this, F);
+  }
+
+
+
+template<typename eT>
+inline
+void
+subview<eT>::each_col(const std::function< void(const Col<eT>&) >& F, const bool use_mp) const
+  {
+  arma_debug_sigprint();
+  
+  if((use_mp == false) || (arma_config::openmp == false) || (mp_thread_limit::in_parallel()))
+    {
+    (*this).each_col(F);
+    return;
+    }
+  
+  subview_each_mp::each_col_lambda(*this, F);
+  }
+
+
+
+//! apply a lambda function to each row in parallel (when use_mp is true and OpenMP is enabled);
+//! rows are processed in blocks, each thread working on its own copies of the rows
+template<typename eT>
+inline
+void
+subview<eT>::each_row(const std::function< void(Row<eT>&) >& F, const bool use_mp)
+  {
+  arma_debug_sigprint();
+  
+  if((use_mp == false) || (arma_config::openmp == false) || (mp_thread_limit::in_parallel()))
+    {
+    (*this).each_row(F);
+    return;
+    }
+  
+  subview_each_mp::each_row_lambda(*this, F, true);
+  }
+
+
+
+template<typename eT>
+inline
+void
+subview<eT>::each_row(const std::function< void(const Row<eT>&) >& F, const bool use_mp) const
+  {
+  arma_debug_sigprint();
+  
+  if((use_mp == false) || (arma_config::openmp == false) || (mp_thread_limit::in_parallel()))
+    {
+    (*this).each_row(F);
+    return;
+    }
+  
+  subview_each_mp::each_row_lambda(*this, F, false);
+  }
+
+
+
 //! creation of diagview (diagonal)
 template<typename eT>
 inline
@@ -0,0 +1,365 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2026 Dirk Eddelbuettel
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// https://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+
+//! \addtogroup vecmath
+//! @{
+
+
+// Vectorised exp() and log() for arrays of float and double elements.
+// 
+// Elements are processed in fixed-size blocks, allowing the compiler to auto-vectorise
+// the branch-free polynomial kernels. Elements outside of the fast domain
+// (eg. NaN, Inf, overflow, underflow, subnormal or non-positive arguments to log)
+// are recomputed afterwards via std::exp() and std::log().
+// The maximum error of the kernels is 2 ulp for exp() and 1 ulp for log().
+// 
+// The kernels use the instruction set the package is compiled for (eg. AVX2 via -march=native);
+// there is no run-time selection of instruction sets. With the default SSE2 target the gain
+// over std::exp() and std::log() is negligible, so the kernels are only enabled via ARMA_OPTIMISE_VECMATH.
+// 
+// float elements are evaluated via the double precision kernels.
+
+
+struct vecmath
+  {
+  static constexpr uword block_size = 256;
+  
+  template<typename eop_type, typename eT>
+  struct supported
+    {
+    static constexpr bool value = (arma_config::optimise_vecmath) && (is_same_type<eT,double>::yes || is_same_type<eT,float>::yes) && (is_same_type<eop_type,eop_exp>::yes || is_same_type<eop_type,eop_log>::yes);
+    };
+  
+  
+  // kernels which always process block_size elements, in-place
+  
+  arma_inline static void exp_block(double* mem);
+  arma_inline static void log_block(double* mem);
+  
+  
+  // user-level functions; out and in may refer to the same memory
+  
+  template<typename eT> inline static void exp(eT* out, const eT* in, const uword N);
+  template<typename eT> inline static void log(eT* out, const eT* in, const uword N);
+  
+  template<typename eop_type, typename eT> inline static void apply(eT* out, const eT* in, const uword N);
+  
+  template<typename eop_type, typename eT, typename ea_type>
+  inline static typename enable_if2<  supported<eop_type,eT>::value, bool>::result try_apply(eT* out, const ea_type& P, const uword N);
+  
+  template<typename eop_type, typename eT, typename ea_type>
+  inline static typename enable_if2< !supported<eop_type,eT>::value, bool>::result try_apply(eT* out, const ea_type& P, const uword N);
+  
+  template<typename eop_type, typename eT, typename ea_type>
+  inline static void apply_proxy(eT* out, const ea_type& P, const uword N);
+  
+  template<typename eop_type, typename eT>
+  inline static void apply_proxy(eT* out, const eT* P, const uword N);
+  
+  
+  private:
+  
+  template<typename eop_type, typename eT> inline static void apply_block(eT* out, const eT* in, const uword len);
+  
+  arma_inline static uint64_t to_bits(const double x)   { uint64_t u; std::memcpy(&u, &x, sizeof(double)); return u; }
+  arma_inline static double from_bits(const uint64_t u) { double   x; std::memcpy(&x, &u, sizeof(double)); return x; }
+  };
+
+
+
+//! exp(x), valid for x in [-708, 709]:
+//! x = n*log(2) + r, with |r| <= log(2)/2;  exp(x) = 2^n * exp(r), with exp(r) evaluated via a degree 13 polynomial
+arma_inline
+void
+vecmath::exp_block(double* mem)
+  {
+  const double log2e   = 1.4426950408889634074;
+  const double ln2_hi  = 6.93147180369123816490e-01;
+  const double ln2_lo  = 1.90821492927058770002e-10;
+  const double shifter = 6755399441055744.0;  // 1.5 * 2^52
+  
+  const uint64_t shifter_bits = 0x4338000000000000ULL;
+  
+  for(uword i=0; i < vecmath::block_size; ++i)
+    {
+    const double xi = mem[i];
+    
+    const double t = xi * log2e + shifter;  // round to nearest integer
+    const double n = t - shifter;
+    
+    const double r = (xi - n*ln2_hi) - n*ln2_lo;
+    
+    double p =         2.08767569878680989792e-09;  // 1/13!
+    p = p * r +        2.50521083854417187751e-08;  // 1/12!
+    p = p * r +        2.75573192239858906526e-07;  // 1/11!
+    p = p * r +        2.75573192239858906526e-06;  // 1/10!
+    p = p * r +        2.48015873015873015873e-05;  // 1/9!
+    p = p * r +        1.98412698412698412698e-04;  // 1/8!
+    p = p * r +        1.38888888888888888889e-03;  // 1/7!
+    p = p * r +        8.33333333333333333333e-03;  // 1/6!
+    p = p * r +        4.16666666666666666667e-02;  // 1/5!
+    p = p * r +        1.66666666666666666667e-01;  // 1/4!
+    p = p * r +        0.5;
+    p = p * r +        1.0;
+    p = p * r +        1.0;
+    
+    // construct 2^n directly in the exponent field
+    const uint64_t scale_bits = (vecmath::to_bits(t) - shifter_bits + uint64_t(1023)) << 52;
+    
+    mem[i] = p * vecmath::from_bits(scale_bits);
+    }
+  }
+
+
+
+//! log(x), valid for positive normal x:
+//! x = 2^k * (1+f), with sqrt(2)/2 <= 1+f < sqrt(2);  log(1+f) evaluated as per fdlibm
+arma_inline
+void
+vecmath::log_block(double* mem)
+  {
+  const double ln2_hi = 6.93147180369123816490e-01;
+  const double ln2_lo = 1.90821492927058770002e-10;
+  
+  const double Lg1 = 6.666666666666735130e-01;
+  const double Lg2 = 3.999999999940941908e-01;
+  const double Lg3 = 2.857142874366239149e-01;
+  const double Lg4 = 2.222219843214978396e-01;
+  const double Lg5 = 1.818357216161805012e-01;
+  const double Lg6 = 1.531383769920937332e-01;
+  const double Lg7 = 1.479819860511658591e-01;
+  
+  const uint64_t sqrt_half_bits = 0x3fe6a09e667f3bcdULL;
+  const uint64_t shifter_bits   = 0x4338000000000000ULL;  // 1.5 * 2^52
+  const double   shifter        = 6755399441055744.0;
+  
+  for(uword i=0; i < vecmath::block_size; ++i)
+    {
+    const uint64_t u = vecmath::to_bits(mem[i]) - sqrt_half_bits;
+    
+    const uint64_t k_bits = ((u >> 52) ^ 0x800ULL) - 0x800ULL;            // signed exponent, relative to sqrt(2)/2
+    const uint64_t m_bits = (u & 0x000fffffffffffffULL) + sqrt_half_bits;  // mantissa, scaled to [sqrt(2)/2, sqrt(2))
+    
+    const double dk = vecmath::from_bits(shifter_bits + k_bits) - shifter;
+    const double f  = vecmath::from_bits(m_bits) - 1.0;
+    
+    const double hfsq = 0.5 * f * f;
+    const double s    = f / (2.0 + f);
+    const double z    = s * s;
+    const double w    = z * z;
+    const double t1   = w * (Lg2 + w * (Lg4 + w * Lg6));
+    const double t2   = z * (Lg1 + w * (Lg3 + w * (Lg5 + w * Lg7)));
+    const double R    = t2 + t1;
+    
+    mem[i] = dk*ln2_hi - ((hfsq - (s*(hfsq + R) + dk*ln2_lo)) - f);
+    }
+  }
+
+
+
+//! process up to block_size elements
+template<typename eop_type, typename eT>
+inline
+void
+vecmath::apply_block(eT* out, const eT* in, const uword len)
+  {
+  arma_aligned double buf[vecmath::block_size];
+  
+  for(uword i=0;   i < len;                 ++i)  { buf[i] = double(in[i]); }
+  for(uword i=len; i < vecmath::block_size; ++i)  { buf[i] = double(1);     }
+  
+  if(is_same_type<eop_type,eop_exp>::yes)
+    {
+    vecmath::exp_block(buf);
+    
+    for(uword i=0; i < len; ++i)
+      {
+      const double xi = double(in[i]);
+      
+      out[i] = ((xi >= -708.0) && (xi <= 709.0)) ? eT(buf[i]) : eT(std::exp(xi));
+      }
+    }
+  else
+    {
+    vecmath::log_block(buf);
+    
+    const double x_min = std::numeric_limits<double>::min();
+    const double x_max = std::numeric_limits<double>::max();
+    
+    for(uword i=0; i < len; ++i)
+      {
+      const double xi = double(in[i]);
+      
+      out[i] = ((xi >= x_min) && (xi <= x_max)) ? eT(buf[i]) : eT(std::log(xi));
+      }
+    }
+  }
+
+
+
+template<typename eop_type, typename eT>
+inline
+void
+vecmath::apply(eT* out, const eT* in, const uword N)
+  {
+  for(uword i=0; i < N; i += vecmath::block_size)
+    {
+    const uword len = (std::min)(uword(vecmath::block_size), N - i);
+    
+    vecmath::apply_block<eop_type>(&(out[i]), &(in[i]), len);
+    }
+  }
+
+
+
+template<typename eT>
+inline
+void
+vecmath::exp(eT* out, const eT* in, const uword N)
+  {
+  vecmath::apply<eop_exp>(out, in, N);
+  }
+
+
+
+template<typename eT>
+inline
+void
+vecmath::log(eT* out, const eT* in, const uword N)
+  {
+  vecmath::apply<eop_log>(out, in, N);
+  }
+
+
+
+template<typename eop_type, typename eT, typename ea_type>
+inline
+typename enable_if2< vecmath::supported<eop_type,eT>::value, bool>::result
+vecmath::try_apply(eT* out, const ea_type& P, const uword N)
+  {
+  vecmath::apply_proxy<eop_type>(out, P, N);
+  
+  return true;
+  }
+
+
+
+template<typename eop_type, typename eT, typename ea_type>
+inline
+typename enable_if2< !vecmath::supported<eop_type,eT>::value, bool>::result
+vecmath::try_apply(eT* out, const ea_type& P, const uword N)
+  {
+  arma_ignore(out);
+  arma_ignore(P);
+  arma_ignore(N);
+  
+  return false;
+  }
+
+
+
+//! evaluate an element-wise expression via its proxy, and then apply the kernel in-place;
+//! each block is evaluated and transformed while in cache
+template<typename eop_type, typename eT, typename ea_type>
+inline
+void
+vecmath::apply_proxy(eT* out, const ea_type& P, const uword N)
+  {
+  arma_debug_sigprint();
+  
+  const uword n_blocks = (N + vecmath::block_size - 1) / vecmath::block_size;
+  
+  const bool use_mp = (arma_config::openmp) && (n_blocks >= 2) && mp_gate<eT>::eval(N);
+  
+  if(use_mp)
+    {
+    #if defined(ARMA_USE_OPENMP)
+      {
+      const int n_threads = mp_thread_limit::get();
+      
+      #pragma omp parallel for schedule(static) num_threads(n_threads)
+      for(uword b=0; b < n_blocks; ++b)
+        {
+        const uword start = b * vecmath::block_size;
+        const uword len   = (std::min)(uword(vecmath::block_size), N - start);
+        
+        eT* out_blk = &(out[start]);
+        
+        for(uword i=0; i < len; ++i)  { out_blk[i] = P[start+i]; }
+        
+        vecmath::apply_block<eop_type>(out_blk, out_blk, len);
+        }
+      }
+    #endif
+    }
+  else
+    {
+    for(uword b=0; b < n_blocks; ++b)
+      {
+      const uword start = b * vecmath::block_size;
+      const uword len   = (std::min)(uword(vecmath::block_size), N - start);
+      
+      eT* out_blk = &(out[start]);
+      
+      for(uword i=0; i < len; ++i)  { out_blk[i] = P[start+i]; }
+      
+      vecmath::apply_block<eop_type>(out_blk, out_blk, len);
+      }
+    }
+  }
+
+
+
+//! as above, for proxies that provide direct access to memory
+template<typename eop_type, typename eT>
+inline
+void
+vecmath::apply_proxy(eT* out, const eT* P, const uword N)
+  {
+  arma_debug_sigprint();
+  
+  const uword n_blocks = (N + vecmath::block_size - 1) / vecmath::block_size;
+  
+  const bool use_mp = (arma_config::openmp) && (n_blocks >= 2) && mp_gate<eT>::eval(N);
+  
+  if(use_mp)
+    {
+    #if defined(ARMA_USE_OPENMP)
+      {
+      const int n_threads = mp_thread_limit::get();
+      
+      #pragma omp parallel for schedule(static) num_threads(n_threads)
+      for(uword b=0; b < n_blocks; ++b)
+        {
+        const uword start = b * vecmath::block_size;
+        const uword len   = (std::min)(uword(vecmath::block_size), N - start);
+        
+        vecmath::apply_block<eop_type>(&(out[start]), &(P[start]), len);
+        }
+      }
+    #endif
+    }
+  else
+    {
+    vecmath::apply<eop_type>(out, P, N);
+    }
+  }
+
+
+
+//! @}
@@ -0,0 +1,55 @@
+// -*- mode: C++; c-indent-level: 4; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+//
+// allocations.cpp: RcppArmadillo unit test code for expression evaluation without temporaries
+//
+// Copyright (C) 2026  Dirk Eddelbuettel
+//
+// This file is part of RcppArmadillo.
+//
+// RcppArmadillo is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// RcppArmadillo is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with RcppArmadillo.  If not, see <http://www.gnu.org/licenses/>.
+
+// count every memory block acquired by Armadillo objects
+#include <cstdlib>
+static long n_acquired = 0;
+inline void* countingAlloc(std::size_t n) { ++n_acquired; return std::malloc(n); }
+#define ARMA_ALIEN_MEM_ALLOC_FUNCTION countingAlloc
+#define ARMA_ALIEN_MEM_FREE_FUNCTION std::free
+
+// [[Rcpp::depends(RcppArmadillo)]]
+#include <RcppArmadillo.h>
+
+using namespace Rcpp;
+
+// [[Rcpp::export]]
+List fusedAllocs_(arma::mat A, arma::mat B, arma::vec a) {
+    const long n0 = n_acquired;
+    const double accu1 = arma::accu(arma::square(A - B));
+    const double accu2 = arma::accu(arma::exp(A.t()) % B.t());
+    const double dot1 = arma::dot(A.t(), B.t());
+    const double dot2 = arma::dot(arma::exp(A), B);
+    const double dot3 = arma::dot(a.t(), B.col(0));
+    const double dot4 = arma::dot(arma::exp(a).t(), B.col(1));
+    const double dot5 = arma::dot(B.row(0), arma::exp(A.row(1)).t());
+    const long n_scalar = n_acquired - n0;
+    const long n1 = n_acquired;
+    const arma::rowvec sum0 = arma::sum(arma::exp(A - B), 0);
+    const arma::vec sum1 = arma::sum(A % B, 1);
+    const arma::rowvec mean0 = arma::mean(A.t() + B.t(), 0);
+    const long n_dim = n_acquired - n1;
+    return List::create(Named("accu1") = accu1, Named("accu2") = accu2,
+                        Named("dot1") = dot1, Named("dot2") = dot2, Named("dot3") = dot3,
+                        Named("dot4") = dot4, Named("dot5") = dot5,
+                        Named("sum0") = sum0, Named("sum1") = sum1, Named("mean0") = mean0,
+                        Named("n_scalar") = n_scalar, Named("n_dim") = n_dim);
+}
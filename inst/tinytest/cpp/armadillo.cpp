@@ -168,6 +168,107 @@ NumericMatrix mtGlue_() {
     return wrap( m1 + m2 );
 }
 
+// [[Rcpp::export]]
+List summarise_(arma::mat X, int dim) {
+    return wrap( arma::summarise(X, 0, dim) );
+}
+
+// [[Rcpp::export]]
+double summariseFloatCount_(double n) {
+    const arma::fmat X(1, arma::uword(n), arma::fill::ones);
+    return double( arma::summarise(X, 0, 1).count(0) );
+}
+
+// [[Rcpp::export]]
+List covariance_(arma::mat X, arma::vec w, arma::mat Y) {
+    return List::create(Named("wcov0") = arma::wcov(X, w),
+                        Named("wcov1") = arma::wcov(X, w, 1),
+                        Named("wcor") = arma::wcor(X, w),
+                        Named("cov_pw") = arma::cov_pairwise(Y),
+                        Named("cor_pw") = arma::cor_pairwise(Y),
+                        Named("packed0") = arma::cov_packed(X),
+                        Named("packed1") = arma::cov_packed(X, 1));
+}
+
+// [[Rcpp::export]]
+List fusedReductions_(arma::mat A, arma::mat B) {
+    return List::create(Named("accu") = arma::accu(arma::square(A - B)),
+                        Named("sum1") = arma::sum(arma::exp(A - B), 1),
+                        Named("mean0") = arma::mean(A.t() + B.t(), 0),
+                        Named("dot") = arma::dot(arma::exp(A), B));
+}
+
+#define EACH_COL_ROW_OPS(name, op, op_eq)                                      \
+    res["col_" name] = X.each_col() op v;                                      \
+    res["col_rev_" name] = v op X.each_col();                                  \
+    res["col_idx_" name] = X.each_col(ci) op v;                                \
+    res["col_idx_rev_" name] = v op X.each_col(ci);                            \
+    res["row_" name] = X.each_row() op r;                                      \
+    res["row_rev_" name] = r op X.each_row();                                  \
+    res["row_idx_" name] = X.each_row(ri) op r;                                \
+    res["row_idx_rev_" name] = r op X.each_row(ri);                            \
+    { arma::mat A = X; A.each_col() op_eq v; res["col_eq_" name] = A; }        \
+    { arma::mat A = X; A.each_col(ci) op_eq v; res["col_idx_eq_" name] = A; }  \
+    { arma::mat A = X; A.each_row() op_eq r; res["row_eq_" name] = A; }        \
+    { arma::mat A = X; A.each_row(ri) op_eq r; res["row_idx_eq_" name] = A; }  \
+    { arma::mat A = X; A.cols(1, A.n_cols - 2).each_col() op_eq v; res["sub_col_eq_" name] = A; } \
+    { arma::mat A = X; A.rows(1, A.n_rows - 2).each_row() op_eq r; res["sub_row_eq_" name] = A; }
+
+// [[Rcpp::export]]
+std::map<std::string, arma::mat> eachColRow_(arma::mat X, arma::vec v, arma::rowvec r, arma::uvec ci, arma::uvec ri) {
+    std::map<std::string, arma::mat> res;
+    EACH_COL_ROW_OPS("plus", +, +=)
+    EACH_COL_ROW_OPS("minus", -, -=)
+    EACH_COL_ROW_OPS("schur", %, %=)
+    EACH_COL_ROW_OPS("div", /, /=)
+    { arma::mat A = X; A.each_col() = v; res["col_assign"] = A; }
+    { arma::mat A = X; A.each_row() = r; res["row_assign"] = A; }
+    { arma::mat A = X; A.each_col([](arma::vec& c) { c = arma::cumsum(c); }, true); res["col_lambda"] = A; }
+    { arma::mat A = X; A.each_row([](arma::rowvec& c) { c = arma::cumsum(c); }, true); res["row_lambda"] = A; }
+    { arma::mat A = X; A.cols(1, A.n_cols - 2).each_col([](arma::vec& c) { c = arma::cumsum(c); }, true); res["sub_col_lambda"] = A; }
+    { arma::mat A = X; A.rows(1, A.n_rows - 2).each_row([](arma::rowvec& c) { c = arma::cumsum(c); }, true); res["sub_row_lambda"] = A; }
+    return res;
+}
+
+// [[Rcpp::export]]
+void eachColThrow_(arma::mat X, bool by_row) {
+    if (by_row) X.each_row([](arma::rowvec& c) { if (c.min() < 0) throw std::runtime_error("negative"); }, true);
+    else X.each_col([](arma::vec& c) { if (c.min() < 0) throw std::runtime_error("negative"); }, true);
+}
+
+// [[Rcpp::export]]
+List convolution_(arma::vec x, arma::vec h, arma::mat W, arma::mat G) {
+    return List::create(Named("full") = arma::conv(x, h),
+                        Named("same") = arma::conv(x, h, "same"),
+                        Named("full2") = arma::conv2(W, G),
+                        Named("same2") = arma::conv2(W, G, "same"));
+}
+
+// [[Rcpp::export]]
+arma::mat kmeans_(arma::mat X, arma::mat means) {
+    arma::kmeans(means, X, means.n_cols, arma::keep_existing, 100, false);
+    return means;
+}
+
+// [[Rcpp::export]]
+List gmmOnline_(arma::mat X, arma::mat means, int chunk) {
+    arma::uword pos = 0;
+    auto source = [&](arma::mat& Y) {
+        if (pos >= X.n_cols) return false;
+        const arma::uword end = std::min(pos + arma::uword(chunk), arma::uword(X.n_cols));
+        Y = X.cols(pos, end - 1);
+        pos = end;
+        return true;
+    };
+    arma::gmm_diag online(means.n_rows, means.n_cols), batch(means.n_rows, means.n_cols);
+    online.set_means(means);
+    batch.set_means(means);
+    online.learn_online(source, means.n_cols, arma::eucl_dist, arma::keep_existing, 10, 40, 1e-10, false);
+    batch.learn(X, means.n_cols, arma::eucl_dist, arma::keep_existing, 20, 20, 1e-10, false);
+    return List::create(Named("online") = online.avg_log_p(X),
+                        Named("batch") = batch.avg_log_p(X));
+}
+
 // [[Rcpp::export]]
 NumericMatrix sugar_(NumericVector xx) {
     arma::mat m = xx + xx;
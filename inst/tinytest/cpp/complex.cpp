@@ -58,3 +58,13 @@ List complexCppTests(const arma::mat& A,
                         _["CmC"]  = CmC
                         );
 }
+
+// [[Rcpp::export]]
+List complexFft(const arma::mat& X, const arma::cx_mat& Z, int n) {
+    return List::create(_["fftX"]  = arma::cx_mat(arma::fft(X)),
+                        _["fftXn"] = arma::cx_mat(arma::fft(X, n)),
+                        _["fftZ"]  = arma::cx_mat(arma::fft(Z)),
+                        _["ifftZ"] = arma::cx_mat(arma::ifft(Z)),
+                        _["fftx"]  = arma::cx_vec(arma::fft(arma::vec(X.col(0))))
+                        );
+}
@@ -0,0 +1,33 @@
+// -*- mode: C++; c-indent-level: 4; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+//
+// conv.cpp: RcppArmadillo unit test code for FFT-based convolution
+//
+// Copyright (C) 2026  Dirk Eddelbuettel
+//
+// This file is part of RcppArmadillo.
+//
+// RcppArmadillo is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// RcppArmadillo is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with RcppArmadillo.  If not, see <http://www.gnu.org/licenses/>.
+
+#define ARMA_OPTIMISE_CONV
+
+// [[Rcpp::depends(RcppArmadillo)]]
+#include <RcppArmadillo.h>
+
+// [[Rcpp::export]]
+Rcpp::List convolutionFft_(arma::vec x, arma::vec h, arma::mat W, arma::mat G) {
+    return Rcpp::List::create(Rcpp::Named("full") = arma::conv(x, h),
+                              Rcpp::Named("same") = arma::conv(x, h, "same"),
+                              Rcpp::Named("full2") = arma::conv2(W, G),
+                              Rcpp::Named("same2") = arma::conv2(W, G, "same"));
+}
@@ -88,3 +88,31 @@ arma::cx_fcube as_cx_fcube(Rcpp::ComplexVector x) {
     arma::cx_fcube y = Rcpp::as<arma::cx_fcube>(x);
     return arma::pow(y, 2);
 }
+
+#define EACH_SLICE_OPS(name, op, op_eq)                                        \
+    res["slice_" name] = Q.each_slice() op M;                                  \
+    res["slice_rev_" name] = M op Q.each_slice();                              \
+    res["slice_idx_" name] = Q.each_slice(si) op M;                            \
+    res["slice_idx_rev_" name] = M op Q.each_slice(si);                        \
+    { arma::cube A = Q; A.each_slice() op_eq M; res["slice_eq_" name] = A; }   \
+    { arma::cube A = Q; A.each_slice(si) op_eq M; res["slice_idx_eq_" name] = A; }
+
+// [[Rcpp::export]]
+std::map<std::string, arma::cube> eachSlice_(arma::cube Q, arma::mat M, arma::mat T, arma::uvec si) {
+    std::map<std::string, arma::cube> res;
+    EACH_SLICE_OPS("plus", +, +=)
+    EACH_SLICE_OPS("minus", -, -=)
+    EACH_SLICE_OPS("schur", %, %=)
+    EACH_SLICE_OPS("div", /, /=)
+    { arma::cube A = Q; A.each_slice() = M; res["slice_assign"] = A; }
+    res["slice_times"] = Q.each_slice() * T;
+    res["slice_rev_times"] = M.t() * Q.each_slice();
+    { arma::cube A = Q; A.each_slice() *= T; res["slice_eq_times"] = A; }
+    { arma::cube A = Q; A.each_slice([](arma::mat& S) { S = arma::cumsum(S); }, true); res["slice_lambda"] = A; }
+    return res;
+}
+
+// [[Rcpp::export]]
+arma::icube eachSliceInt_(arma::icube Q, arma::imat M) {
+    return Q.each_slice() % M;
+}
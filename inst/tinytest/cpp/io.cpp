@@ -0,0 +1,88 @@
+// -*- mode: C++; c-indent-level: 4; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+//
+// io.cpp: RcppArmadillo unit test code for loading and saving
+//
+// Copyright (C) 2026  Dirk Eddelbuettel
+//
+// This file is part of RcppArmadillo.
+//
+// RcppArmadillo is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// RcppArmadillo is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with RcppArmadillo.  If not, see <http://www.gnu.org/licenses/>.
+
+// [[Rcpp::depends(RcppArmadillo)]]
+#include <RcppArmadillo.h>
+
+// [[Rcpp::export]]
+arma::mat loadCSV(std::string name, bool header, bool strict) {
+    arma::mat X;
+    arma::field<std::string> hdr;
+    bool ok = false;
+    if (header) {
+        ok = strict ? X.load(arma::csv_name(name, hdr, arma::csv_opts::strict)) : X.load(arma::csv_name(name, hdr));
+    } else {
+        ok = strict ? X.load(arma::csv_name(name, arma::csv_opts::strict)) : X.load(arma::csv_name(name));
+    }
+    if (!ok) Rcpp::stop("loading failed");
+    return X;
+}
+
+// [[Rcpp::export]]
+arma::mat loadRawAscii(std::string name) {
+    arma::mat X;
+    if (!X.load(name, arma::raw_ascii)) Rcpp::stop("loading failed");
+    return X;
+}
+
+// [[Rcpp::export]]
+Rcpp::List mmapBinary(arma::mat X, arma::sp_mat S, std::string name) {
+    X.save(name + ".mat");
+    S.save(name + ".spmat");
+    arma::mmap_obj<arma::mat> MX(name + ".mat");
+    arma::mmap_obj<arma::sp_mat> MS(name + ".spmat");
+    return Rcpp::List::create(Rcpp::Named("X") = MX.get(),
+                              Rcpp::Named("S") = MS.get(),
+                              Rcpp::Named("mapped") = MX.is_mapped());
+}
+
+// [[Rcpp::export]]
+Rcpp::List zbinaryRoundtrip(arma::mat X, arma::sp_mat S, std::string name) {
+    arma::field<arma::mat> F(2);
+    F(0) = X;
+    F(1) = arma::round(X);
+    X.save(name + ".mat", arma::arma_zbinary);
+    S.save(name + ".spmat", arma::arma_zbinary);
+    F.save(name + ".field", arma::arma_zbinary);
+    arma::mat X2;
+    arma::sp_mat S2;
+    arma::field<arma::mat> F2;
+    X2.load(name + ".mat");
+    S2.load(name + ".spmat", arma::arma_zbinary);
+    F2.load(name + ".field");
+    return Rcpp::List::create(Rcpp::Named("X") = X2,
+                              Rcpp::Named("S") = S2,
+                              Rcpp::Named("F") = F2);
+}
+
+// [[Rcpp::export]]
+Rcpp::List serializeRoundtrip(arma::mat X, arma::sp_mat S) {
+    Rcpp::RawVector rx = Rcpp::arma_serialize(X);
+    Rcpp::RawVector rs = Rcpp::arma_serialize(S);
+    return Rcpp::List::create(Rcpp::Named("raw") = rx,
+                              Rcpp::Named("X") = Rcpp::arma_unserialize<arma::mat>(rx),
+                              Rcpp::Named("S") = Rcpp::arma_unserialize<arma::sp_mat>(rs));
+}
+
+// [[Rcpp::export]]
+arma::mat unserializeMat(Rcpp::RawVector x) {
+    return Rcpp::arma_unserialize<arma::mat>(x);
+}
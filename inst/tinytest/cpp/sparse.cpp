@@ -86,3 +86,198 @@ Rcpp::List sparseList(Rcpp::List l) {
 arma::sp_mat speye(int nrow, int ncol) {
     return arma::speye(nrow, ncol);
 }
+
+// [[Rcpp::export]]
+arma::vec sparseIterativeSolve(arma::sp_mat A, arma::vec b, std::string solver, int precond) {
+    arma::iterative_opts opts;
+    opts.precond = static_cast<arma::iterative_opts::precond_type>(precond);
+    return arma::spsolve(A, b, solver.c_str(), opts);
+}
+
+// [[Rcpp::export]]
+Rcpp::List sparseCholSolve(arma::sp_mat A, arma::vec b, bool amd) {
+    arma::sp_chol_opts opts;
+    opts.ordering = amd ? arma::sp_chol_opts::AMD : arma::sp_chol_opts::NATURAL;
+    arma::spsolve_factoriser F;
+    arma::vec x;
+    double val = 0.0, sign = 0.0;
+    if (F.factorise(A, opts) && F.solve(x, b)) F.log_det(val, sign);
+    return Rcpp::List::create(Rcpp::Named("x") = x, Rcpp::Named("logdet") = val * sign);
+}
+
+// [[Rcpp::export]]
+arma::sp_mat sparseTriplets(arma::uvec i, arma::uvec j, arma::vec x, int nrow, int ncol) {
+    return arma::sp_mat(true, i, j, x, nrow, ncol);
+}
+
+// [[Rcpp::export]]
+Rcpp::List sparseRowMajor(arma::SpMatR<double> A, arma::vec v) {
+    return Rcpp::List::create(Rcpp::Named("A") = A,
+                              Rcpp::Named("Av") = A * v,
+                              Rcpp::Named("rs") = arma::sum(A, 1));
+}
+
+// [[Rcpp::export]]
+Rcpp::List sparsePlanProduct(arma::sp_mat A, arma::vec x, arma::vec y, std::string layout) {
+    arma::spmv_plan<double> P(A, layout.c_str());
+    arma::vec Ax, Aty;
+    P.apply(Ax, x);
+    P.apply_trans(Aty, y);
+    return Rcpp::List::create(Rcpp::Named("Ax") = Ax, Rcpp::Named("Aty") = Aty);
+}
+
+// [[Rcpp::export]]
+Rcpp::List sparseEigsBlock(arma::sp_mat A, int k) {
+    arma::eigs_opts opts;
+    arma::eigs_stats stats;
+    opts.method = arma::eigs_opts::LOBPCG;
+    opts.stats = &stats;
+    arma::vec values = arma::eigs_sym(A, k, "la", opts);
+    return Rcpp::List::create(Rcpp::Named("values") = values,
+                              Rcpp::Named("converged") = stats.converged);
+}
+
+// [[Rcpp::export]]
+Rcpp::List sparseProducts(arma::sp_mat A, arma::sp_mat B, arma::sp_mat M, arma::sp_mat Bt) {
+    const arma::sp_cx_mat cA(A, Bt), cB(B, 2.0 * B), cM(M, M.t());
+    return Rcpp::List::create(Rcpp::Named("AB") = arma::sp_mat(A * B),
+                              Rcpp::Named("masked") = arma::sp_mat((A * B) % M),
+                              Rcpp::Named("masked_rev") = arma::sp_mat(M % (A * B)),
+                              Rcpp::Named("masked_t") = arma::sp_mat((A * Bt.t()) % M),
+                              Rcpp::Named("masked_st") = arma::sp_mat((Bt * A.st()) % M.t()),
+                              Rcpp::Named("cx_AB") = arma::cx_mat(cA * cB),
+                              Rcpp::Named("cx_masked") = arma::cx_mat((cA * cB) % cM),
+                              Rcpp::Named("cx_masked_rev") = arma::cx_mat(cM % (cA * cB)),
+                              Rcpp::Named("cx_masked_t") = arma::cx_mat((cB.t() * cA.t()) % cM.t()));
+}
+
+// [[Rcpp::export]]
+arma::sp_mat sparseMaskedProduct(arma::sp_mat A, arma::sp_mat B, arma::sp_mat M, bool mask_first) {
+    if (mask_first) return M % (A * B);
+    return (A * B) % M;
+}
+
+// [[Rcpp::export]]
+Rcpp::List sparseDenseProducts(arma::sp_mat A, arma::mat B, arma::mat C) {
+    const arma::sp_cx_mat cA(A, 2.0 * A);
+    const arma::cx_mat cB(B, -B), cC(C, 0.5 * C);
+    return Rcpp::List::create(Rcpp::Named("AB") = arma::mat(A * B),
+                              Rcpp::Named("AtC") = arma::mat(A.t() * C),
+                              Rcpp::Named("AstC") = arma::mat(A.st() * C),
+                              Rcpp::Named("cx_AB") = arma::cx_mat(cA * cB),
+                              Rcpp::Named("cx_AtC") = arma::cx_mat(cA.t() * cC),
+                              Rcpp::Named("cx_AstC") = arma::cx_mat(cA.st() * cC));
+}
+// [[Rcpp::export]]
+Rcpp::List sparseBuilder(arma::uvec i, arma::uvec j, arma::vec x, int nrow, int ncol) {
+    const arma::uword N = x.n_elem;
+    arma::sp_mat S1, S2, S3, S4, S5;
+    // serial appends to the buffer of the calling thread
+    arma::SpMat_builder<double> B1(nrow, ncol);
+    for (arma::uword k = 0; k < N; ++k) B1.append(i[k], j[k], x[k]);
+    const double n_before = B1.n_triplets();
+    B1.finalise(S1);
+    const double n_after = B1.n_triplets();
+    // more threads than buffers: the extra threads use the shared overflow buffer
+    arma::SpMat_builder<double> B2(nrow, ncol, 2);
+    #pragma omp parallel for num_threads(4)
+    for (arma::uword k = 0; k < N; ++k) B2.append(i[k], j[k], x[k]);
+    const double n_buffers = B2.n_buffers();
+    B2.finalise(S2);
+    // explicit buffer indices, including ones beyond n_buffers()
+    arma::SpMat_builder<double> B3(nrow, ncol, 3);
+    for (arma::uword k = 0; k < N; ++k) B3.append(k % 5, i[k], j[k], x[k]);
+    B3.finalise(S3);
+    // vectors of triplets appended from nested parallel regions
+    arma::SpMat_builder<double> B4(nrow, ncol);
+    B4.reserve(N / 4);
+    #pragma omp parallel for num_threads(2)
+    for (int h = 0; h < 2; ++h) {
+        #pragma omp parallel for num_threads(2)
+        for (int q = 0; q < 2; ++q) {
+            const arma::uvec idx = arma::regspace<arma::uvec>(2*h + q, 4, N - 1);
+            B4.append(i(idx), j(idx), x(idx));
+        }
+    }
+    B4.finalise(S4);
+    // reset() discards all triplets
+    arma::SpMat_builder<double> B5(nrow, ncol);
+    B5.append(i, j, x);
+    B5.reset();
+    B5.finalise(S5);
+    return Rcpp::List::create(Rcpp::Named("serial") = S1, Rcpp::Named("overflow") = S2,
+                              Rcpp::Named("explicit") = S3, Rcpp::Named("nested") = S4,
+                              Rcpp::Named("reset") = S5, Rcpp::Named("n_before") = n_before,
+                              Rcpp::Named("n_after") = n_after, Rcpp::Named("n_buffers") = n_buffers);
+}
+
+// [[Rcpp::export]]
+arma::sp_mat sparseBuilderBounds(arma::uvec i, arma::uvec j, arma::vec x, int nrow, int ncol) {
+    arma::SpMat_builder<double> B(nrow, ncol);
+    #pragma omp parallel for num_threads(4)
+    for (arma::uword k = 0; k < x.n_elem; ++k) B.append(i[k], j[k], x[k]);
+    arma::sp_mat S;
+    B.finalise(S);
+    return S;
+}
+// sparse element-wise operations and reductions, evaluated either via the OpenMP
+// code paths or via the serial code paths, which are taken inside a parallel region
+// [[Rcpp::export]]
+Rcpp::List sparseReductions(arma::sp_mat A, arma::sp_mat B, arma::vec x, bool serial) {
+    arma::sp_mat plus, minus, schur;
+    arma::mat colsum, rowsum, colsumsq, rowsumsq, colmean, rowmean, colvar, rowvar;
+    arma::vec Ax;
+    double norm1 = 0.0, norminf = 0.0;
+    const auto eval = [&]() {
+        plus = A + B;
+        minus = A - B;
+        schur = A % B;
+        colsum = arma::sum(A, 0);
+        rowsum = arma::sum(A, 1);
+        colsumsq = arma::sum(arma::square(A), 0);
+        rowsumsq = arma::sum(arma::square(A), 1);
+        colmean = arma::mean(A, 0);
+        rowmean = arma::mean(A, 1);
+        colvar = arma::var(A, 0, 0);
+        rowvar = arma::var(A, 1, 1);
+        norm1 = arma::norm(A, 1);
+        norminf = arma::norm(A, "inf");
+        Ax = A * x;
+    };
+    if (serial) {
+        #pragma omp parallel num_threads(2)
+        {
+            #pragma omp master
+            eval();
+        }
+    } else {
+        eval();
+    }
+    return Rcpp::List::create(Rcpp::Named("plus") = plus, Rcpp::Named("minus") = minus,
+                              Rcpp::Named("schur") = schur, Rcpp::Named("colsum") = colsum,
+                              Rcpp::Named("rowsum") = rowsum, Rcpp::Named("colsumsq") = colsumsq,
+                              Rcpp::Named("rowsumsq") = rowsumsq, Rcpp::Named("colmean") = colmean,
+                              Rcpp::Named("rowmean") = rowmean, Rcpp::Named("colvar") = colvar,
+                              Rcpp::Named("rowvar") = rowvar, Rcpp::Named("norm1") = norm1,
+                              Rcpp::Named("norminf") = norminf, Rcpp::Named("Ax") = Ax);
+}
+
+// [[Rcpp::export]]
+Rcpp::List sparseBuilderDuplicates(arma::uvec i, arma::uvec j, arma::vec x, int nrow, int ncol) {
+    arma::SpMat_builder<double> B(nrow, ncol);
+    B.append(i, j, x);
+    arma::sp_mat S;
+    std::string msg;
+    try {
+        B.finalise(S, false);
+    } catch (std::exception& e) {
+        msg = e.what();
+    }
+    // S must still be a valid matrix, and the builder can be reused
+    const arma::sp_mat S2 = S + 2.0 * S;
+    B.append(i, j, x);
+    arma::sp_mat T;
+    B.finalise(T);
+    return Rcpp::List::create(Rcpp::Named("error") = msg, Rcpp::Named("S") = S2,
+                              Rcpp::Named("n_nonzero") = double(S.n_nonzero), Rcpp::Named("T") = T);
+}
@@ -0,0 +1,118 @@
+// -*- mode: C++; c-indent-level: 4; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+//
+// spcache.cpp: RcppArmadillo unit test code for the hash-based element cache of sparse matrices
+//
+// Copyright (C) 2026  Dirk Eddelbuettel
+//
+// This file is part of RcppArmadillo.
+//
+// RcppArmadillo is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// RcppArmadillo is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with RcppArmadillo.  If not, see <http://www.gnu.org/licenses/>.
+
+#define ARMA_OPTIMISE_SPCACHE
+
+// [[Rcpp::depends(RcppArmadillo)]]
+#include <RcppArmadillo.h>
+#include <map>
+#include <random>
+
+// random insertions, updates and removals applied to MapMat_hash and to std::map,
+// comparing lookups after every step and both ordered traversals periodically;
+// returns the number of mismatches
+// [[Rcpp::export]]
+int spcacheRandomOps(int n_keys, int n_ops, int check_every, int seed) {
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<arma::uword> key_dist(0, n_keys - 1);
+    std::uniform_int_distribution<int> op_dist(0, 5);
+    arma::MapMat_hash<double> H;
+    std::map<arma::uword, double> M;
+    int n_bad = 0;
+    arma::uword next_key = 0;
+    const auto same = [&](const arma::MapMat_hash<double>& X) {
+        if (X.size() != M.size() || X.empty() != M.empty()) return false;
+        arma::MapMat_hash<double>::const_iterator it = X.begin();
+        for (const auto& entry : M) {
+            if (it == X.end() || (*it).first != entry.first || (*it).second != entry.second) return false;
+            ++it;
+        }
+        return (it == X.end());
+    };
+    for (int k = 0; k < n_ops; ++k) {
+        const arma::uword key = key_dist(gen);
+        const double val = double(k + 1);
+        switch (op_dist(gen)) {
+        case 0:                         // append past the largest key
+            next_key += 1 + key % 7;
+            H[next_key] = val; M[next_key] = val;
+            break;
+        case 1:
+            H[key] = val; M[key] = val;
+            break;
+        case 2:                         // accumulate, as MapMat does for +=
+            H[key] += val; M[key] += val;
+            break;
+        case 3:                         // an existing element is not modified
+            H.emplace_hint(H.cend(), key, val); M.emplace_hint(M.cend(), key, val);
+            break;
+        case 4:
+            H.erase(key); M.erase(key);
+            break;
+        case 5:
+            H.erase(H.find(key)); M.erase(key);
+            break;
+        }
+        const arma::MapMat_hash<double>& cH = H;
+        const arma::MapMat_hash<double>::const_iterator it = cH.find(key);
+        const auto jt = M.find(key);
+        if ((it == cH.end()) != (jt == M.end())) ++n_bad;
+        else if (it != cH.end() && (*it).second != jt->second) ++n_bad;
+        if ((k + 1) % check_every == 0) {
+            if (!same(cH)) ++n_bad;     // leaves the storage unchanged
+            if ((k + 1) % (2 * check_every) == 0) {
+                arma::MapMat_hash<double>::iterator first = H.begin();  // merges the hash table
+                if (first != nullptr && first->first != M.begin()->first) ++n_bad;
+                if (!same(cH)) ++n_bad;
+            }
+        }
+    }
+    H.clear();
+    if (!H.empty() || H.begin() != nullptr) ++n_bad;
+    return n_bad;
+}
+
+// element-wise writes to a sparse matrix, interleaved with reads from several
+// threads while one of them converts the cache to CSC format
+// [[Rcpp::export]]
+Rcpp::List spcacheSparseOps(arma::uvec rows, arma::uvec cols, arma::vec vals, int n, int sync_every) {
+    arma::sp_mat A(n, n);
+    arma::mat D(n, n, arma::fill::zeros);
+    int n_bad = 0;
+    for (arma::uword k = 0; k < vals.n_elem; ++k) {
+        const arma::uword i = rows[k], j = cols[k];
+        switch (k % 4) {
+        case 0: A(i, j)  = vals[k]; D(i, j)  = vals[k]; break;
+        case 1: A(i, j) += vals[k]; D(i, j) += vals[k]; break;
+        case 2: A(i, j) *= vals[k]; D(i, j) *= vals[k]; break;
+        case 3: A(i, j)  = 0.0;     D(i, j)  = 0.0;     break;
+        }
+        if ((k + 1) % sync_every == 0) {
+            const arma::sp_mat& C = A;
+            #pragma omp parallel for num_threads(4) reduction(+:n_bad)
+            for (arma::uword q = 0; q <= k; ++q) {
+                if (q == k / 2) { if (C.n_nonzero != arma::uword(arma::accu(D != 0.0))) ++n_bad; }
+                if (C(rows[q], cols[q]) != D(rows[q], cols[q])) ++n_bad;
+            }
+        }
+    }
+    return Rcpp::List::create(Rcpp::Named("A") = A, Rcpp::Named("D") = D, Rcpp::Named("n_bad") = n_bad);
+}
@@ -0,0 +1,57 @@
+// -*- mode: C++; c-indent-level: 4; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+//
+// vecmath.cpp: RcppArmadillo unit test code for the exp() and log() kernels
+//
+// Copyright (C) 2026  Dirk Eddelbuettel
+//
+// This file is part of RcppArmadillo.
+//
+// RcppArmadillo is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// RcppArmadillo is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with RcppArmadillo.  If not, see <http://www.gnu.org/licenses/>.
+
+#define ARMA_OPTIMISE_VECMATH
+
+// [[Rcpp::depends(RcppArmadillo)]]
+#include <RcppArmadillo.h>
+#include <cstring>
+
+using namespace Rcpp;
+
+// distance in units in the last place; zero if both are NaN or equal, Inf if only one is NaN or the signs differ
+template<typename eT, typename uT>
+double ulpDist(eT a, eT b) {
+    if (std::isnan(a) && std::isnan(b)) return 0.0;
+    if (std::isnan(a) || std::isnan(b) || std::signbit(a) != std::signbit(b)) return R_PosInf;
+    if (a == b) return 0.0;
+    uT ua, ub;
+    std::memcpy(&ua, &a, sizeof(eT));
+    std::memcpy(&ub, &b, sizeof(eT));
+    return double((ua > ub) ? (ua - ub) : (ub - ua));
+}
+
+// [[Rcpp::export]]
+List vecmathUlp_(arma::vec x) {
+    const arma::vec e = arma::exp(x), l = arma::log(x);
+    const arma::fvec xf = arma::conv_to<arma::fvec>::from(x);
+    const arma::fvec ef = arma::exp(xf), lf = arma::log(xf);
+    arma::vec e_ulp(x.n_elem), l_ulp(x.n_elem), ef_ulp(x.n_elem), lf_ulp(x.n_elem);
+    for (arma::uword i = 0; i < x.n_elem; ++i) {
+        e_ulp[i]  = ulpDist<double, uint64_t>(e[i], std::exp(x[i]));
+        l_ulp[i]  = ulpDist<double, uint64_t>(l[i], std::log(x[i]));
+        ef_ulp[i] = ulpDist<float, uint32_t>(ef[i], std::exp(xf[i]));
+        lf_ulp[i] = ulpDist<float, uint32_t>(lf[i], std::log(xf[i]));
+    }
+    return List::create(Named("exp") = e, Named("log") = l,
+                        Named("exp_ulp") = e_ulp, Named("log_ulp") = l_ulp,
+                        Named("fexp_ulp") = ef_ulp, Named("flog_ulp") = lf_ulp);
+}
@@ -71,6 +71,66 @@ BEGIN_RCPP
     return R_NilValue;
 END_RCPP
 }
+// armadillo_block_reader
+SEXP armadillo_block_reader(std::string file, std::string type, int block_size, int dim);
+RcppExport SEXP _RcppArmadillo_armadillo_block_reader(SEXP fileSEXP, SEXP typeSEXP, SEXP block_sizeSEXP, SEXP dimSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< std::string >::type file(fileSEXP);
+    Rcpp::traits::input_parameter< std::string >::type type(typeSEXP);
+    Rcpp::traits::input_parameter< int >::type block_size(block_sizeSEXP);
+    Rcpp::traits::input_parameter< int >::type dim(dimSEXP);
+    rcpp_result_gen = Rcpp::wrap(armadillo_block_reader(file, type, block_size, dim));
+    return rcpp_result_gen;
+END_RCPP
+}
+// armadillo_read_block
+SEXP armadillo_read_block(SEXP reader);
+RcppExport SEXP _RcppArmadillo_armadillo_read_block(SEXP readerSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< SEXP >::type reader(readerSEXP);
+    rcpp_result_gen = Rcpp::wrap(armadillo_read_block(reader));
+    return rcpp_result_gen;
+END_RCPP
+}
+// armadillo_block_writer
+SEXP armadillo_block_writer(std::string file, std::string type);
+RcppExport SEXP _RcppArmadillo_armadillo_block_writer(SEXP fileSEXP, SEXP typeSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< std::string >::type file(fileSEXP);
+    Rcpp::traits::input_parameter< std::string >::type type(typeSEXP);
+    rcpp_result_gen = Rcpp::wrap(armadillo_block_writer(file, type));
+    return rcpp_result_gen;
+END_RCPP
+}
+// armadillo_write_block
+bool armadillo_write_block(SEXP writer, const arma::mat& x);
+RcppExport SEXP _RcppArmadillo_armadillo_write_block(SEXP writerSEXP, SEXP xSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< SEXP >::type writer(writerSEXP);
+    Rcpp::traits::input_parameter< const arma::mat& >::type x(xSEXP);
+    rcpp_result_gen = Rcpp::wrap(armadillo_write_block(writer, x));
+    return rcpp_result_gen;
+END_RCPP
+}
+// armadillo_close_block_writer
+bool armadillo_close_block_writer(SEXP writer);
+RcppExport SEXP _RcppArmadillo_armadillo_close_block_writer(SEXP writerSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::RNGScope rcpp_rngScope_gen;
+    Rcpp::traits::input_parameter< SEXP >::type writer(writerSEXP);
+    rcpp_result_gen = Rcpp::wrap(armadillo_close_block_writer(writer));
+    return rcpp_result_gen;
+END_RCPP
+}
 // fastLm_impl
 Rcpp::List fastLm_impl(const arma::mat& X, const arma::colvec& y);
 RcppExport SEXP _RcppArmadillo_fastLm_impl(SEXP XSEXP, SEXP ySEXP) {
@@ -91,6 +151,11 @@ static const R_CallMethodDef CallEntries[] = {
     {"_RcppArmadillo_armadillo_set_seed", (DL_FUNC) &_RcppArmadillo_armadillo_set_seed, 1},
     {"_RcppArmadillo_armadillo_get_number_of_omp_threads", (DL_FUNC) &_RcppArmadillo_armadillo_get_number_of_omp_threads, 0},
     {"_RcppArmadillo_armadillo_set_number_of_omp_threads", (DL_FUNC) &_RcppArmadillo_armadillo_set_number_of_omp_threads, 1},
+    {"_RcppArmadillo_armadillo_block_reader", (DL_FUNC) &_RcppArmadillo_armadillo_block_reader, 4},
+    {"_RcppArmadillo_armadillo_read_block", (DL_FUNC) &_RcppArmadillo_armadillo_read_block, 1},
+    {"_RcppArmadillo_armadillo_block_writer", (DL_FUNC) &_RcppArmadillo_armadillo_block_writer, 2},
+    {"_RcppArmadillo_armadillo_write_block", (DL_FUNC) &_RcppArmadillo_armadillo_write_block, 2},
+    {"_RcppArmadillo_armadillo_close_block_writer", (DL_FUNC) &_RcppArmadillo_armadillo_close_block_writer, 1},
     {"_RcppArmadillo_fastLm_impl", (DL_FUNC) &_RcppArmadillo_fastLm_impl, 2},
     {NULL, NULL, 0}
 };
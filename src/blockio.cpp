@@ -0,0 +1,125 @@
+// -*- mode: C++; c-indent-level: 4; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+//
+// blockio.cpp: Reading and writing large matrices in blocks
+//
+// Copyright (C)  2026  Dirk Eddelbuettel
+//
+// This file is part of RcppArmadillo.
+//
+// RcppArmadillo is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// RcppArmadillo is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with RcppArmadillo.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <RcppArmadillo/Lighter>
+
+// reader and the block buffer reused across calls
+struct BlockReader {
+    arma::block_reader<double> reader;
+    arma::mat block;
+};
+
+typedef Rcpp::XPtr<BlockReader>                BlockReaderPtr;
+typedef Rcpp::XPtr<arma::block_writer<double>> BlockWriterPtr;
+
+static arma::file_type blockFileType(const std::string& type) {
+    if (type == "csv")         return arma::csv_ascii;
+    if (type == "ssv")         return arma::ssv_ascii;
+    if (type == "raw_ascii")   return arma::raw_ascii;
+    if (type == "raw_binary")  return arma::raw_binary;
+    if (type == "arma_binary") return arma::arma_binary;
+    if (type == "coord_ascii") return arma::coord_ascii;
+    Rcpp::stop("unsupported file type '%s'", type);
+    return arma::file_type_unknown;
+}
+
+//' Read or Write Large Matrices in Blocks
+//'
+//' @description Files too large to be loaded at once can be processed as a
+//' sequence of blocks. A reader returns consecutive blocks of rows
+//' (\code{dim = 0}) or columns (\code{dim = 1}) of the matrix stored in a
+//' file; a writer appends blocks to a file.
+//' @details Supported file types are \code{"csv"}, \code{"ssv"} (semicolon
+//' separated) and \code{"raw_ascii"} (blocks of rows), \code{"raw_binary"}
+//' (read as a single column), \code{"arma_binary"} (blocks of rows or
+//' columns when reading, blocks of columns when writing) and
+//' \code{"coord_ascii"} (blocks of columns; entries have to be ordered by
+//' column, as written by Armadillo). When \code{"raw_binary"} is written,
+//' the elements of each block are appended in column-major order.
+//'
+//' Where supported by the compiler, the next block is read (or the previous
+//' block is written) by a background thread while R works on the current one.
+//' A writer uses a temporary file which is renamed when the writer is closed.
+//' @param file A character string with the file name.
+//' @param type A character string with the file type, see Details.
+//' @param block_size The number of rows or columns in each block.
+//' @param dim An integer selecting blocks of rows (0) or columns (1).
+//' @param reader A reader object returned by \code{armadillo_block_reader}.
+//' @param writer A writer object returned by \code{armadillo_block_writer}.
+//' @param x A numeric matrix to be appended.
+//' @return \code{armadillo_block_reader} and \code{armadillo_block_writer}
+//' return external pointer objects. \code{armadillo_read_block} returns the
+//' next block as a matrix, or \code{NULL} at the end of the file.
+//' \code{armadillo_write_block} and \code{armadillo_close_block_writer}
+//' return a logical value indicating success.
+//' @examples
+//' f <- tempfile()
+//' w <- armadillo_block_writer(f, "arma_binary")
+//' for (i in 1:3) armadillo_write_block(w, matrix(rnorm(20), 4, 5))
+//' armadillo_close_block_writer(w)
+//' r <- armadillo_block_reader(f, "arma_binary", 6L, 1L)
+//' while (!is.null(b <- armadillo_read_block(r))) print(dim(b))
+//' unlink(f)
+// [[Rcpp::export]]
+SEXP armadillo_block_reader(std::string file, std::string type = "csv", int block_size = 10000, int dim = 0) {
+    if (block_size < 1) Rcpp::stop("'block_size' must be positive");
+    if (dim != 0 && dim != 1) Rcpp::stop("'dim' must be 0 or 1");
+    BlockReaderPtr p(new BlockReader, true);
+    if (!p->reader.open(file, blockFileType(type), block_size, dim))
+        Rcpp::stop("could not open '%s' for reading in blocks", file);
+    p.attr("class") = "armadillo_block_reader";
+    return p;
+}
+
+//' @rdname armadillo_block_reader
+// [[Rcpp::export]]
+SEXP armadillo_read_block(SEXP reader) {
+    BlockReaderPtr p(reader);
+    if (!p->reader.next(p->block)) {
+        if (!p->reader.good()) Rcpp::stop("invalid data in block");
+        return R_NilValue;
+    }
+    return Rcpp::wrap(p->block);
+}
+
+//' @rdname armadillo_block_reader
+// [[Rcpp::export]]
+SEXP armadillo_block_writer(std::string file, std::string type = "csv") {
+    BlockWriterPtr p(new arma::block_writer<double>, true);
+    if (!p->open(file, blockFileType(type)))
+        Rcpp::stop("could not open '%s' for writing in blocks", file);
+    p.attr("class") = "armadillo_block_writer";
+    return p;
+}
+
+//' @rdname armadillo_block_reader
+// [[Rcpp::export]]
+bool armadillo_write_block(SEXP writer, const arma::mat& x) {
+    BlockWriterPtr p(writer);
+    return p->append(x);
+}
+
+//' @rdname armadillo_block_reader
+// [[Rcpp::export]]
+bool armadillo_close_block_writer(SEXP writer) {
+    BlockWriterPtr p(writer);
+    return p->close();
+}